@@ -0,0 +1,106 @@
+/*
+ * The serialized tree format definitions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _CDATA_SERIALIZED_TREE_H )
+#define _CDATA_SERIALIZED_TREE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The serialized tree consists of a header followed by the nodes in pre-order
+ * Every node is followed by its value data and then its first sub node
+ * All values are stored in little-endian
+ */
+typedef struct cdata_serialized_tree_header cdata_serialized_tree_header_t;
+
+struct cdata_serialized_tree_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "cdtree\x00\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of nodes
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_nodes[ 4 ];
+
+	/* The data size, which includes the header
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_size[ 8 ];
+
+	/* Reserved
+	 * Consists of 8 bytes
+	 * Contains 0
+	 */
+	uint8_t reserved[ 8 ];
+};
+
+typedef struct cdata_serialized_tree_node cdata_serialized_tree_node_t;
+
+struct cdata_serialized_tree_node
+{
+	/* The offset of the parent node entry relative to the start of the data
+	 * Consists of 8 bytes
+	 * Contains 0 if the node has no parent node
+	 */
+	uint8_t parent_node_offset[ 8 ];
+
+	/* The offset of the next node entry relative to the start of the data
+	 * Consists of 8 bytes
+	 * Contains 0 if the node has no next node
+	 */
+	uint8_t next_node_offset[ 8 ];
+
+	/* The number of sub nodes
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_sub_nodes[ 4 ];
+
+	/* The flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The value data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t value_data_size[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CDATA_SERIALIZED_TREE_H ) */
+
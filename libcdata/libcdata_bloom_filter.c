@@ -0,0 +1,504 @@
+/*
+ * Bloom filter functions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdata_bloom_filter.h"
+#include "libcdata_libcerror.h"
+
+/* Creates a Bloom filter
+ * Make sure the value bloom_filter is referencing, is set to NULL
+ *
+ * The Bloom filter is sized for the number of values, where approximately 1 in
+ * false positive rate lookups of a hash that was not added is a false positive
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_bloom_filter_initialize(
+     libcdata_bloom_filter_t **bloom_filter,
+     int number_of_values,
+     int false_positive_rate,
+     libcerror_error_t **error )
+{
+	static char *function  = "libcdata_bloom_filter_initialize";
+	uint64_t number_of_bits = 0;
+	uint64_t power         = 0;
+	int bits_per_value     = 0;
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bloom_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Bloom filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( false_positive_rate < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid false positive rate value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* With the optimal number of hashes the false positive probability is
+	 * approximately 0.6185 ^ bits per value, hence the bits per value is
+	 * the smallest value for which 1.6168 ^ bits per value is at least
+	 * the false positive rate, which is determined in 16.16 fixed point
+	 */
+	power = (uint64_t) 1 << 16;
+
+	while( power < ( (uint64_t) false_positive_rate << 16 ) )
+	{
+		power = ( power * 105961 ) >> 16;
+
+		bits_per_value++;
+	}
+	number_of_bits = (uint64_t) bits_per_value * (uint64_t) number_of_values;
+
+	if( number_of_bits < 64 )
+	{
+		number_of_bits = 64;
+	}
+	number_of_bits = ( number_of_bits + 7 ) & ~( (uint64_t) 7 );
+
+	if( ( number_of_bits / 8 ) > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of bits value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*bloom_filter = memory_allocate_structure(
+	                 libcdata_bloom_filter_t );
+
+	if( *bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Bloom filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bloom_filter,
+	     0,
+	     sizeof( libcdata_bloom_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Bloom filter.",
+		 function );
+
+		memory_free(
+		 *bloom_filter );
+
+		*bloom_filter = NULL;
+
+		return( -1 );
+	}
+	( *bloom_filter )->bits_size      = (size_t) ( number_of_bits / 8 );
+	( *bloom_filter )->number_of_bits = number_of_bits;
+
+	( *bloom_filter )->bits = (uint8_t *) memory_allocate(
+	                                       ( *bloom_filter )->bits_size );
+
+	if( ( *bloom_filter )->bits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bits.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *bloom_filter )->bits,
+	     0,
+	     ( *bloom_filter )->bits_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bits.",
+		 function );
+
+		goto on_error;
+	}
+	/* The optimal number of hashes is bits per value * ln( 2 )
+	 */
+	( *bloom_filter )->number_of_hashes = ( ( bits_per_value * 693 ) + 500 ) / 1000;
+
+	if( ( *bloom_filter )->number_of_hashes < 1 )
+	{
+		( *bloom_filter )->number_of_hashes = 1;
+	}
+	return( 1 );
+
+on_error:
+	if( *bloom_filter != NULL )
+	{
+		if( ( *bloom_filter )->bits != NULL )
+		{
+			memory_free(
+			 ( *bloom_filter )->bits );
+		}
+		memory_free(
+		 *bloom_filter );
+
+		*bloom_filter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a Bloom filter
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_bloom_filter_free(
+     libcdata_bloom_filter_t **bloom_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_bloom_filter_free";
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bloom_filter != NULL )
+	{
+		if( ( *bloom_filter )->bits != NULL )
+		{
+			memory_free(
+			 ( *bloom_filter )->bits );
+		}
+		memory_free(
+		 *bloom_filter );
+
+		*bloom_filter = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones a Bloom filter
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_bloom_filter_clone(
+     libcdata_bloom_filter_t **destination_bloom_filter,
+     libcdata_bloom_filter_t *source_bloom_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_bloom_filter_clone";
+
+	if( destination_bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_bloom_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination Bloom filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_bloom_filter == NULL )
+	{
+		*destination_bloom_filter = NULL;
+
+		return( 1 );
+	}
+	*destination_bloom_filter = memory_allocate_structure(
+	                             libcdata_bloom_filter_t );
+
+	if( *destination_bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination Bloom filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *destination_bloom_filter,
+	     source_bloom_filter,
+	     sizeof( libcdata_bloom_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination Bloom filter.",
+		 function );
+
+		memory_free(
+		 *destination_bloom_filter );
+
+		*destination_bloom_filter = NULL;
+
+		return( -1 );
+	}
+	( *destination_bloom_filter )->bits = (uint8_t *) memory_allocate(
+	                                                   source_bloom_filter->bits_size );
+
+	if( ( *destination_bloom_filter )->bits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination bits.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *destination_bloom_filter )->bits,
+	     source_bloom_filter->bits,
+	     source_bloom_filter->bits_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination bits.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_bloom_filter != NULL )
+	{
+		if( ( *destination_bloom_filter )->bits != NULL )
+		{
+			memory_free(
+			 ( *destination_bloom_filter )->bits );
+		}
+		memory_free(
+		 *destination_bloom_filter );
+
+		*destination_bloom_filter = NULL;
+	}
+	return( -1 );
+}
+
+/* Empties a Bloom filter
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_bloom_filter_empty(
+     libcdata_bloom_filter_t *bloom_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_bloom_filter_empty";
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     bloom_filter->bits,
+	     0,
+	     bloom_filter->bits_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bits.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds a hash to a Bloom filter
+ *
+ * The hash is mixed before the bits are determined, hence a hash
+ * with a poor distribution, such as the value itself, can be used
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_bloom_filter_add_hash(
+     libcdata_bloom_filter_t *bloom_filter,
+     uint64_t hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_bloom_filter_add_hash";
+	uint64_t bit_index    = 0;
+	uint64_t hash_step    = 0;
+	int hash_index        = 0;
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ULL;
+	hash ^= hash >> 33;
+
+	/* The bits are determined by double hashing the lower and upper 32-bit of the hash
+	 */
+	bit_index = hash & 0xffffffffUL;
+	hash_step = ( hash >> 32 ) | 1;
+
+	for( hash_index = 0;
+	     hash_index < bloom_filter->number_of_hashes;
+	     hash_index++ )
+	{
+		bit_index %= bloom_filter->number_of_bits;
+
+		bloom_filter->bits[ bit_index / 8 ] |= (uint8_t) ( 1 << ( bit_index % 8 ) );
+
+		bit_index += hash_step;
+	}
+	return( 1 );
+}
+
+/* Determines if a Bloom filter contains a hash
+ * Returns 1 if the hash was possibly added, 0 if the hash was definitely not added or -1 on error
+ */
+int libcdata_bloom_filter_contains_hash(
+     libcdata_bloom_filter_t *bloom_filter,
+     uint64_t hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_bloom_filter_contains_hash";
+	uint64_t bit_index    = 0;
+	uint64_t hash_step    = 0;
+	int hash_index        = 0;
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	/* The bits are determined in the same way as when the hash was added
+	 */
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ULL;
+	hash ^= hash >> 33;
+
+	bit_index = hash & 0xffffffffUL;
+	hash_step = ( hash >> 32 ) | 1;
+
+	for( hash_index = 0;
+	     hash_index < bloom_filter->number_of_hashes;
+	     hash_index++ )
+	{
+		bit_index %= bloom_filter->number_of_bits;
+
+		if( ( bloom_filter->bits[ bit_index / 8 ] & (uint8_t) ( 1 << ( bit_index % 8 ) ) ) == 0 )
+		{
+			return( 0 );
+		}
+		bit_index += hash_step;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,92 @@
+/*
+ * Bloom filter functions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATA_BLOOM_FILTER_H )
+#define _LIBCDATA_BLOOM_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdata_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The Bloom filter is a bit array that is used to determine if a hash
+ * is definitely not in a set, without false negatives
+ */
+typedef struct libcdata_bloom_filter libcdata_bloom_filter_t;
+
+struct libcdata_bloom_filter
+{
+	/* The bits
+	 */
+	uint8_t *bits;
+
+	/* The bits size
+	 */
+	size_t bits_size;
+
+	/* The number of bits
+	 */
+	uint64_t number_of_bits;
+
+	/* The number of bits that are set per hash
+	 */
+	int number_of_hashes;
+};
+
+int libcdata_bloom_filter_initialize(
+     libcdata_bloom_filter_t **bloom_filter,
+     int number_of_values,
+     int false_positive_rate,
+     libcerror_error_t **error );
+
+int libcdata_bloom_filter_free(
+     libcdata_bloom_filter_t **bloom_filter,
+     libcerror_error_t **error );
+
+int libcdata_bloom_filter_clone(
+     libcdata_bloom_filter_t **destination_bloom_filter,
+     libcdata_bloom_filter_t *source_bloom_filter,
+     libcerror_error_t **error );
+
+int libcdata_bloom_filter_empty(
+     libcdata_bloom_filter_t *bloom_filter,
+     libcerror_error_t **error );
+
+int libcdata_bloom_filter_add_hash(
+     libcdata_bloom_filter_t *bloom_filter,
+     uint64_t hash,
+     libcerror_error_t **error );
+
+int libcdata_bloom_filter_contains_hash(
+     libcdata_bloom_filter_t *bloom_filter,
+     uint64_t hash,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATA_BLOOM_FILTER_H ) */
+
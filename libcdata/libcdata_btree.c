@@ -24,19 +24,20 @@
 #include <types.h>
 
 #include "libcdata_array.h"
+#include "libcdata_bloom_filter.h"
 #include "libcdata_btree.h"
 #include "libcdata_btree_node.h"
-#include "libcdata_btree_values_list.h"
+#include "libcdata_btree_node_values.h"
 #include "libcdata_definitions.h"
 #include "libcdata_libcerror.h"
 #include "libcdata_libcthreads.h"
-#include "libcdata_list.h"
-#include "libcdata_list_element.h"
 #include "libcdata_tree_node.h"
 #include "libcdata_types.h"
+#include "libcdata_unused.h"
 
 /* Creates a tree
  * Make sure the value tree is referencing, is set to NULL
+ * The maximum number of values per node must be 2 or more
  * Returns 1 if successful or -1 on error
  */
 int libcdata_btree_initialize(
@@ -69,7 +70,7 @@ int libcdata_btree_initialize(
 
 		return( -1 );
 	}
-	if( maximum_number_of_values <= 0 )
+	if( maximum_number_of_values < 2 )
 	{
 		libcerror_error_set(
 		 error,
@@ -125,8 +126,9 @@ int libcdata_btree_initialize(
 
 		goto on_error;
 	}
-	if( libcdata_tree_node_initialize(
+	if( libcdata_btree_node_initialize(
 	     &( internal_tree->root_node ),
+	     maximum_number_of_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -221,9 +223,8 @@ int libcdata_btree_free(
 			result = -1;
 		}
 #endif
-		if( libcdata_tree_node_free(
+		if( libcdata_btree_node_free(
 		     &( internal_tree->root_node ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libcdata_btree_values_list_free,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -249,438 +250,641 @@ int libcdata_btree_free(
 
 			result = -1;
 		}
+		if( internal_tree->bloom_filter != NULL )
+		{
+			if( libcdata_bloom_filter_free(
+			     &( internal_tree->bloom_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free Bloom filter.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_tree->free_value_indexes != NULL )
+		{
+			memory_free(
+			 internal_tree->free_value_indexes );
+		}
 		memory_free(
 		 internal_tree );
 	}
 	return( result );
 }
 
-/* TODO add clone function ? */
-
-/* Retrieves the number of values in the tree
- * Returns 1 if successful or -1 on error
+/* Compares the addresses of two values
+ * This is used to map the values of a tree onto the values of its clone
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
  */
-int libcdata_btree_get_number_of_values(
-     libcdata_btree_t *tree,
-     int *number_of_values,
-     libcerror_error_t **error )
+int libcdata_internal_btree_compare_value_addresses(
+     intptr_t *first_value,
+     intptr_t *second_value,
+     libcerror_error_t **error LIBCDATA_ATTRIBUTE_UNUSED )
 {
-	libcdata_internal_btree_t *internal_tree = NULL;
-	static char *function                    = "libcdata_btree_get_number_of_values";
+	LIBCDATA_UNREFERENCED_PARAMETER( error )
 
-	if( tree == NULL )
+	if( (intptr_t) first_value < (intptr_t) second_value )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid tree.",
-		 function );
-
-		return( -1 );
+		return( LIBCDATA_COMPARE_LESS );
 	}
-	internal_tree = (libcdata_internal_btree_t *) tree;
-
-	if( libcdata_array_get_number_of_entries(
-	     internal_tree->values_array,
-	     number_of_values,
-	     error ) != 1 )
+	else if( (intptr_t) first_value > (intptr_t) second_value )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values array entries.",
-		 function );
-
-		return( -1 );
+		return( LIBCDATA_COMPARE_GREATER );
 	}
-	return( 1 );
+	return( LIBCDATA_COMPARE_EQUAL );
 }
 
-/* Retrieves a specific value
+/* Clones the values and sub nodes of a source node into an empty destination node
+ *
+ * The source values contain the entries of the values array of the source tree and
+ * the sorted indexes contain their indexes sorted by address. A value of the source node
+ * is replaced by the entry with the same index in the destination values array
+ *
  * Returns 1 if successful or -1 on error
  */
-int libcdata_btree_get_value_by_index(
-     libcdata_btree_t *tree,
-     int value_index,
-     intptr_t **value,
+int libcdata_internal_btree_clone_node(
+     libcdata_tree_node_t *destination_node,
+     libcdata_tree_node_t *source_node,
+     intptr_t **source_values,
+     int *sorted_indexes,
+     int number_of_values,
+     libcdata_array_t *destination_values_array,
      libcerror_error_t **error )
 {
-	libcdata_internal_btree_t *internal_tree = NULL;
-	static char *function                    = "libcdata_btree_get_value_by_index";
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	intptr_t *destination_value               = NULL;
+	static char *function                     = "libcdata_internal_btree_clone_node";
+	int first_index                           = 0;
+	int last_index                            = 0;
+	int middle_index                          = 0;
+	int node_value_index                      = 0;
+	int sub_node_index                        = 0;
 
-	if( tree == NULL )
+	if( source_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid tree.",
+		 "%s: invalid source values.",
 		 function );
 
 		return( -1 );
 	}
-	internal_tree = (libcdata_internal_btree_t *) tree;
-
-	if( libcdata_array_get_entry_by_index(
-	     internal_tree->values_array,
-	     value_index,
-	     value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from array.",
-		 function,
-		 value_index );
-
-		return( -1 );
-	}
-	return( 1 );
-}
-
-/* Retrieves a value from the tree
- *
- * Uses the value_compare_function to determine the similarity of the entries
- * The value_compare_function should return LIBCDATA_COMPARE_LESS,
- * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
- *
- * Returns 1 if successful, 0 if no such value or -1 on error
- */
-int libcdata_btree_get_value_by_value(
-     libcdata_btree_t *tree,
-     intptr_t *value,
-     int (*value_compare_function)(
-            intptr_t *first_value,
-            intptr_t *second_value,
-            libcerror_error_t **error ),
-     libcdata_tree_node_t **upper_node,
-     intptr_t **existing_value,
-     libcerror_error_t **error )
-{
-	libcdata_internal_btree_t *internal_tree       = NULL;
-	libcdata_list_element_t *existing_list_element = NULL;
-	static char *function                          = "libcdata_btree_get_value_by_value";
-	int result                                     = 0;
-
-	if( tree == NULL )
+	if( sorted_indexes == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid tree.",
+		 "%s: invalid sorted indexes.",
 		 function );
 
 		return( -1 );
 	}
-	internal_tree = (libcdata_internal_btree_t *) tree;
-
-	result = libcdata_btree_node_get_upper_node_by_value(
-	          internal_tree->root_node,
-	          value,
-	          value_compare_function,
-	          upper_node,
-	          &existing_list_element,
-	          error );
-
-	if( result == -1 )
+	if( libcdata_btree_node_get_node_values(
+	     source_node,
+	     &node_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve upper node by value.",
+		 "%s: unable to retrieve source node values.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	for( node_value_index = 0;
+	     node_value_index < node_values->number_of_values;
+	     node_value_index++ )
 	{
-		if( libcdata_list_element_get_value(
-		     existing_list_element,
-		     existing_value,
+		first_index = 0;
+		last_index  = number_of_values;
+
+		while( first_index < last_index )
+		{
+			middle_index = first_index + ( ( last_index - first_index ) / 2 );
+
+			if( (intptr_t) source_values[ sorted_indexes[ middle_index ] ] < (intptr_t) node_values->values[ node_value_index ] )
+			{
+				first_index = middle_index + 1;
+			}
+			else
+			{
+				last_index = middle_index;
+			}
+		}
+		if( ( first_index >= number_of_values )
+		 || ( source_values[ sorted_indexes[ first_index ] ] != node_values->values[ node_value_index ] ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing value: %d in values array.",
+			 function,
+			 node_value_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_get_entry_by_index(
+		     destination_values_array,
+		     sorted_indexes[ first_index ],
+		     &destination_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from values list element.",
-			 function );
+			 "%s: unable to retrieve destination value: %d from values array.",
+			 function,
+			 sorted_indexes[ first_index ] );
+
+			return( -1 );
+		}
+		if( libcdata_btree_node_append_value(
+		     destination_node,
+		     destination_value,
+		     node_values->keys[ node_value_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value: %d to destination node.",
+			 function,
+			 node_value_index );
 
 			return( -1 );
 		}
 	}
-	else
+	for( sub_node_index = 0;
+	     sub_node_index < node_values->number_of_sub_nodes;
+	     sub_node_index++ )
 	{
-		if( existing_value == NULL )
+		if( libcdata_btree_node_initialize(
+		     &sub_node,
+		     node_values->maximum_number_of_values,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid existing value.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination sub node: %d.",
+			 function,
+			 sub_node_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		*existing_value = NULL;
+		if( libcdata_internal_btree_clone_node(
+		     sub_node,
+		     node_values->sub_nodes[ sub_node_index ],
+		     source_values,
+		     sorted_indexes,
+		     number_of_values,
+		     destination_values_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to clone sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
+		}
+		if( libcdata_btree_node_append_sub_node(
+		     destination_node,
+		     sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sub node: %d to destination node.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
+		}
+		sub_node = NULL;
 	}
-	return( result );
+	if( libcdata_btree_node_update_number_of_leaf_values(
+	     destination_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update number of leaf values of destination node.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( sub_node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &sub_node,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Inserts a value into a tree
+/* Clones the tree
  *
- * Uses the value_compare_function to determine the order of the entries
- * The value_compare_function should return LIBCDATA_COMPARE_LESS,
- * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ * The nodes of the source tree are copied, hence the values do not need to be compared
+ * and the values are stored at the same value indexes as in the source tree
  *
- * Returns 1 if successful, 0 if the value already exists or -1 on error
+ * The values are cloned using the value_clone_function
+ * On error the values are freed using the value_free_function
+ *
+ * Returns 1 if successful or -1 on error
  */
-int libcdata_btree_insert_value(
-     libcdata_btree_t *tree,
-     int *value_index,
-     intptr_t *value,
-     int (*value_compare_function)(
-            intptr_t *first_value,
-            intptr_t *second_value,
+int libcdata_btree_clone(
+     libcdata_btree_t **destination_tree,
+     libcdata_btree_t *source_tree,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     int (*value_clone_function)(
+            intptr_t **destination_value,
+            intptr_t *source_value,
             libcerror_error_t **error ),
-     libcdata_tree_node_t **upper_node,
-     intptr_t **existing_value,
      libcerror_error_t **error )
 {
-	libcdata_internal_btree_t *internal_tree       = NULL;
-	libcdata_list_t *values_list                   = NULL;
-	libcdata_list_element_t *existing_list_element = NULL;
-	static char *function                          = "libcdata_btree_insert_value";
-	int number_of_values_list_elements             = 0;
-	int result                                     = 0;
+	libcdata_internal_btree_t *internal_destination_tree = NULL;
+	libcdata_internal_btree_t *internal_source_tree      = NULL;
+	intptr_t **source_values                             = NULL;
+	int *sorted_indexes                                  = NULL;
+	static char *function                                = "libcdata_btree_clone";
+	int number_of_values                                 = 0;
+	int value_index                                      = 0;
 
-	if( tree == NULL )
+	if( destination_tree == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid tree.",
+		 "%s: invalid destination tree.",
 		 function );
 
 		return( -1 );
 	}
-	internal_tree = (libcdata_internal_btree_t *) tree;
-
-	if( upper_node == NULL )
+	if( *destination_tree != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid upper node.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination tree value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( value_index == NULL )
+	if( value_free_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value index.",
+		 "%s: invalid value free function.",
 		 function );
 
 		return( -1 );
 	}
-	if( existing_value == NULL )
+	if( value_clone_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid existing value.",
+		 "%s: invalid value clone function.",
 		 function );
 
 		return( -1 );
 	}
-	result = libcdata_btree_node_get_upper_node_by_value(
-	          internal_tree->root_node,
-	          value,
-	          value_compare_function,
-	          upper_node,
-	          &existing_list_element,
-	          error );
+	if( source_tree == NULL )
+	{
+		*destination_tree = NULL;
 
-	if( result == -1 )
+		return( 1 );
+	}
+	internal_source_tree = (libcdata_internal_btree_t *) source_tree;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_source_tree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve upper node in root node.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+#endif
+	if( libcdata_btree_initialize(
+	     (libcdata_btree_t **) &internal_destination_tree,
+	     internal_source_tree->maximum_number_of_values,
+	     error ) != 1 )
 	{
-		if( libcdata_list_element_get_value(
-		     existing_list_element,
-		     existing_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from values list element.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination tree.",
+		 function );
 
-			return( -1 );
-		}
-		return( 0 );
+		goto on_error;
 	}
-	*existing_value = NULL;
-
-	if( libcdata_btree_node_insert_value(
-	     *upper_node,
-	     value,
-	     value_compare_function,
-	     error ) != 1 )
+	if( internal_destination_tree == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert value in upper node.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing destination tree.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_tree_node_get_value(
-	     *upper_node,
-	     (intptr_t **) &values_list,
+	/* The values array is cloned so that the values retain their value index
+	 * including the free entries of removed values
+	 */
+	if( libcdata_array_free(
+	     &( internal_destination_tree->values_array ),
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve values list.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free destination values array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_list_get_number_of_elements(
-	     values_list,
-	     &number_of_values_list_elements,
+	if( libcdata_array_clone(
+	     &( internal_destination_tree->values_array ),
+	     internal_source_tree->values_array,
+	     value_free_function,
+	     value_clone_function,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values list elements.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination values array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( number_of_values_list_elements >= internal_tree->maximum_number_of_values )
+	if( internal_source_tree->number_of_free_value_indexes > 0 )
 	{
-		if( libcdata_btree_node_split(
-		     *upper_node,
-		     error ) != 1 )
+		internal_destination_tree->free_value_indexes = (int *) memory_allocate(
+		                                                         sizeof( int ) * internal_source_tree->number_of_free_value_indexes );
+
+		if( internal_destination_tree->free_value_indexes == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to split upper node.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination free value indexes.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_destination_tree->free_value_indexes,
+		     internal_source_tree->free_value_indexes,
+		     sizeof( int ) * internal_source_tree->number_of_free_value_indexes ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy free value indexes.",
+			 function );
+
+			goto on_error;
 		}
-/* TODO do merge of upper node with its parent node */
-/* TODO loop until number_of_values_list_elements < internal_tree->maximum_number_of_values */
+		internal_destination_tree->number_of_free_value_indexes           = internal_source_tree->number_of_free_value_indexes;
+		internal_destination_tree->number_of_allocated_free_value_indexes = internal_source_tree->number_of_free_value_indexes;
+	}
+	if( libcdata_bloom_filter_clone(
+	     &( internal_destination_tree->bloom_filter ),
+	     internal_source_tree->bloom_filter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination Bloom filter.",
+		 function );
+
+		goto on_error;
+	}
+	internal_destination_tree->value_hash_function = internal_source_tree->value_hash_function;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_source_tree->values_array,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values array entries.",
+		 function );
 
-		/* Make sure existing list element updated after the split
+		goto on_error;
+	}
+	if( number_of_values > 0 )
+	{
+		/* The nodes reference the values by address, hence the entries of the values array
+		 * are sorted by address to map the values of a node onto their value index
 		 */
-		result = libcdata_btree_node_get_sub_node_by_value(
-		          *upper_node,
-		          value,
-		          value_compare_function,
-		          upper_node,
-		          &existing_list_element,
-		          error );
+		source_values = (intptr_t **) memory_allocate(
+		                               sizeof( intptr_t * ) * number_of_values );
 
-		if( result == -1 )
+		if( source_values == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve split sub node by value.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create source values.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		result = libcdata_btree_node_get_sub_node_by_value(
-		          *upper_node,
-		          value,
-		          value_compare_function,
-		          upper_node,
-		          &existing_list_element,
-		          error );
+		sorted_indexes = (int *) memory_allocate(
+		                          sizeof( int ) * number_of_values );
 
-		if( result != 1 )
+		if( sorted_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sorted indexes.",
+			 function );
+
+			goto on_error;
+		}
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_source_tree->values_array,
+			     value_index,
+			     &( source_values[ value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value: %d from values array.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		if( libcdata_internal_btree_sort_value_indexes(
+		     source_values,
+		     number_of_values,
+		     &libcdata_internal_btree_compare_value_addresses,
+		     sorted_indexes,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve split sub node by value.",
+			 "%s: unable to sort values by address.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( libcdata_internal_btree_clone_node(
+		     internal_destination_tree->root_node,
+		     internal_source_tree->root_node,
+		     source_values,
+		     sorted_indexes,
+		     number_of_values,
+		     internal_destination_tree->values_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to clone root node.",
+			 function );
+
+			goto on_error;
 		}
+		memory_free(
+		 sorted_indexes );
+
+		sorted_indexes = NULL;
+
+		memory_free(
+		 source_values );
+
+		source_values = NULL;
 	}
-	if( libcdata_array_append_entry(
-	     internal_tree->values_array,
-	     value_index,
-	     value,
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_source_tree->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append value to values array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
+		libcdata_btree_free(
+		 (libcdata_btree_t **) &internal_destination_tree,
+		 value_free_function,
+		 NULL );
+
 		return( -1 );
 	}
+#endif
+	*destination_tree = (libcdata_btree_t *) internal_destination_tree;
+
 	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_source_tree->read_write_lock,
+	 NULL );
+#endif
+	if( sorted_indexes != NULL )
+	{
+		memory_free(
+		 sorted_indexes );
+	}
+	if( source_values != NULL )
+	{
+		memory_free(
+		 source_values );
+	}
+	if( internal_destination_tree != NULL )
+	{
+		libcdata_btree_free(
+		 (libcdata_btree_t **) &internal_destination_tree,
+		 value_free_function,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Replaces a value in the tree
+/* Retrieves the number of values in the tree
  * Returns 1 if successful or -1 on error
  */
-int libcdata_btree_replace_value(
+int libcdata_btree_get_number_of_values(
      libcdata_btree_t *tree,
-     libcdata_tree_node_t *upper_node,
-     int *value_index,
-     intptr_t *value,
-     int *replacement_value_index,
-     intptr_t *replacement_value,
+     int *number_of_values,
      libcerror_error_t **error )
 {
 	libcdata_internal_btree_t *internal_tree = NULL;
-	intptr_t *check_value                    = NULL;
-	static char *function                    = "libcdata_btree_replace_value";
-	int number_of_sub_nodes                  = 0;
+	static char *function                    = "libcdata_btree_get_number_of_values";
+	int result                               = 1;
 
 	if( tree == NULL )
 	{
@@ -695,144 +899,186 @@ int libcdata_btree_replace_value(
 	}
 	internal_tree = (libcdata_internal_btree_t *) tree;
 
-	if( upper_node == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid upper node.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( value_index == NULL )
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_tree->values_array,
+	     number_of_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value index.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values array entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( replacement_value_index == NULL )
+#endif
+	return( result );
+}
+
+/* Retrieves statistics of the tree
+ * The height is the number of levels of nodes below the root node,
+ * which is 0 if the root node is a leaf node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_get_statistics(
+     libcdata_btree_t *tree,
+     int *height,
+     int *number_of_nodes,
+     int *number_of_leaf_nodes,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	static char *function                    = "libcdata_btree_get_statistics";
+	int result                               = 1;
+	int safe_height                          = 0;
+	int safe_number_of_leaf_nodes            = 0;
+	int safe_number_of_nodes                 = 0;
+
+	if( tree == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value index.",
+		 "%s: invalid tree.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_number_of_sub_nodes(
-	     upper_node,
-	     &number_of_sub_nodes,
-	     error ) != 1 )
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+	if( height == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub nodes.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid height.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_sub_nodes != 0 )
+	if( number_of_nodes == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: cannot replace upper node with sub nodes.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nodes.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_tree->values_array,
-	     *value_index,
-	     &check_value,
-	     error ) != 1 )
+	if( number_of_leaf_nodes == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from array.",
-		 function,
-		 *value_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf nodes.",
+		 function );
 
 		return( -1 );
 	}
-	if( value != check_value )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid value: %d value out of bounds.",
-		 function,
-		 *value_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
 		return( -1 );
 	}
-	if( libcdata_btree_node_replace_value(
-	     upper_node,
-	     value,
-	     replacement_value,
+#endif
+	if( libcdata_btree_node_get_statistics(
+	     internal_tree->root_node,
+	     0,
+	     &safe_height,
+	     &safe_number_of_nodes,
+	     &safe_number_of_leaf_nodes,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-		 "%s: unable to replace value: %d.",
-		 function,
-		 *value_index );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics of root node.",
+		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libcdata_array_set_entry_by_index(
-	     internal_tree->values_array,
-	     *value_index,
-	     replacement_value,
+	else
+	{
+		*height               = safe_height;
+		*number_of_nodes      = safe_number_of_nodes;
+		*number_of_leaf_nodes = safe_number_of_leaf_nodes;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_tree->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to set value: %d in values array.",
-		 function,
-		 *value_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
 		return( -1 );
 	}
-	*replacement_value_index = *value_index;
-	*value_index             = -1;
-
-	return( 1 );
+#endif
+	return( result );
 }
 
-/* Removes a value from the tree
+/* Retrieves a specific value
  * Returns 1 if successful or -1 on error
  */
-int libcdata_btree_remove_value(
+int libcdata_btree_get_value_by_index(
      libcdata_btree_t *tree,
-     libcdata_tree_node_t *upper_node,
-     int *value_index,
-     intptr_t *value,
+     int value_index,
+     intptr_t **value,
      libcerror_error_t **error )
 {
 	libcdata_internal_btree_t *internal_tree = NULL;
-	intptr_t *check_value                    = NULL;
-	static char *function                    = "libcdata_btree_remove_value";
-	int number_of_sub_nodes                  = 0;
+	static char *function                    = "libcdata_btree_get_value_by_index";
+	int result                               = 1;
 
 	if( tree == NULL )
 	{
@@ -847,118 +1093,3924 @@ int libcdata_btree_remove_value(
 	}
 	internal_tree = (libcdata_internal_btree_t *) tree;
 
-	if( upper_node == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid upper node.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( value_index == NULL )
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_tree->values_array,
+	     value_index,
+	     value,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value index.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from array.",
+		 function,
+		 value_index );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the upper node for a specific value
+ * The descent from the root node is skipped if the value falls within the range
+ * of the values of the last upper node, which is set to the upper node when
+ * the descent is not skipped
+ * The last upper node is provided by the caller, so that concurrent lookups
+ * under the read lock do not share it
+ * This function is not multi-thread safe acquire read or write lock before call
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libcdata_internal_btree_get_upper_node_by_value(
+     libcdata_internal_btree_t *internal_tree,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **last_upper_node,
+     libcdata_tree_node_t **upper_node,
+     int *value_index,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	static char *function                     = "libcdata_internal_btree_get_upper_node_by_value";
+	int compare_result                        = 0;
+	int is_in_range                           = 0;
+	int result                                = 0;
+
+	if( internal_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_upper_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last upper node.",
+		 function );
+
+		return( -1 );
+	}
+	if( upper_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upper node.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *last_upper_node != NULL )
+	 && ( value != NULL )
+	 && ( value_compare_function != NULL ) )
+	{
+		if( libcdata_btree_node_get_node_values(
+		     *last_upper_node,
+		     &node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last upper node values.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( node_values->number_of_sub_nodes == 0 )
+		 && ( node_values->number_of_values > 0 ) )
+		{
+			compare_result = value_compare_function(
+			                  value,
+			                  node_values->values[ 0 ],
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to compare value with first value of last upper node.",
+				 function );
+
+				return( -1 );
+			}
+			if( compare_result != LIBCDATA_COMPARE_LESS )
+			{
+				compare_result = value_compare_function(
+				                  value,
+				                  node_values->values[ node_values->number_of_values - 1 ],
+				                  error );
+
+				if( compare_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to compare value with last value of last upper node.",
+					 function );
+
+					return( -1 );
+				}
+				if( compare_result != LIBCDATA_COMPARE_GREATER )
+				{
+					is_in_range = 1;
+				}
+			}
+		}
+	}
+	if( is_in_range != 0 )
+	{
+		result = libcdata_btree_node_get_sub_node_by_value(
+		          *last_upper_node,
+		          value,
+		          value_compare_function,
+		          &sub_node,
+		          value_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from last upper node.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			*value_index = -1;
+		}
+		*upper_node = *last_upper_node;
+	}
+	else
+	{
+		result = libcdata_btree_node_get_upper_node_by_value(
+		          internal_tree->root_node,
+		          value,
+		          value_compare_function,
+		          upper_node,
+		          value_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve upper node in root node.",
+			 function );
+
+			return( -1 );
+		}
+		*last_upper_node = *upper_node;
+	}
+	return( result );
+}
+
+/* Retrieves the upper node for a specific key
+ * The descent from the root node is skipped if the key falls within the range
+ * of the keys of the last upper node, which is set to the upper node when
+ * the descent is not skipped
+ * The last upper node is provided by the caller, so that concurrent lookups
+ * under the read lock do not share it
+ * This function is not multi-thread safe acquire read or write lock before call
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libcdata_internal_btree_get_upper_node_by_key(
+     libcdata_internal_btree_t *internal_tree,
+     uint64_t key,
+     libcdata_tree_node_t **last_upper_node,
+     libcdata_tree_node_t **upper_node,
+     int *value_index,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	static char *function                     = "libcdata_internal_btree_get_upper_node_by_key";
+	int is_in_range                           = 0;
+	int result                                = 0;
+
+	if( internal_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_upper_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last upper node.",
+		 function );
+
+		return( -1 );
+	}
+	if( upper_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upper node.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *last_upper_node != NULL )
+	{
+		if( libcdata_btree_node_get_node_values(
+		     *last_upper_node,
+		     &node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last upper node values.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( node_values->number_of_sub_nodes == 0 )
+		 && ( node_values->number_of_values > 0 )
+		 && ( key >= node_values->keys[ 0 ] )
+		 && ( key <= node_values->keys[ node_values->number_of_values - 1 ] ) )
+		{
+			is_in_range = 1;
+		}
+	}
+	if( is_in_range != 0 )
+	{
+		result = libcdata_btree_node_get_sub_node_by_key(
+		          *last_upper_node,
+		          key,
+		          &sub_node,
+		          value_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key from last upper node.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			*value_index = -1;
+		}
+		*upper_node = *last_upper_node;
+	}
+	else
+	{
+		result = libcdata_btree_node_get_upper_node_by_key(
+		          internal_tree->root_node,
+		          key,
+		          upper_node,
+		          value_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve upper node in root node.",
+			 function );
+
+			return( -1 );
+		}
+		*last_upper_node = *upper_node;
+	}
+	return( result );
+}
+
+/* Retrieves a value from the tree
+ *
+ * Uses the value_compare_function to determine the similarity of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * If the tree has a Bloom filter that does not contain the value
+ * the value is not looked up and the upper node is set to NULL
+ *
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libcdata_internal_btree_get_value_by_value(
+     libcdata_internal_btree_t *internal_tree,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **last_upper_node,
+     libcdata_tree_node_t **upper_node,
+     intptr_t **existing_value,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcdata_internal_btree_get_value_by_value";
+	uint64_t hash            = 0;
+	int existing_value_index = 0;
+	int result               = 0;
+
+	if( internal_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( upper_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upper node.",
+		 function );
+
+		return( -1 );
+	}
+	if( existing_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid existing value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_tree->bloom_filter != NULL )
+	 && ( value != NULL ) )
+	{
+		if( internal_tree->value_hash_function(
+		     value,
+		     &hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hash of value.",
+			 function );
+
+			return( -1 );
+		}
+		result = libcdata_bloom_filter_contains_hash(
+		          internal_tree->bloom_filter,
+		          hash,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if Bloom filter contains hash.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			*upper_node     = NULL;
+			*existing_value = NULL;
+
+			return( 0 );
+		}
+	}
+	result = libcdata_internal_btree_get_upper_node_by_value(
+	          internal_tree,
+	          value,
+	          value_compare_function,
+	          last_upper_node,
+	          upper_node,
+	          &existing_value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve upper node by value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_btree_node_get_value_by_index(
+		     *upper_node,
+		     existing_value_index,
+		     existing_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from upper node.",
+			 function,
+			 existing_value_index );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		*existing_value = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a value from the tree
+ *
+ * Uses the value_compare_function to determine the similarity of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * If the tree has a Bloom filter that does not contain the value
+ * the value is not looked up and the upper node is set to NULL
+ *
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libcdata_btree_get_value_by_value(
+     libcdata_btree_t *tree,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **upper_node,
+     intptr_t **existing_value,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	libcdata_tree_node_t *last_upper_node    = NULL;
+	static char *function                    = "libcdata_btree_get_value_by_value";
+	int result                               = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+	if( existing_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid existing value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The last upper node is copied so that concurrent lookups do not share it
+	 */
+	last_upper_node = internal_tree->last_upper_node;
+
+	result = libcdata_internal_btree_get_value_by_value(
+	          internal_tree,
+	          value,
+	          value_compare_function,
+	          &last_upper_node,
+	          upper_node,
+	          existing_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sorts the indexes of values
+ * The sorted indexes must contain number of values entries
+ *
+ * Uses the value_compare_function to determine the order of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * A bottom-up merge sort is used, which is stable and only requires the value compare function
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_btree_sort_value_indexes(
+     intptr_t **values,
+     int number_of_values,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     int *sorted_indexes,
+     libcerror_error_t **error )
+{
+	int *destination_indexes = NULL;
+	int *merge_indexes       = NULL;
+	int *source_indexes      = NULL;
+	static char *function    = "libcdata_internal_btree_sort_value_indexes";
+	int compare_result       = 0;
+	int first_index          = 0;
+	int last_index           = 0;
+	int left_index           = 0;
+	int merge_size           = 0;
+	int middle_index         = 0;
+	int right_index          = 0;
+	int use_right_index      = 0;
+	int value_index          = 0;
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+	if( ( number_of_values < 0 )
+	 || ( (size_t) number_of_values > (size_t) ( SSIZE_MAX / sizeof( int ) ) ) )
+#else
+	if( ( number_of_values < 0 )
+	 || ( number_of_values > (int) ( SSIZE_MAX / sizeof( int ) ) ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_compare_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value compare function.",
+		 function );
+
+		return( -1 );
+	}
+	if( sorted_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted indexes.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		sorted_indexes[ value_index ] = value_index;
+	}
+	if( number_of_values < 2 )
+	{
+		return( 1 );
+	}
+	merge_indexes = (int *) memory_allocate(
+	                         sizeof( int ) * number_of_values );
+
+	if( merge_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create merge indexes.",
+		 function );
+
+		goto on_error;
+	}
+	source_indexes      = sorted_indexes;
+	destination_indexes = merge_indexes;
+
+	for( merge_size = 1;
+	     merge_size < number_of_values;
+	     merge_size *= 2 )
+	{
+		for( first_index = 0;
+		     first_index < number_of_values;
+		     first_index = last_index )
+		{
+			middle_index = number_of_values;
+			last_index   = number_of_values;
+
+			if( ( number_of_values - first_index ) > merge_size )
+			{
+				middle_index = first_index + merge_size;
+
+				if( ( number_of_values - middle_index ) > merge_size )
+				{
+					last_index = middle_index + merge_size;
+				}
+			}
+			left_index  = first_index;
+			right_index = middle_index;
+
+			for( value_index = first_index;
+			     value_index < last_index;
+			     value_index++ )
+			{
+				use_right_index = 0;
+
+				if( left_index >= middle_index )
+				{
+					use_right_index = 1;
+				}
+				else if( right_index < last_index )
+				{
+					compare_result = value_compare_function(
+					                  values[ source_indexes[ right_index ] ],
+					                  values[ source_indexes[ left_index ] ],
+					                  error );
+
+					if( compare_result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to compare value: %d with value: %d.",
+						 function,
+						 source_indexes[ right_index ],
+						 source_indexes[ left_index ] );
+
+						goto on_error;
+					}
+					/* Values that are equal remain in their original order
+					 */
+					if( compare_result == LIBCDATA_COMPARE_LESS )
+					{
+						use_right_index = 1;
+					}
+				}
+				if( use_right_index != 0 )
+				{
+					destination_indexes[ value_index ] = source_indexes[ right_index ];
+
+					right_index++;
+				}
+				else
+				{
+					destination_indexes[ value_index ] = source_indexes[ left_index ];
+
+					left_index++;
+				}
+			}
+		}
+		source_indexes      = destination_indexes;
+		destination_indexes = sorted_indexes;
+
+		if( source_indexes == sorted_indexes )
+		{
+			destination_indexes = merge_indexes;
+		}
+		if( merge_size >= ( number_of_values - merge_size ) )
+		{
+			break;
+		}
+	}
+	if( source_indexes != sorted_indexes )
+	{
+		if( memory_copy(
+		     sorted_indexes,
+		     source_indexes,
+		     sizeof( int ) * number_of_values ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sorted indexes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 merge_indexes );
+
+	return( 1 );
+
+on_error:
+	if( merge_indexes != NULL )
+	{
+		memory_free(
+		 merge_indexes );
+	}
+	return( -1 );
+}
+
+/* Retrieves values from the tree
+ * The values are looked up in sorted order under a single lock, so that successive
+ * values can share the upper node of the previous lookup instead of descending from
+ * the root node for every value
+ *
+ * Uses the value_compare_function to determine the similarity of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * The existing values must contain number of values entries, the existing value
+ * of a value that does not exist is set to NULL
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_get_values_by_values(
+     libcdata_btree_t *tree,
+     intptr_t **values,
+     int number_of_values,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     intptr_t **existing_values,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	libcdata_tree_node_t *last_upper_node    = NULL;
+	libcdata_tree_node_t *upper_node         = NULL;
+	int *sorted_indexes                      = NULL;
+	static char *function                    = "libcdata_btree_get_values_by_values";
+	int result                               = 0;
+	int sorted_index                         = 0;
+	int value_index                          = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+	if( ( number_of_values < 0 )
+	 || ( (size_t) number_of_values > (size_t) ( SSIZE_MAX / sizeof( int ) ) ) )
+#else
+	if( ( number_of_values < 0 )
+	 || ( number_of_values > (int) ( SSIZE_MAX / sizeof( int ) ) ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( existing_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid existing values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == 0 )
+	{
+		return( 1 );
+	}
+	/* The values are sorted before the lock is grabbed
+	 */
+	sorted_indexes = (int *) memory_allocate(
+	                          sizeof( int ) * number_of_values );
+
+	if( sorted_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted indexes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_internal_btree_sort_value_indexes(
+	     values,
+	     number_of_values,
+	     value_compare_function,
+	     sorted_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to sort values.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The last upper node is copied so that concurrent lookups do not share it
+	 */
+	last_upper_node = internal_tree->last_upper_node;
+
+	for( sorted_index = 0;
+	     sorted_index < number_of_values;
+	     sorted_index++ )
+	{
+		value_index = sorted_indexes[ sorted_index ];
+
+		result = libcdata_internal_btree_get_value_by_value(
+		          internal_tree,
+		          values[ value_index ],
+		          value_compare_function,
+		          &last_upper_node,
+		          &upper_node,
+		          &( existing_values[ value_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 value_index );
+
+			break;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	memory_free(
+	 sorted_indexes );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( sorted_indexes != NULL )
+	{
+		memory_free(
+		 sorted_indexes );
+	}
+	return( -1 );
+}
+
+/* Retrieves a value by its 64-bit key from a tree indexed by key
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libcdata_btree_get_value_by_key(
+     libcdata_btree_t *tree,
+     uint64_t key,
+     libcdata_tree_node_t **upper_node,
+     intptr_t **existing_value,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	libcdata_tree_node_t *last_upper_node    = NULL;
+	static char *function                    = "libcdata_btree_get_value_by_key";
+	int existing_value_index                 = 0;
+	int result                               = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+	if( existing_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid existing value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The last upper node is copied so that concurrent lookups do not share it
+	 */
+	last_upper_node = internal_tree->last_upper_node;
+
+	result = libcdata_internal_btree_get_upper_node_by_key(
+	          internal_tree,
+	          key,
+	          &last_upper_node,
+	          upper_node,
+	          &existing_value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve upper node by key.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_btree_node_get_value_by_index(
+		     *upper_node,
+		     existing_value_index,
+		     existing_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from upper node.",
+			 function,
+			 existing_value_index );
+
+			result = -1;
+		}
+	}
+	else
+	{
+		*existing_value = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the value at a specific rank
+ * The rank is the (zero-based) position of the value in the sorted values
+ * in contrast to the value index, which is the position in the values array
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_get_value_by_rank(
+     libcdata_btree_t *tree,
+     int rank,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	static char *function                    = "libcdata_btree_get_value_by_rank";
+	int result                               = 1;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_btree_node_get_value_by_rank(
+	     internal_tree->root_node,
+	     rank,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value with rank: %d.",
+		 function,
+		 rank );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the rank of a value
+ * The rank is the number of values in the tree that are less than the value
+ *
+ * Uses the value_compare_function to determine the similarity of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ * The rank is also set if there is no such value
+ */
+int libcdata_btree_get_rank_of_value(
+     libcdata_btree_t *tree,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     int *rank,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	static char *function                    = "libcdata_btree_get_rank_of_value";
+	int result                               = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_btree_node_get_rank_of_value(
+	          internal_tree->root_node,
+	          value,
+	          value_compare_function,
+	          rank,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve rank of value.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Splits a node and its parent nodes until the number of values
+ * of every node no longer exceeds the maximum
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_btree_split_node(
+     libcdata_internal_btree_t *internal_tree,
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *parent_node         = NULL;
+	libcdata_tree_node_t *split_node          = NULL;
+	static char *function                     = "libcdata_internal_btree_split_node";
+
+	if( internal_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	split_node = node;
+
+	while( split_node != NULL )
+	{
+		if( libcdata_btree_node_get_node_values(
+		     split_node,
+		     &node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve split node values.",
+			 function );
+
+			return( -1 );
+		}
+		if( node_values->number_of_values <= internal_tree->maximum_number_of_values )
+		{
+			break;
+		}
+		if( libcdata_tree_node_get_parent_node(
+		     split_node,
+		     &parent_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent node of split node.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_btree_node_split(
+		     split_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to split node.",
+			 function );
+
+			return( -1 );
+		}
+		split_node = parent_node;
+	}
+	return( 1 );
+}
+
+/* Appends a value to the values array and adds it to the Bloom filter
+ * The entry of a previously removed value is reused if available
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_btree_append_value(
+     libcdata_internal_btree_t *internal_tree,
+     int *value_index,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_internal_btree_append_value";
+	int free_value_index  = 0;
+
+	if( internal_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_internal_btree_add_value_to_bloom_filter(
+	     internal_tree,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add value to Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_tree->number_of_free_value_indexes > 0 )
+	{
+		free_value_index = internal_tree->free_value_indexes[ internal_tree->number_of_free_value_indexes - 1 ];
+
+		if( libcdata_array_set_entry_by_index(
+		     internal_tree->values_array,
+		     free_value_index,
+		     value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value: %d in values array.",
+			 function,
+			 free_value_index );
+
+			return( -1 );
+		}
+		internal_tree->number_of_free_value_indexes -= 1;
+
+		*value_index = free_value_index;
+	}
+	else if( libcdata_array_append_entry(
+	          internal_tree->values_array,
+	          value_index,
+	          value,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value to values array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Inserts a value into a tree
+ *
+ * Uses the value_compare_function to determine the order of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * The value index of a previously removed value is reused if available
+ *
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful, 0 if the value already exists or -1 on error
+ */
+int libcdata_internal_btree_insert_value(
+     libcdata_internal_btree_t *internal_tree,
+     int *value_index,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **upper_node,
+     intptr_t **existing_value,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_internal_btree_insert_value";
+	int existing_value_index                  = 0;
+	int result                                = 0;
+
+	if( internal_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( upper_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upper node.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( existing_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid existing value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdata_internal_btree_get_upper_node_by_value(
+	          internal_tree,
+	          value,
+	          value_compare_function,
+	          &( internal_tree->last_upper_node ),
+	          upper_node,
+	          &existing_value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve upper node in root node.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_btree_node_get_value_by_index(
+		     *upper_node,
+		     existing_value_index,
+		     existing_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from upper node.",
+			 function,
+			 existing_value_index );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+	*existing_value = NULL;
+
+	if( libcdata_btree_node_insert_value(
+	     *upper_node,
+	     value,
+	     value_compare_function,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert value in upper node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     *upper_node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve upper node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_values->number_of_values > internal_tree->maximum_number_of_values )
+	{
+		if( libcdata_internal_btree_split_node(
+		     internal_tree,
+		     *upper_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to split upper node.",
+			 function );
+
+			return( -1 );
+		}
+		/* Make sure the upper node is updated after the split
+		 */
+		result = libcdata_internal_btree_get_upper_node_by_value(
+		          internal_tree,
+		          value,
+		          value_compare_function,
+		          &( internal_tree->last_upper_node ),
+		          upper_node,
+		          &existing_value_index,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve split sub node by value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_internal_btree_append_value(
+	     internal_tree,
+	     value_index,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value to values array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Inserts a value into a tree
+ *
+ * Uses the value_compare_function to determine the order of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * The value index of a previously removed value is reused if available
+ *
+ * Returns 1 if successful, 0 if the value already exists or -1 on error
+ */
+int libcdata_btree_insert_value(
+     libcdata_btree_t *tree,
+     int *value_index,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **upper_node,
+     intptr_t **existing_value,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	static char *function                    = "libcdata_btree_insert_value";
+	int result                               = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_internal_btree_insert_value(
+	          internal_tree,
+	          value_index,
+	          value,
+	          value_compare_function,
+	          upper_node,
+	          existing_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert value.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Inserts values into a tree
+ * The values are inserted in sorted order under a single lock, so that successive
+ * values can share the upper node of the previous insert instead of descending from
+ * the root node for every value
+ *
+ * Uses the value_compare_function to determine the order of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * The value indexes must contain number of values entries, the value index
+ * of a value that already exists is set to -1
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_insert_values(
+     libcdata_btree_t *tree,
+     intptr_t **values,
+     int number_of_values,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     int *value_indexes,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	libcdata_tree_node_t *upper_node         = NULL;
+	intptr_t *existing_value                 = NULL;
+	int *sorted_indexes                      = NULL;
+	static char *function                    = "libcdata_btree_insert_values";
+	int result                               = 0;
+	int sorted_index                         = 0;
+	int value_index                          = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+	if( ( number_of_values < 0 )
+	 || ( (size_t) number_of_values > (size_t) ( SSIZE_MAX / sizeof( int ) ) ) )
+#else
+	if( ( number_of_values < 0 )
+	 || ( number_of_values > (int) ( SSIZE_MAX / sizeof( int ) ) ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == 0 )
+	{
+		return( 1 );
+	}
+	/* The values are sorted before the lock is grabbed
+	 */
+	sorted_indexes = (int *) memory_allocate(
+	                          sizeof( int ) * number_of_values );
+
+	if( sorted_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted indexes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_internal_btree_sort_value_indexes(
+	     values,
+	     number_of_values,
+	     value_compare_function,
+	     sorted_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to sort values.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	for( sorted_index = 0;
+	     sorted_index < number_of_values;
+	     sorted_index++ )
+	{
+		value_index = sorted_indexes[ sorted_index ];
+
+		result = libcdata_internal_btree_insert_value(
+		          internal_tree,
+		          &( value_indexes[ value_index ] ),
+		          values[ value_index ],
+		          value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert value: %d.",
+			 function,
+			 value_index );
+
+			break;
+		}
+		else if( result == 0 )
+		{
+			value_indexes[ value_index ] = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	memory_free(
+	 sorted_indexes );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( sorted_indexes != NULL )
+	{
+		memory_free(
+		 sorted_indexes );
+	}
+	return( -1 );
+}
+
+/* Inserts a value into a tree indexed by key
+ * The values in the tree are ordered by their 64-bit key instead of a value compare function
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful, 0 if a value with the same key already exists or -1 on error
+ */
+int libcdata_internal_btree_insert_value_by_key(
+     libcdata_internal_btree_t *internal_tree,
+     uint64_t key,
+     int *value_index,
+     intptr_t *value,
+     libcdata_tree_node_t **upper_node,
+     intptr_t **existing_value,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_internal_btree_insert_value_by_key";
+	int existing_value_index                  = 0;
+	int result                                = 0;
+
+	if( internal_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( upper_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upper node.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( existing_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid existing value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdata_internal_btree_get_upper_node_by_key(
+	          internal_tree,
+	          key,
+	          &( internal_tree->last_upper_node ),
+	          upper_node,
+	          &existing_value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve upper node in root node.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_btree_node_get_value_by_index(
+		     *upper_node,
+		     existing_value_index,
+		     existing_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from upper node.",
+			 function,
+			 existing_value_index );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+	*existing_value = NULL;
+
+	if( libcdata_btree_node_insert_value_by_key(
+	     *upper_node,
+	     key,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert value in upper node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     *upper_node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve upper node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_values->number_of_values > internal_tree->maximum_number_of_values )
+	{
+		if( libcdata_internal_btree_split_node(
+		     internal_tree,
+		     *upper_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to split upper node.",
+			 function );
+
+			return( -1 );
+		}
+		/* Make sure the upper node is updated after the split
+		 */
+		result = libcdata_internal_btree_get_upper_node_by_key(
+		          internal_tree,
+		          key,
+		          &( internal_tree->last_upper_node ),
+		          upper_node,
+		          &existing_value_index,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve split sub node by key.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_internal_btree_append_value(
+	     internal_tree,
+	     value_index,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value to values array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Inserts a value into a tree indexed by key
+ * The values in the tree are ordered by their 64-bit key instead of a value compare function,
+ * which avoids calling a compare function for every value that is visited
+ * A tree should either be indexed by key or by value compare function, not both
+ *
+ * The value index of a previously removed value is reused if available
+ *
+ * Returns 1 if successful, 0 if a value with the same key already exists or -1 on error
+ */
+int libcdata_btree_insert_value_by_key(
+     libcdata_btree_t *tree,
+     uint64_t key,
+     int *value_index,
+     intptr_t *value,
+     libcdata_tree_node_t **upper_node,
+     intptr_t **existing_value,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	static char *function                    = "libcdata_btree_insert_value_by_key";
+	int result                               = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_internal_btree_insert_value_by_key(
+	          internal_tree,
+	          key,
+	          value_index,
+	          value,
+	          upper_node,
+	          existing_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert value.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Replaces a value in the tree
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_btree_replace_value(
+     libcdata_internal_btree_t *internal_tree,
+     libcdata_tree_node_t *upper_node,
+     int *value_index,
+     intptr_t *value,
+     int *replacement_value_index,
+     intptr_t *replacement_value,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	intptr_t *check_value                     = NULL;
+	static char *function                     = "libcdata_internal_btree_replace_value";
+	uint64_t replacement_key                  = 0;
+	int number_of_sub_nodes                   = 0;
+	int upper_value_index                     = 0;
+
+	if( internal_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( upper_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upper node.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( replacement_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     upper_node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: cannot replace upper node with sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_tree->values_array,
+	     *value_index,
+	     &check_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from array.",
+		 function,
+		 *value_index );
+
+		return( -1 );
+	}
+	if( value != check_value )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value: %d value out of bounds.",
+		 function,
+		 *value_index );
+
+		return( -1 );
+	}
+	/* The replacement value is expected to have the same key as the value
+	 */
+	if( libcdata_btree_node_get_sub_node_by_value(
+	     upper_node,
+	     value,
+	     NULL,
+	     &sub_node,
+	     &upper_value_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from upper node.",
+		 function,
+		 *value_index );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     upper_node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve upper node values.",
+		 function );
+
+		return( -1 );
+	}
+	replacement_key = node_values->keys[ upper_value_index ];
+
+	if( libcdata_internal_btree_add_value_to_bloom_filter(
+	     internal_tree,
+	     replacement_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add replacement value to Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( libcdata_btree_node_replace_value(
+	     upper_node,
+	     value,
+	     replacement_value,
+	     replacement_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to replace value: %d.",
+		 function,
+		 *value_index );
+
+		return( -1 );
+	}
+	if( libcdata_array_set_entry_by_index(
+	     internal_tree->values_array,
+	     *value_index,
+	     replacement_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to set value: %d in values array.",
+		 function,
+		 *value_index );
+
+		return( -1 );
+	}
+	*replacement_value_index = *value_index;
+	*value_index             = -1;
+
+	return( 1 );
+}
+
+/* Replaces a value in the tree
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_replace_value(
+     libcdata_btree_t *tree,
+     libcdata_tree_node_t *upper_node,
+     int *value_index,
+     intptr_t *value,
+     int *replacement_value_index,
+     intptr_t *replacement_value,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	static char *function                    = "libcdata_btree_replace_value";
+	int result                               = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_internal_btree_replace_value(
+	          internal_tree,
+	          upper_node,
+	          value_index,
+	          value,
+	          replacement_value_index,
+	          replacement_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to replace value.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes a value from the tree
+ * The nodes of the tree are rebalanced, hence the upper node can no longer be used afterwards
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_btree_remove_value(
+     libcdata_internal_btree_t *internal_tree,
+     libcdata_tree_node_t *upper_node,
+     int *value_index,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	intptr_t *check_value                      = NULL;
+	void *reallocation                         = NULL;
+	static char *function                      = "libcdata_internal_btree_remove_value";
+	int number_of_allocated_free_value_indexes = 0;
+	int number_of_sub_nodes                    = 0;
+	int number_of_values                       = 0;
+
+	if( internal_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( upper_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upper node.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_number_of_sub_nodes(
+	     upper_node,
+	     &number_of_sub_nodes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: cannot replace upper node with sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_tree->values_array,
+	     *value_index,
+	     &check_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from array.",
+		 function,
+		 *value_index );
+
+		return( -1 );
+	}
+	if( value != check_value )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value: %d value out of bounds.",
+		 function,
+		 *value_index );
+
+		return( -1 );
+	}
+	/* The nodes are rebalanced after the value is removed, which can free
+	 * the last upper node
+	 */
+	internal_tree->last_upper_node = NULL;
+
+	if( libcdata_btree_node_remove_value(
+	     upper_node,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove value: %d from upper node.",
+		 function,
+		 *value_index );
+
+		return( -1 );
+	}
+	/* The values array is not reshuffled since the index values of the other
+	 * values need to remain valid. The entry is cleared and if it is the last
+	 * entry the values array is shrunk, otherwise its index is stored so that
+	 * the entry can be reused by a next insert
+	 */
+	if( libcdata_array_get_number_of_entries(
+	     internal_tree->values_array,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values array entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *value_index < ( number_of_values - 1 ) )
+	 && ( internal_tree->number_of_free_value_indexes >= internal_tree->number_of_allocated_free_value_indexes ) )
+	{
+		number_of_allocated_free_value_indexes = ( internal_tree->number_of_free_value_indexes & ~( 15 ) ) + 16;
+
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+		if( (size_t) number_of_allocated_free_value_indexes > (size_t) ( SSIZE_MAX / sizeof( int ) ) )
+#else
+		if( number_of_allocated_free_value_indexes > (int) ( SSIZE_MAX / sizeof( int ) ) )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated free value indexes value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                internal_tree->free_value_indexes,
+		                sizeof( int ) * number_of_allocated_free_value_indexes );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize free value indexes.",
+			 function );
+
+			return( -1 );
+		}
+		internal_tree->free_value_indexes                     = (int *) reallocation;
+		internal_tree->number_of_allocated_free_value_indexes = number_of_allocated_free_value_indexes;
+	}
+	if( libcdata_array_set_entry_by_index(
+	     internal_tree->values_array,
+	     *value_index,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value: %d in values array.",
+		 function,
+		 *value_index );
+
+		return( -1 );
+	}
+	if( *value_index == ( number_of_values - 1 ) )
+	{
+		if( libcdata_array_resize(
+		     internal_tree->values_array,
+		     *value_index,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize values array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		internal_tree->free_value_indexes[ internal_tree->number_of_free_value_indexes ] = *value_index;
+
+		internal_tree->number_of_free_value_indexes += 1;
+	}
+	*value_index = -1;
+
+	return( 1 );
+}
+
+/* Removes a value from the tree
+ * The nodes of the tree are rebalanced, hence the upper node can no longer be used afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_remove_value(
+     libcdata_btree_t *tree,
+     libcdata_tree_node_t *upper_node,
+     int *value_index,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	static char *function                    = "libcdata_btree_remove_value";
+	int result                               = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_internal_btree_remove_value(
+	          internal_tree,
+	          upper_node,
+	          value_index,
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove value.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+
+/* Builds the tree from an array of sorted values
+ * The tree must be empty and the values in the array must be sorted and unique
+ *
+ * The nodes are built bottom-up, starting with the leaf nodes, where the fill factor
+ * is the percentage of the maximum number of values that is stored in every node.
+ * Every node contains at least half the maximum number of values, hence a fill factor
+ * smaller than 50 percent has the same effect as 50 percent
+ *
+ * The values are stored in the values array of the tree in order of the array
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_btree_build_from_sorted_array(
+     libcdata_internal_btree_t *internal_tree,
+     libcdata_array_t *array,
+     int fill_factor,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t **nodes              = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	intptr_t **last_values                    = NULL;
+	intptr_t *value                           = NULL;
+	static char *function                     = "libcdata_internal_btree_build_from_sorted_array";
+	size_t nodes_size                         = 0;
+	int group_index                           = 0;
+	int group_size                            = 0;
+	int maximum_number_of_nodes               = 0;
+	int minimum_group_size                    = 0;
+	int node_index                            = 0;
+	int number_of_groups                      = 0;
+	int number_of_nodes                       = 0;
+	int number_of_tree_values                 = 0;
+	int number_of_values                      = 0;
+	int number_of_values_per_node             = 0;
+	int sub_node_index                        = 0;
+	int value_index                           = 0;
+
+	if( internal_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( ( fill_factor <= 0 )
+	 || ( fill_factor > 100 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid fill factor value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     array,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of array entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     internal_tree->root_node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_values->number_of_values != 0 )
+	 || ( node_values->number_of_sub_nodes != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid tree - tree is not empty.",
+		 function );
+
+		return( -1 );
+	}
+	/* The values array of an empty tree can still contain the entries
+	 * of removed values, which are cleared
+	 */
+	if( libcdata_array_resize(
+	     internal_tree->values_array,
+	     0,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize values array.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree->number_of_free_value_indexes = 0;
+	internal_tree->last_upper_node              = NULL;
+
+	if( internal_tree->bloom_filter != NULL )
+	{
+		if( libcdata_bloom_filter_empty(
+		     internal_tree->bloom_filter,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty Bloom filter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( number_of_values == 0 )
+	{
+		return( 1 );
+	}
+	number_of_values_per_node = ( internal_tree->maximum_number_of_values * fill_factor ) / 100;
+
+	if( number_of_values_per_node < ( internal_tree->maximum_number_of_values / 2 ) )
+	{
+		number_of_values_per_node = internal_tree->maximum_number_of_values / 2;
+	}
+	maximum_number_of_nodes = ( number_of_values / number_of_values_per_node ) + 1;
+
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+	if( (size_t) maximum_number_of_nodes > (size_t) ( SSIZE_MAX / sizeof( libcdata_tree_node_t * ) ) )
+#else
+	if( maximum_number_of_nodes > (int) ( SSIZE_MAX / sizeof( libcdata_tree_node_t * ) ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of nodes value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	nodes_size = sizeof( libcdata_tree_node_t * ) * maximum_number_of_nodes;
+
+	nodes = (libcdata_tree_node_t **) memory_allocate(
+	                                   nodes_size );
+
+	if( nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create nodes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     nodes,
+	     0,
+	     nodes_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear nodes.",
+		 function );
+
+		goto on_error;
+	}
+	last_values = (intptr_t **) memory_allocate(
+	                             sizeof( intptr_t * ) * maximum_number_of_nodes );
+
+	if( last_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create last values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_resize(
+	     internal_tree->values_array,
+	     number_of_values,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize values array.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_tree_values = number_of_values;
+
+	/* The leaf nodes contain the values. The values are distributed evenly over
+	 * the nodes so that no node contains less than half the maximum number of values
+	 */
+	group_size         = number_of_values_per_node;
+	minimum_group_size = internal_tree->maximum_number_of_values / 2;
+	number_of_groups   = ( number_of_values + group_size - 1 ) / group_size;
+
+	if( ( number_of_groups > 1 )
+	 && ( ( number_of_values / number_of_groups ) < minimum_group_size ) )
+	{
+		number_of_groups = number_of_values / minimum_group_size;
+	}
+	for( group_index = 0;
+	     group_index < number_of_groups;
+	     group_index++ )
+	{
+		group_size = number_of_values / number_of_groups;
+
+		if( group_index < ( number_of_values % number_of_groups ) )
+		{
+			group_size += 1;
+		}
+		if( libcdata_btree_node_initialize(
+		     &node,
+		     internal_tree->maximum_number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create leaf node: %d.",
+			 function,
+			 group_index );
+
+			goto on_error;
+		}
+		while( group_size > 0 )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     array,
+			     value_index,
+			     &value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve array entry: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			if( value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing array entry: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			if( libcdata_btree_node_append_value(
+			     node,
+			     value,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value: %d to leaf node: %d.",
+				 function,
+				 value_index,
+				 group_index );
+
+				goto on_error;
+			}
+			if( libcdata_array_set_entry_by_index(
+			     internal_tree->values_array,
+			     value_index,
+			     value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set value: %d in values array.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			if( libcdata_internal_btree_add_value_to_bloom_filter(
+			     internal_tree,
+			     value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add value: %d to Bloom filter.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			value_index++;
+			group_size--;
+		}
+		if( libcdata_btree_node_update_number_of_leaf_values(
+		     node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update number of leaf values of leaf node: %d.",
+			 function,
+			 group_index );
+
+			goto on_error;
+		}
+		nodes[ group_index ]       = node;
+		last_values[ group_index ] = value;
+
+		node = NULL;
+	}
+	number_of_nodes = number_of_groups;
+
+	/* The branch nodes are built level by level until a single node remains.
+	 * The separator value of a sub node is the last value in the sub node.
+	 * The nodes of the next level are stored in the same arrays since a node
+	 * is always stored before its sub nodes that still need to be processed
+	 */
+	minimum_group_size = ( internal_tree->maximum_number_of_values / 2 ) + 1;
+
+	while( number_of_nodes > 1 )
+	{
+		group_size       = number_of_values_per_node + 1;
+		number_of_groups = ( number_of_nodes + group_size - 1 ) / group_size;
+
+		if( ( number_of_groups > 1 )
+		 && ( ( number_of_nodes / number_of_groups ) < minimum_group_size ) )
+		{
+			number_of_groups = number_of_nodes / minimum_group_size;
+		}
+		node_index = 0;
+
+		for( group_index = 0;
+		     group_index < number_of_groups;
+		     group_index++ )
+		{
+			group_size = number_of_nodes / number_of_groups;
+
+			if( group_index < ( number_of_nodes % number_of_groups ) )
+			{
+				group_size += 1;
+			}
+			if( libcdata_btree_node_initialize(
+			     &node,
+			     internal_tree->maximum_number_of_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create branch node: %d.",
+				 function,
+				 group_index );
+
+				goto on_error;
+			}
+			for( sub_node_index = 0;
+			     sub_node_index < group_size;
+			     sub_node_index++ )
+			{
+				if( sub_node_index > 0 )
+				{
+					if( libcdata_btree_node_append_value(
+					     node,
+					     last_values[ node_index - 1 ],
+					     0,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append separator value to branch node: %d.",
+						 function,
+						 group_index );
+
+						goto on_error;
+					}
+				}
+				if( libcdata_btree_node_append_sub_node(
+				     node,
+				     nodes[ node_index ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append sub node to branch node: %d.",
+					 function,
+					 group_index );
+
+					goto on_error;
+				}
+				nodes[ node_index ] = NULL;
+
+				node_index++;
+			}
+			if( libcdata_btree_node_update_number_of_leaf_values(
+			     node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update number of leaf values of branch node: %d.",
+				 function,
+				 group_index );
+
+				goto on_error;
+			}
+			nodes[ group_index ]       = node;
+			last_values[ group_index ] = last_values[ node_index - 1 ];
+
+			node = NULL;
+		}
+		number_of_nodes = number_of_groups;
+	}
+	/* The root node of the tree is not replaced, instead the remaining node
+	 * is appended to the root node and flattened into it
+	 */
+	if( libcdata_btree_node_append_sub_node(
+	     internal_tree->root_node,
+	     nodes[ 0 ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append sub node to root node.",
+		 function );
+
+		goto on_error;
+	}
+	nodes[ 0 ] = NULL;
+
+	if( libcdata_btree_node_flatten_node(
+	     internal_tree->root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flatten root node.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 last_values );
+
+	memory_free(
+	 nodes );
+
+	return( 1 );
+
+on_error:
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	if( nodes != NULL )
+	{
+		for( node_index = 0;
+		     node_index < maximum_number_of_nodes;
+		     node_index++ )
+		{
+			if( nodes[ node_index ] != NULL )
+			{
+				libcdata_btree_node_free(
+				 &( nodes[ node_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 nodes );
+	}
+	if( last_values != NULL )
+	{
+		memory_free(
+		 last_values );
+	}
+	/* The values are owned by the caller, hence the values array is emptied
+	 * without freeing the values
+	 */
+	for( value_index = 0;
+	     value_index < number_of_tree_values;
+	     value_index++ )
+	{
+		libcdata_array_set_entry_by_index(
+		 internal_tree->values_array,
+		 value_index,
+		 NULL,
+		 NULL );
+	}
+	if( number_of_tree_values > 0 )
+	{
+		libcdata_array_resize(
+		 internal_tree->values_array,
+		 0,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the tree from an array of sorted values
+ * The tree must be empty and the values in the array must be sorted and unique
+ *
+ * The nodes are built bottom-up, starting with the leaf nodes, where the fill factor
+ * is the percentage of the maximum number of values that is stored in every node.
+ * Every node contains at least half the maximum number of values, hence a fill factor
+ * smaller than 50 percent has the same effect as 50 percent
+ *
+ * The values are stored in the values array of the tree in order of the array
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_build_from_sorted_array(
+     libcdata_btree_t *tree,
+     libcdata_array_t *array,
+     int fill_factor,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	static char *function                    = "libcdata_btree_build_from_sorted_array";
+	int result                               = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_internal_btree_build_from_sorted_array(
+	          internal_tree,
+	          array,
+	          fill_factor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build tree from sorted array.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_number_of_sub_nodes(
-	     upper_node,
-	     &number_of_sub_nodes,
+#endif
+	return( result );
+}
+
+/* Adds a value to the Bloom filter of the tree
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_btree_add_value_to_bloom_filter(
+     libcdata_internal_btree_t *internal_tree,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_internal_btree_add_value_to_bloom_filter";
+	uint64_t hash         = 0;
+
+	if( internal_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_tree->bloom_filter == NULL )
+	{
+		return( 1 );
+	}
+	if( internal_tree->value_hash_function(
+	     value,
+	     &hash,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub nodes.",
+		 "%s: unable to retrieve hash of value.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_sub_nodes != 0 )
+	if( libcdata_bloom_filter_add_hash(
+	     internal_tree->bloom_filter,
+	     hash,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: cannot replace upper node with sub nodes.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add hash to Bloom filter.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
+	return( 1 );
+}
+
+/* Rebuilds the Bloom filter of the tree from the values in the tree
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_btree_rebuild_bloom_filter(
+     libcdata_internal_btree_t *internal_tree,
+     libcerror_error_t **error )
+{
+	intptr_t *value       = NULL;
+	static char *function = "libcdata_internal_btree_rebuild_bloom_filter";
+	int number_of_values  = 0;
+	int value_index       = 0;
+
+	if( internal_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_tree->bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid tree - missing Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_bloom_filter_empty(
+	     internal_tree->bloom_filter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty Bloom filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
 	     internal_tree->values_array,
-	     *value_index,
-	     &check_value,
+	     &number_of_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d from array.",
-		 function,
-		 *value_index );
+		 "%s: unable to retrieve number of values array entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_tree->values_array,
+		     value_index,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from values array.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		/* The entries of removed values are NULL
+		 */
+		if( value == NULL )
+		{
+			continue;
+		}
+		if( libcdata_internal_btree_add_value_to_bloom_filter(
+		     internal_tree,
+		     value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add value: %d to Bloom filter.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	/* A Bloom filter that does not contain all the values in the tree cannot be used
+	 */
+	libcdata_bloom_filter_free(
+	 &( internal_tree->bloom_filter ),
+	 NULL );
+
+	internal_tree->value_hash_function = NULL;
+
+	return( -1 );
+}
+
+/* Sets the Bloom filter of the tree
+ *
+ * The Bloom filter is used to determine that a value is not in the tree without
+ * a lookup. It is sized for the number of values, where approximately 1 in false
+ * positive rate lookups of values that are not in the tree requires a lookup.
+ * The values in the tree are added to the Bloom filter
+ *
+ * Uses the value_hash_function to determine the 64-bit hash of a value, where
+ * values that are equal according to the value compare function must have the same hash
+ * The value_hash_function should return 1 if successful or -1 on error
+ * If the value_hash_function is NULL the Bloom filter is removed
+ *
+ * Removed values are not removed from the Bloom filter, which increases
+ * the false positive rate until the Bloom filter is rebuilt
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_set_bloom_filter(
+     libcdata_btree_t *tree,
+     int number_of_values,
+     int false_positive_rate,
+     int (*value_hash_function)(
+            intptr_t *value,
+            uint64_t *hash,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libcdata_bloom_filter_t *bloom_filter    = NULL;
+	libcdata_internal_btree_t *internal_tree = NULL;
+	static char *function                    = "libcdata_btree_set_bloom_filter";
+	int result                               = 1;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
 
 		return( -1 );
 	}
-	if( value != check_value )
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+	if( value_hash_function != NULL )
+	{
+		if( libcdata_bloom_filter_initialize(
+		     &bloom_filter,
+		     number_of_values,
+		     false_positive_rate,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create Bloom filter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid value: %d value out of bounds.",
-		 function,
-		 *value_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		libcdata_bloom_filter_free(
+		 &bloom_filter,
+		 NULL );
 
 		return( -1 );
 	}
-	if( libcdata_btree_node_remove_value(
-	     upper_node,
-	     value,
-	     NULL,
+#endif
+	if( internal_tree->bloom_filter != NULL )
+	{
+		if( libcdata_bloom_filter_free(
+		     &( internal_tree->bloom_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Bloom filter.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		libcdata_bloom_filter_free(
+		 &bloom_filter,
+		 NULL );
+	}
+	else
+	{
+		internal_tree->bloom_filter        = bloom_filter;
+		internal_tree->value_hash_function = value_hash_function;
+
+		if( internal_tree->bloom_filter != NULL )
+		{
+			result = libcdata_internal_btree_rebuild_bloom_filter(
+			          internal_tree,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to rebuild Bloom filter.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_tree->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-		 "%s: unable to remove value: %d from upper node.",
-		 function,
-		 *value_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
-/* TODO reshuffle values array ?
- * Better to mark and ignore deleted items, otherwise index values need to be updated as well
+#endif
+	return( result );
+}
+
+/* Rebuilds the Bloom filter of the tree from the values in the tree
+ * This clears the bits of removed values that increase the false positive rate
+ * On error the Bloom filter is removed
+ * Returns 1 if successful or -1 on error
  */
-	if( libcdata_array_set_entry_by_index(
-	     internal_tree->values_array,
-	     *value_index,
-	     NULL,
+int libcdata_btree_rebuild_bloom_filter(
+     libcdata_btree_t *tree,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_t *internal_tree = NULL;
+	static char *function                    = "libcdata_btree_rebuild_bloom_filter";
+	int result                               = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree = (libcdata_internal_btree_t *) tree;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_tree->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to set value: %d in values array.",
-		 function,
-		 *value_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
-	*value_index = -1;
+#endif
+	result = libcdata_internal_btree_rebuild_bloom_filter(
+	          internal_tree,
+	          error );
 
-	return( 1 );
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to rebuild Bloom filter.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
 }
 
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libcdata_bloom_filter.h"
 #include "libcdata_extern.h"
 #include "libcdata_libcerror.h"
 #include "libcdata_libcthreads.h"
@@ -34,8 +35,9 @@
 extern "C" {
 #endif
 
-/* The balanced tree uses the list and tree node
- * The value of a tree node contains a list where each value in the list corresponds with either a sub node or a leaf value
+/* The balanced tree uses the tree node
+ * The value of a tree node contains the node values, which are contiguous arrays of the values
+ * and the sub nodes of the node, where each value corresponds with either a sub node or a leaf value
  * The values array is used for sequential access to the leaf values
  */
 typedef struct libcdata_internal_btree libcdata_internal_btree_t;
@@ -50,10 +52,43 @@ struct libcdata_internal_btree
 	 */
 	libcdata_tree_node_t *root_node;
 
+	/* The upper node of the last lookup, which is used as a finger
+	 * to skip the descent from the root node for successive lookups
+	 * of values that fall within the range of its values
+	 * It is only updated while the write lock is held, lookups under
+	 * the read lock use a copy
+	 */
+	libcdata_tree_node_t *last_upper_node;
+
+	/* The indexes of the free entries in the values array
+	 * that are reused when a value is inserted
+	 */
+	int *free_value_indexes;
+
+	/* The number of free value indexes
+	 */
+	int number_of_free_value_indexes;
+
+	/* The number of allocated free value indexes
+	 */
+	int number_of_allocated_free_value_indexes;
+
 	/* The maximum number of values
 	 */
 	int maximum_number_of_values;
 
+	/* The Bloom filter, which is used to determine that a value is not
+	 * in the tree without a lookup
+	 */
+	libcdata_bloom_filter_t *bloom_filter;
+
+	/* The value hash function of the Bloom filter
+	 */
+	int (*value_hash_function)(
+	       intptr_t *value,
+	       uint64_t *hash,
+	       libcerror_error_t **error );
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 	/* The read/write lock
 	 */
@@ -75,7 +110,32 @@ int libcdata_btree_free(
             libcerror_error_t **error ),
      libcerror_error_t **error );
 
-/* TODO clone function */
+int libcdata_internal_btree_compare_value_addresses(
+     intptr_t *first_value,
+     intptr_t *second_value,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_clone_node(
+     libcdata_tree_node_t *destination_node,
+     libcdata_tree_node_t *source_node,
+     intptr_t **source_values,
+     int *sorted_indexes,
+     int number_of_values,
+     libcdata_array_t *destination_values_array,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_clone(
+     libcdata_btree_t **destination_tree,
+     libcdata_btree_t *source_tree,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     int (*value_clone_function)(
+            intptr_t **destination_value,
+            intptr_t *source_value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
 
 LIBCDATA_EXTERN \
 int libcdata_btree_get_number_of_values(
@@ -83,6 +143,14 @@ int libcdata_btree_get_number_of_values(
      int *number_of_values,
      libcerror_error_t **error );
 
+LIBCDATA_EXTERN \
+int libcdata_btree_get_statistics(
+     libcdata_btree_t *tree,
+     int *height,
+     int *number_of_nodes,
+     int *number_of_leaf_nodes,
+     libcerror_error_t **error );
+
 LIBCDATA_EXTERN \
 int libcdata_btree_get_value_by_index(
      libcdata_btree_t *tree,
@@ -90,6 +158,38 @@ int libcdata_btree_get_value_by_index(
      intptr_t **value,
      libcerror_error_t **error );
 
+int libcdata_internal_btree_get_upper_node_by_value(
+     libcdata_internal_btree_t *internal_tree,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **last_upper_node,
+     libcdata_tree_node_t **upper_node,
+     int *value_index,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_get_upper_node_by_key(
+     libcdata_internal_btree_t *internal_tree,
+     uint64_t key,
+     libcdata_tree_node_t **last_upper_node,
+     libcdata_tree_node_t **upper_node,
+     int *value_index,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_get_value_by_value(
+     libcdata_internal_btree_t *internal_tree,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **last_upper_node,
+     libcdata_tree_node_t **upper_node,
+     intptr_t **existing_value,
+     libcerror_error_t **error );
+
 LIBCDATA_EXTERN \
 int libcdata_btree_get_value_by_value(
      libcdata_btree_t *tree,
@@ -102,6 +202,77 @@ int libcdata_btree_get_value_by_value(
      intptr_t **existing_value,
      libcerror_error_t **error );
 
+int libcdata_internal_btree_sort_value_indexes(
+     intptr_t **values,
+     int number_of_values,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     int *sorted_indexes,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_get_values_by_values(
+     libcdata_btree_t *tree,
+     intptr_t **values,
+     int number_of_values,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     intptr_t **existing_values,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_get_value_by_key(
+     libcdata_btree_t *tree,
+     uint64_t key,
+     libcdata_tree_node_t **upper_node,
+     intptr_t **existing_value,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_get_value_by_rank(
+     libcdata_btree_t *tree,
+     int rank,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_get_rank_of_value(
+     libcdata_btree_t *tree,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     int *rank,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_split_node(
+     libcdata_internal_btree_t *internal_tree,
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_append_value(
+     libcdata_internal_btree_t *internal_tree,
+     int *value_index,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_insert_value(
+     libcdata_internal_btree_t *internal_tree,
+     int *value_index,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **upper_node,
+     intptr_t **existing_value,
+     libcerror_error_t **error );
+
 LIBCDATA_EXTERN \
 int libcdata_btree_insert_value(
      libcdata_btree_t *tree,
@@ -115,6 +286,46 @@ int libcdata_btree_insert_value(
      intptr_t **existing_value,
      libcerror_error_t **error );
 
+LIBCDATA_EXTERN \
+int libcdata_btree_insert_values(
+     libcdata_btree_t *tree,
+     intptr_t **values,
+     int number_of_values,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     int *value_indexes,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_insert_value_by_key(
+     libcdata_internal_btree_t *internal_tree,
+     uint64_t key,
+     int *value_index,
+     intptr_t *value,
+     libcdata_tree_node_t **upper_node,
+     intptr_t **existing_value,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_insert_value_by_key(
+     libcdata_btree_t *tree,
+     uint64_t key,
+     int *value_index,
+     intptr_t *value,
+     libcdata_tree_node_t **upper_node,
+     intptr_t **existing_value,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_replace_value(
+     libcdata_internal_btree_t *internal_tree,
+     libcdata_tree_node_t *upper_node,
+     int *value_index,
+     intptr_t *value,
+     int *replacement_value_index,
+     intptr_t *replacement_value,
+     libcerror_error_t **error );
+
 LIBCDATA_EXTERN \
 int libcdata_btree_replace_value(
      libcdata_btree_t *tree,
@@ -125,6 +336,13 @@ int libcdata_btree_replace_value(
      intptr_t *replacement_value,
      libcerror_error_t **error );
 
+int libcdata_internal_btree_remove_value(
+     libcdata_internal_btree_t *internal_tree,
+     libcdata_tree_node_t *upper_node,
+     int *value_index,
+     intptr_t *value,
+     libcerror_error_t **error );
+
 LIBCDATA_EXTERN \
 int libcdata_btree_remove_value(
      libcdata_btree_t *tree,
@@ -133,6 +351,44 @@ int libcdata_btree_remove_value(
      intptr_t *value,
      libcerror_error_t **error );
 
+int libcdata_internal_btree_build_from_sorted_array(
+     libcdata_internal_btree_t *internal_tree,
+     libcdata_array_t *array,
+     int fill_factor,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_build_from_sorted_array(
+     libcdata_btree_t *tree,
+     libcdata_array_t *array,
+     int fill_factor,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_add_value_to_bloom_filter(
+     libcdata_internal_btree_t *internal_tree,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_rebuild_bloom_filter(
+     libcdata_internal_btree_t *internal_tree,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_set_bloom_filter(
+     libcdata_btree_t *tree,
+     int number_of_values,
+     int false_positive_rate,
+     int (*value_hash_function)(
+            intptr_t *value,
+            uint64_t *hash,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_rebuild_bloom_filter(
+     libcdata_btree_t *tree,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
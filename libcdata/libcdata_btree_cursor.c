@@ -0,0 +1,930 @@
+/*
+ * Balanced tree cursor functions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdata_btree.h"
+#include "libcdata_btree_cursor.h"
+#include "libcdata_btree_node.h"
+#include "libcdata_btree_node_values.h"
+#include "libcdata_libcerror.h"
+#include "libcdata_tree_node.h"
+#include "libcdata_types.h"
+
+/* Creates a tree cursor
+ * The cursor walks the values of the tree in order of the value compare function
+ * used to insert the values, without allocating memory while walking
+ * The cursor is no longer valid after values are inserted into or removed from the tree
+ * Make sure the value cursor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_cursor_initialize(
+     libcdata_btree_cursor_t **cursor,
+     libcdata_btree_t *tree,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_cursor_t *internal_cursor = NULL;
+	static char *function                             = "libcdata_btree_cursor_initialize";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = memory_allocate_structure(
+	                   libcdata_internal_btree_cursor_t );
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_cursor,
+	     0,
+	     sizeof( libcdata_internal_btree_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cursor.",
+		 function );
+
+		memory_free(
+		 internal_cursor );
+
+		return( -1 );
+	}
+	internal_cursor->tree        = tree;
+	internal_cursor->value_index = -1;
+
+	*cursor = (libcdata_btree_cursor_t *) internal_cursor;
+
+	return( 1 );
+}
+
+/* Frees a tree cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_cursor_free(
+     libcdata_btree_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_cursor_t *internal_cursor = NULL;
+	static char *function                             = "libcdata_btree_cursor_free";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		internal_cursor = (libcdata_internal_btree_cursor_t *) *cursor;
+		*cursor         = NULL;
+
+		memory_free(
+		 internal_cursor );
+	}
+	return( 1 );
+}
+
+/* Retrieves the first (most left) leaf node of a (sub) tree
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_btree_cursor_get_first_leaf_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **leaf_node,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_internal_btree_cursor_get_first_leaf_node";
+
+	if( leaf_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( libcdata_btree_node_get_node_values(
+		     node,
+		     &node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve node values.",
+			 function );
+
+			return( -1 );
+		}
+		if( node_values->number_of_sub_nodes == 0 )
+		{
+			break;
+		}
+		node = node_values->sub_nodes[ 0 ];
+	}
+	while( node != NULL );
+
+	*leaf_node = node;
+
+	return( 1 );
+}
+
+/* Retrieves the last (most right) leaf node of a (sub) tree
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_btree_cursor_get_last_leaf_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **leaf_node,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_internal_btree_cursor_get_last_leaf_node";
+
+	if( leaf_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( libcdata_btree_node_get_node_values(
+		     node,
+		     &node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve node values.",
+			 function );
+
+			return( -1 );
+		}
+		if( node_values->number_of_sub_nodes == 0 )
+		{
+			break;
+		}
+		node = node_values->sub_nodes[ node_values->number_of_sub_nodes - 1 ];
+	}
+	while( node != NULL );
+
+	*leaf_node = node;
+
+	return( 1 );
+}
+
+/* Retrieves the leaf node that follows a specific leaf node
+ * Returns 1 if successful, 0 if no such leaf node or -1 on error
+ */
+int libcdata_internal_btree_cursor_get_next_leaf_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **leaf_node,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *parent_node_values = NULL;
+	libcdata_tree_node_t *parent_node                = NULL;
+	static char *function                            = "libcdata_internal_btree_cursor_get_next_leaf_node";
+	int sub_node_index                               = 0;
+
+	if( leaf_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	*leaf_node = NULL;
+
+	/* Move up until a parent node has a next sub node and
+	 * determine the first leaf node of that sub node
+	 */
+	while( node != NULL )
+	{
+		if( libcdata_tree_node_get_parent_node(
+		     node,
+		     &parent_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent node.",
+			 function );
+
+			return( -1 );
+		}
+		if( parent_node == NULL )
+		{
+			break;
+		}
+		if( libcdata_btree_node_get_sub_node_index(
+		     parent_node,
+		     node,
+		     &sub_node_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node index of node in parent node.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_btree_node_get_node_values(
+		     parent_node,
+		     &parent_node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent node values.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( sub_node_index + 1 ) < parent_node_values->number_of_sub_nodes )
+		{
+			if( libcdata_internal_btree_cursor_get_first_leaf_node(
+			     parent_node_values->sub_nodes[ sub_node_index + 1 ],
+			     leaf_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve first leaf node of next sub node.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		node = parent_node;
+	}
+	return( 0 );
+}
+
+/* Retrieves the leaf node that precedes a specific leaf node
+ * Returns 1 if successful, 0 if no such leaf node or -1 on error
+ */
+int libcdata_internal_btree_cursor_get_previous_leaf_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **leaf_node,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *parent_node_values = NULL;
+	libcdata_tree_node_t *parent_node                = NULL;
+	static char *function                            = "libcdata_internal_btree_cursor_get_previous_leaf_node";
+	int sub_node_index                               = 0;
+
+	if( leaf_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	*leaf_node = NULL;
+
+	/* Move up until a parent node has a previous sub node and
+	 * determine the last leaf node of that sub node
+	 */
+	while( node != NULL )
+	{
+		if( libcdata_tree_node_get_parent_node(
+		     node,
+		     &parent_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent node.",
+			 function );
+
+			return( -1 );
+		}
+		if( parent_node == NULL )
+		{
+			break;
+		}
+		if( libcdata_btree_node_get_sub_node_index(
+		     parent_node,
+		     node,
+		     &sub_node_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node index of node in parent node.",
+			 function );
+
+			return( -1 );
+		}
+		if( sub_node_index > 0 )
+		{
+			if( libcdata_btree_node_get_node_values(
+			     parent_node,
+			     &parent_node_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve parent node values.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcdata_internal_btree_cursor_get_last_leaf_node(
+			     parent_node_values->sub_nodes[ sub_node_index - 1 ],
+			     leaf_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve last leaf node of previous sub node.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		node = parent_node;
+	}
+	return( 0 );
+}
+
+/* Moves the cursor to the first value of the tree
+ * Returns 1 if successful, 0 if the tree contains no values or -1 on error
+ */
+int libcdata_btree_cursor_seek_first(
+     libcdata_btree_cursor_t *cursor,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values         = NULL;
+	libcdata_internal_btree_cursor_t *internal_cursor = NULL;
+	libcdata_tree_node_t *leaf_node                   = NULL;
+	static char *function                             = "libcdata_btree_cursor_seek_first";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libcdata_internal_btree_cursor_t *) cursor;
+
+	internal_cursor->node        = NULL;
+	internal_cursor->value_index = -1;
+
+	if( libcdata_internal_btree_cursor_get_first_leaf_node(
+	     ( (libcdata_internal_btree_t *) internal_cursor->tree )->root_node,
+	     &leaf_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     leaf_node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_values->number_of_values == 0 )
+	{
+		return( 0 );
+	}
+	internal_cursor->node        = leaf_node;
+	internal_cursor->value_index = 0;
+
+	return( 1 );
+}
+
+/* Moves the cursor to the last value of the tree
+ * Returns 1 if successful, 0 if the tree contains no values or -1 on error
+ */
+int libcdata_btree_cursor_seek_last(
+     libcdata_btree_cursor_t *cursor,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values         = NULL;
+	libcdata_internal_btree_cursor_t *internal_cursor = NULL;
+	libcdata_tree_node_t *leaf_node                   = NULL;
+	static char *function                             = "libcdata_btree_cursor_seek_last";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libcdata_internal_btree_cursor_t *) cursor;
+
+	internal_cursor->node        = NULL;
+	internal_cursor->value_index = -1;
+
+	if( libcdata_internal_btree_cursor_get_last_leaf_node(
+	     ( (libcdata_internal_btree_t *) internal_cursor->tree )->root_node,
+	     &leaf_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     leaf_node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_values->number_of_values == 0 )
+	{
+		return( 0 );
+	}
+	internal_cursor->node        = leaf_node;
+	internal_cursor->value_index = node_values->number_of_values - 1;
+
+	return( 1 );
+}
+
+/* Moves the cursor to the first value that is equal to or greater than a specific value
+ *
+ * Uses the value_compare_function to determine the order of the values
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * Values in the range [low, high) can be retrieved by seeking the lower bound
+ * of low and moving to the next value until a value is equal to or greater than high
+ *
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libcdata_btree_cursor_seek_lower_bound(
+     libcdata_btree_cursor_t *cursor,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values         = NULL;
+	libcdata_internal_btree_cursor_t *internal_cursor = NULL;
+	libcdata_tree_node_t *leaf_node                   = NULL;
+	libcdata_tree_node_t *node                        = NULL;
+	static char *function                             = "libcdata_btree_cursor_seek_lower_bound";
+	int result                                        = 0;
+	int value_index                                   = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libcdata_internal_btree_cursor_t *) cursor;
+
+	internal_cursor->node        = NULL;
+	internal_cursor->value_index = -1;
+
+	/* The separator value of a sub node is the last value in the sub node,
+	 * hence the sub node that can contain the value is the sub node of
+	 * the first separator value that is equal to or greater than the value
+	 */
+	node = ( (libcdata_internal_btree_t *) internal_cursor->tree )->root_node;
+
+	do
+	{
+		if( libcdata_btree_node_get_node_values(
+		     node,
+		     &node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve node values.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_btree_node_values_get_value_index(
+		     node_values,
+		     value,
+		     value_compare_function,
+		     &value_index,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value index.",
+			 function );
+
+			return( -1 );
+		}
+		if( node_values->number_of_sub_nodes == 0 )
+		{
+			break;
+		}
+		node = node_values->sub_nodes[ value_index ];
+	}
+	while( node != NULL );
+
+	if( value_index < node_values->number_of_values )
+	{
+		internal_cursor->node        = node;
+		internal_cursor->value_index = value_index;
+
+		return( 1 );
+	}
+	/* All values in the leaf node are less than the value
+	 */
+	result = libcdata_internal_btree_cursor_get_next_leaf_node(
+	          node,
+	          &leaf_node,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		internal_cursor->node        = leaf_node;
+		internal_cursor->value_index = 0;
+	}
+	return( result );
+}
+
+/* Moves the cursor to the next value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libcdata_btree_cursor_next(
+     libcdata_btree_cursor_t *cursor,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values         = NULL;
+	libcdata_internal_btree_cursor_t *internal_cursor = NULL;
+	libcdata_tree_node_t *leaf_node                   = NULL;
+	static char *function                             = "libcdata_btree_cursor_next";
+	int result                                        = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libcdata_internal_btree_cursor_t *) cursor;
+
+	if( internal_cursor->node == NULL )
+	{
+		return( 0 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     internal_cursor->node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_cursor->value_index + 1 ) < node_values->number_of_values )
+	{
+		internal_cursor->value_index += 1;
+
+		return( 1 );
+	}
+	result = libcdata_internal_btree_cursor_get_next_leaf_node(
+	          internal_cursor->node,
+	          &leaf_node,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		internal_cursor->node        = leaf_node;
+		internal_cursor->value_index = 0;
+	}
+	else
+	{
+		internal_cursor->node        = NULL;
+		internal_cursor->value_index = -1;
+	}
+	return( result );
+}
+
+/* Moves the cursor to the previous value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libcdata_btree_cursor_previous(
+     libcdata_btree_cursor_t *cursor,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values         = NULL;
+	libcdata_internal_btree_cursor_t *internal_cursor = NULL;
+	libcdata_tree_node_t *leaf_node                   = NULL;
+	static char *function                             = "libcdata_btree_cursor_previous";
+	int result                                        = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libcdata_internal_btree_cursor_t *) cursor;
+
+	if( internal_cursor->node == NULL )
+	{
+		return( 0 );
+	}
+	if( internal_cursor->value_index > 0 )
+	{
+		internal_cursor->value_index -= 1;
+
+		return( 1 );
+	}
+	result = libcdata_internal_btree_cursor_get_previous_leaf_node(
+	          internal_cursor->node,
+	          &leaf_node,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_btree_node_get_node_values(
+		     leaf_node,
+		     &node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf node values.",
+			 function );
+
+			return( -1 );
+		}
+		internal_cursor->node        = leaf_node;
+		internal_cursor->value_index = node_values->number_of_values - 1;
+	}
+	else
+	{
+		internal_cursor->node        = NULL;
+		internal_cursor->value_index = -1;
+	}
+	return( result );
+}
+
+/* Retrieves the value at the cursor
+ * Returns 1 if successful, 0 if the cursor is not positioned at a value or -1 on error
+ */
+int libcdata_btree_cursor_get_value(
+     libcdata_btree_cursor_t *cursor,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	libcdata_internal_btree_cursor_t *internal_cursor = NULL;
+	static char *function                             = "libcdata_btree_cursor_get_value";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libcdata_internal_btree_cursor_t *) cursor;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->node == NULL )
+	{
+		*value = NULL;
+
+		return( 0 );
+	}
+	if( libcdata_btree_node_get_value_by_index(
+	     internal_cursor->node,
+	     internal_cursor->value_index,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from node.",
+		 function,
+		 internal_cursor->value_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
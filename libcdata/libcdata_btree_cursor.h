@@ -0,0 +1,125 @@
+/*
+ * Balanced tree cursor functions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATA_BTREE_CURSOR_H )
+#define _LIBCDATA_BTREE_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdata_extern.h"
+#include "libcdata_libcerror.h"
+#include "libcdata_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcdata_internal_btree_cursor libcdata_internal_btree_cursor_t;
+
+struct libcdata_internal_btree_cursor
+{
+	/* The tree
+	 */
+	libcdata_btree_t *tree;
+
+	/* The (leaf) node that contains the current value
+	 */
+	libcdata_tree_node_t *node;
+
+	/* The index of the current value in the node
+	 */
+	int value_index;
+};
+
+LIBCDATA_EXTERN \
+int libcdata_btree_cursor_initialize(
+     libcdata_btree_cursor_t **cursor,
+     libcdata_btree_t *tree,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_cursor_free(
+     libcdata_btree_cursor_t **cursor,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_cursor_get_first_leaf_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **leaf_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_cursor_get_last_leaf_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **leaf_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_cursor_get_next_leaf_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **leaf_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_btree_cursor_get_previous_leaf_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **leaf_node,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_cursor_seek_first(
+     libcdata_btree_cursor_t *cursor,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_cursor_seek_last(
+     libcdata_btree_cursor_t *cursor,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_cursor_seek_lower_bound(
+     libcdata_btree_cursor_t *cursor,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_cursor_next(
+     libcdata_btree_cursor_t *cursor,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_cursor_previous(
+     libcdata_btree_cursor_t *cursor,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_btree_cursor_get_value(
+     libcdata_btree_cursor_t *cursor,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATA_BTREE_CURSOR_H ) */
+
@@ -19,54 +19,30 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+
 #include <common.h>
 #include <memory.h>
 #include <types.h>
 
-#include "libcdata_array.h"
 #include "libcdata_btree_node.h"
-#include "libcdata_btree_values_list.h"
+#include "libcdata_btree_node_values.h"
 #include "libcdata_definitions.h"
 #include "libcdata_libcerror.h"
-#include "libcdata_list.h"
-#include "libcdata_list_element.h"
 #include "libcdata_tree_node.h"
 #include "libcdata_types.h"
 
-/* Retrieves the sub node for the specific value
- *
- * Uses the value_compare_function to determine the similarity of the entries
- * The value_compare_function should return LIBCDATA_COMPARE_LESS,
- * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
- *
- * If value_compare_function is NULL the pointer of the value is used to check for a match
- *
- * Returns 1 if successful, 0 if the value does not exist or -1 on error
- * If there was no possible sub match values_list_element is set to NULL
- * it there is a possible sub match values_list_element is set but 0 is returned
- * If the node is a leaf node sub_node is not set to NULL
+/* Creates a B-tree node
+ * The value of the tree node contains the node values
+ * Make sure the value node is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
  */
-int libcdata_btree_node_get_sub_node_by_value(
-     libcdata_tree_node_t *node,
-     intptr_t *value,
-     int (*value_compare_function)(
-            intptr_t *first_value,
-            intptr_t *second_value,
-            libcerror_error_t **error ),
-     libcdata_tree_node_t **sub_node,
-     libcdata_list_element_t **values_list_element,
+int libcdata_btree_node_initialize(
+     libcdata_tree_node_t **node,
+     int maximum_number_of_values,
      libcerror_error_t **error )
 {
-	libcdata_list_t *values_list                      = NULL;
-	libcdata_list_element_t *safe_values_list_element = NULL;
-	libcdata_tree_node_t *safe_sub_node               = NULL;
-	intptr_t *values_list_value                       = NULL;
-	static char *function                             = "libcdata_btree_node_get_sub_node_by_value";
-	int number_of_sub_nodes                           = 0;
-	int number_of_values_list_elements                = 0;
-	int result                                        = 0;
-	int sub_node_index                                = 0;
-	int values_list_element_index                     = 0;
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_btree_node_initialize";
 
 	if( node == NULL )
 	{
@@ -79,367 +55,307 @@ int libcdata_btree_node_get_sub_node_by_value(
 
 		return( -1 );
 	}
-	if( value == NULL )
+	if( *node != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( sub_node == NULL )
+	if( libcdata_btree_node_values_initialize(
+	     &node_values,
+	     maximum_number_of_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub node.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create node values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( values_list_element == NULL )
+	if( libcdata_tree_node_initialize(
+	     node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid values list element.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create node.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*sub_node            = NULL;
-	*values_list_element = NULL;
-
-	if( libcdata_tree_node_get_value(
-	     node,
-	     (intptr_t **) &values_list,
+	if( libcdata_tree_node_set_value(
+	     *node,
+	     (intptr_t *) node_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve values list.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set node values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( values_list != NULL )
-	{
-		if( libcdata_list_get_number_of_elements(
-		     values_list,
-		     &number_of_values_list_elements,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of values list elements.",
-			 function );
+	return( 1 );
 
-			return( -1 );
-		}
+on_error:
+	if( *node != NULL )
+	{
+		libcdata_tree_node_free(
+		 node,
+		 NULL,
+		 NULL );
+	}
+	if( node_values != NULL )
+	{
+		libcdata_btree_node_values_free(
+		 &node_values,
+		 NULL );
 	}
-	if( libcdata_tree_node_get_number_of_sub_nodes(
+	return( -1 );
+}
+
+/* Frees a B-tree node, its sub nodes and their node values
+ * The values referenced by the node values are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_free(
+     libcdata_tree_node_t **node,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_btree_node_free";
+
+	if( libcdata_tree_node_free(
 	     node,
-	     &number_of_sub_nodes,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libcdata_btree_node_values_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub nodes.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free node.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( number_of_sub_nodes != 0 )
-	 && ( ( number_of_values_list_elements + 1 ) != number_of_sub_nodes ) )
+	return( 1 );
+}
+
+/* Retrieves the node values of a B-tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_get_node_values(
+     libcdata_tree_node_t *node,
+     libcdata_btree_node_values_t **node_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_btree_node_get_node_values";
+
+	if( node_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of values list elements value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node values.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_values_list_elements == 0 )
-	{
-		return( 0 );
-	}
-	if( libcdata_list_get_first_element(
-	     values_list,
-	     &safe_values_list_element,
+	if( libcdata_tree_node_get_value(
+	     node,
+	     (intptr_t **) node_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first values list element.",
+		 "%s: unable to retrieve node values.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_sub_nodes != 0 )
+	if( *node_values == NULL )
 	{
-		if( libcdata_tree_node_get_sub_node_by_index(
-		     node,
-		     0,
-		     &safe_sub_node,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub node: 0.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid node - missing node values.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	for( values_list_element_index = 0;
-	     values_list_element_index < number_of_values_list_elements;
-	     values_list_element_index++ )
-	{
-		if( libcdata_list_element_get_value(
-		     safe_values_list_element,
-		     &values_list_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from values list element: %d.",
-			 function,
-			 values_list_element_index );
-
-			return( -1 );
-		}
-		if( values_list_value == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid values list element: %d - missing value.",
-			 function,
-			 values_list_element_index );
-
-			return( -1 );
-		}
-		if( value_compare_function != NULL )
-		{
-			result = value_compare_function(
-			          value,
-			          values_list_value,
-			          error );
-		}
-		else if( value == values_list_value )
-		{
-			result = LIBCDATA_COMPARE_EQUAL;
-		}
-		else
-		{
-			result = LIBCDATA_COMPARE_GREATER;
-		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to compare value with values list value: %d.",
-			 function,
-			 values_list_element_index );
+	return( 1 );
+}
 
-			return( -1 );
-		}
-		else if( result == LIBCDATA_COMPARE_EQUAL )
-		{
-			*sub_node            = safe_sub_node;
-			*values_list_element = safe_values_list_element;
+/* Retrieves a specific value of a B-tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_get_value_by_index(
+     libcdata_tree_node_t *node,
+     int value_index,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_btree_node_get_value_by_index";
 
-			return( 1 );
-		}
-		else if( result == LIBCDATA_COMPARE_LESS )
-		{
-			break;
-		}
-		else if( result != LIBCDATA_COMPARE_GREATER )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported value compare function return value: %d.",
-			 function,
-			 result );
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
 
-			return( -1 );
-		}
-		if( libcdata_list_element_get_next_element(
-		     safe_values_list_element,
-		     &safe_values_list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next element from values list element: %d.",
-			 function,
-			 values_list_element_index );
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
 
-			return( -1 );
-		}
-		if( number_of_sub_nodes != 0 )
-		{
-			if( libcdata_tree_node_get_next_node(
-			     safe_sub_node,
-			     &safe_sub_node,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve next node from sub node: %d.",
-				 function,
-				 sub_node_index );
+		return( -1 );
+	}
+	if( ( value_index < 0 )
+	 || ( value_index >= node_values->number_of_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
 
-				return( -1 );
-			}
-			sub_node_index++;
-		}
+		return( -1 );
 	}
-	*sub_node            = safe_sub_node;
-	*values_list_element = safe_values_list_element;
+	*value = node_values->values[ value_index ];
 
-	return( 0 );
+	return( 1 );
 }
 
-/* Retrieves the upper node for the specific value
+/* Retrieves the sub node for the specific value
  *
  * Uses the value_compare_function to determine the similarity of the entries
  * The value_compare_function should return LIBCDATA_COMPARE_LESS,
  * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
  *
+ * The node values are searched using a binary search, if value_compare_function
+ * is NULL the pointer of the value is used to check for a match using a linear search
+ *
  * Returns 1 if successful, 0 if the value does not exist or -1 on error
+ * If there was no possible sub match value_index is set to -1
+ * it there is a possible sub match value_index is set but 0 is returned
+ * If the node is a leaf node sub_node is set to NULL
  */
-int libcdata_btree_node_get_upper_node_by_value(
+int libcdata_btree_node_get_sub_node_by_value(
      libcdata_tree_node_t *node,
      intptr_t *value,
      int (*value_compare_function)(
             intptr_t *first_value,
             intptr_t *second_value,
             libcerror_error_t **error ),
-     libcdata_tree_node_t **upper_node,
-     libcdata_list_element_t **values_list_element,
+     libcdata_tree_node_t **sub_node,
+     int *value_index,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *sub_values_list_element = NULL;
-	libcdata_tree_node_t *sub_node                   = NULL;
-	static char *function                            = "libcdata_btree_node_get_upper_node_by_value";
-	int result                                       = 0;
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_btree_node_get_sub_node_by_value";
+	int result                                = 0;
+	int safe_value_index                      = 0;
 
-	if( node == NULL )
+	if( value == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node.",
+		 "%s: invalid value.",
 		 function );
 
 		return( -1 );
 	}
-	if( value == NULL )
+	if( sub_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value.",
+		 "%s: invalid sub node.",
 		 function );
 
 		return( -1 );
 	}
-	if( value_compare_function == NULL )
+	if( value_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value compare function.",
+		 "%s: invalid value index.",
 		 function );
 
 		return( -1 );
 	}
-	if( upper_node == NULL )
+	*sub_node    = NULL;
+	*value_index = -1;
+
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid upper node.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
 		 function );
 
 		return( -1 );
 	}
-	if( values_list_element == NULL )
+	if( ( node_values->number_of_sub_nodes != 0 )
+	 && ( ( node_values->number_of_values + 1 ) != node_values->number_of_sub_nodes ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid values list element.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	*upper_node          = NULL;
-	*values_list_element = NULL;
-
-	result = libcdata_btree_node_get_sub_node_by_value(
-	          node,
-	          value,
-	          value_compare_function,
-	          &sub_node,
-	          &sub_values_list_element,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sub node by value.",
-		 function );
-
-		return( -1 );
-	}
-	else if( sub_node != NULL )
-	{
-		result = libcdata_btree_node_get_upper_node_by_value(
-		          sub_node,
-		          value,
-		          value_compare_function,
-		          upper_node,
-		          values_list_element,
-		          error );
+	if( value_compare_function != NULL )
+	{
+		result = libcdata_btree_node_values_get_value_index(
+		          node_values,
+		          value,
+		          value_compare_function,
+		          &safe_value_index,
+		          error );
 
 		if( result == -1 )
 		{
@@ -447,336 +363,293 @@ int libcdata_btree_node_get_upper_node_by_value(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve upper node in sub node.",
+			 "%s: unable to retrieve value index.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	else if( result != 0 )
-	{
-		*values_list_element = sub_values_list_element;
-	}
-	if( *upper_node == NULL )
-	{
-		*upper_node = node;
-	}
-	return( result );
-}
-
-/* Appends a value into a tree node
- * Returns 1 if successful or -1 on error
- */
-int libcdata_btree_node_append_value(
-     libcdata_tree_node_t *node,
-     intptr_t *value,
-     libcerror_error_t **error )
-{
-	libcdata_list_t *values_list = NULL;
-	static char *function        = "libcdata_btree_node_append_value";
-
-	if( libcdata_tree_node_get_value(
-	     node,
-	     (intptr_t **) &values_list,
-	     error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve values list.",
-		 function );
+		/* The values are not ordered by their pointers so a linear search is needed
+		 */
+		for( safe_value_index = 0;
+		     safe_value_index < node_values->number_of_values;
+		     safe_value_index++ )
+		{
+			if( node_values->values[ safe_value_index ] == value )
+			{
+				result = 1;
 
-		return( -1 );
+				break;
+			}
+		}
 	}
-	if( values_list == NULL )
+	if( result == 1 )
 	{
-		if( libcdata_list_initialize(
-		     &values_list,
-		     error ) != 1 )
+		if( node_values->number_of_sub_nodes != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create values list.",
-			 function );
-
-			return( -1 );
+			*sub_node = node_values->sub_nodes[ safe_value_index ];
 		}
-		if( libcdata_tree_node_set_value(
-		     node,
-		     (intptr_t *) values_list,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set values list.",
-			 function );
-
-			libcdata_list_free(
-			 &values_list,
-			 NULL,
-			 NULL );
+		*value_index = safe_value_index;
 
-			return( -1 );
-		}
+		return( 1 );
 	}
-	if( libcdata_list_append_value(
-	     values_list,
-	     value,
-	     error ) != 1 )
+	if( node_values->number_of_sub_nodes != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append value to values list.",
-		 function );
-
-		return( -1 );
+		*sub_node = node_values->sub_nodes[ safe_value_index ];
 	}
-	return( 1 );
+	if( safe_value_index < node_values->number_of_values )
+	{
+		*value_index = safe_value_index;
+	}
+	return( 0 );
 }
 
-/* Inserts a value into a tree node
- * The tree node must be the most upper node (leaf)
+/* Retrieves the upper node for the specific value
  *
- * Uses the value_compare_function to determine the order of the entries
+ * Uses the value_compare_function to determine the similarity of the entries
  * The value_compare_function should return LIBCDATA_COMPARE_LESS,
  * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
  *
- * Returns 1 if successful, 0 if the value already exists or -1 on error
+ * Returns 1 if successful, 0 if the value does not exist or -1 on error
+ * If the value exists value_index is set to the index of the value in the upper node
+ * otherwise it is set to -1
  */
-int libcdata_btree_node_insert_value(
+int libcdata_btree_node_get_upper_node_by_value(
      libcdata_tree_node_t *node,
      intptr_t *value,
      int (*value_compare_function)(
             intptr_t *first_value,
             intptr_t *second_value,
             libcerror_error_t **error ),
+     libcdata_tree_node_t **upper_node,
+     int *value_index,
      libcerror_error_t **error )
 {
-	libcdata_list_t *values_list = NULL;
-	static char *function        = "libcdata_btree_node_insert_value";
-	int number_of_sub_nodes      = 0;
-	int result                   = 0;
+	libcdata_tree_node_t *safe_node = NULL;
+	libcdata_tree_node_t *sub_node  = NULL;
+	static char *function           = "libcdata_btree_node_get_upper_node_by_value";
+	int result                      = 0;
+	int sub_value_index             = 0;
 
-	if( libcdata_tree_node_get_number_of_sub_nodes(
-	     node,
-	     &number_of_sub_nodes,
-	     error ) != 1 )
+	if( node == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub nodes.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_sub_nodes != 0 )
+	if( value == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: cannot insert value in node with sub nodes.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_value(
-	     node,
-	     (intptr_t **) &values_list,
-	     error ) != 1 )
+	if( value_compare_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve values list.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value compare function.",
 		 function );
 
 		return( -1 );
 	}
-	if( values_list == NULL )
+	if( upper_node == NULL )
 	{
-		if( libcdata_list_initialize(
-		     &values_list,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upper node.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	*upper_node  = NULL;
+	*value_index = -1;
+
+	safe_node = node;
+
+	do
+	{
+		result = libcdata_btree_node_get_sub_node_by_value(
+		          safe_node,
+		          value,
+		          value_compare_function,
+		          &sub_node,
+		          &sub_value_index,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create values list.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node by value.",
 			 function );
 
 			return( -1 );
 		}
-		if( libcdata_tree_node_set_value(
-		     node,
-		     (intptr_t *) values_list,
-		     error ) != 1 )
+		if( sub_node != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set values list.",
-			 function );
-
-			libcdata_list_free(
-			 &values_list,
-			 NULL,
-			 NULL );
-
-			return( -1 );
+			safe_node = sub_node;
 		}
 	}
-	result = libcdata_list_insert_value(
-	          values_list,
-	          value,
-	          value_compare_function,
-	          LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
-	          error );
+	while( sub_node != NULL );
 
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert value in values list.",
-		 function );
+	*upper_node = safe_node;
 
-		return( -1 );
+	if( result != 0 )
+	{
+		*value_index = sub_value_index;
 	}
 	return( result );
 }
 
-/* Replaces a value in the tree node
- * The tree node must be the most upper node (leaf) in the first call
- * Returns 1 if successful or -1 on error
+/* Retrieves the sub node for a specific key
+ * Returns 1 if successful, 0 if the key does not exist or -1 on error
+ * If there was no possible sub match value_index is set to -1
+ * it there is a possible sub match value_index is set but 0 is returned
+ * If the node is a leaf node sub_node is set to NULL
  */
-int libcdata_btree_node_replace_value(
+int libcdata_btree_node_get_sub_node_by_key(
      libcdata_tree_node_t *node,
-     intptr_t *value,
-     intptr_t *replacement_value,
+     uint64_t key,
+     libcdata_tree_node_t **sub_node,
+     int *value_index,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *values_list_element = NULL;
-	libcdata_tree_node_t *parent_node            = NULL;
-	libcdata_tree_node_t *sub_node               = NULL;
-	static char *function                        = "libcdata_btree_node_replace_value";
-	int result                                   = 0;
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_btree_node_get_sub_node_by_key";
+	int result                                = 0;
+	int safe_value_index                      = 0;
 
-	if( value == NULL )
+	if( sub_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value.",
+		 "%s: invalid sub node.",
 		 function );
 
 		return( -1 );
 	}
-	if( replacement_value == NULL )
+	if( value_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid replacement value.",
+		 "%s: invalid value index.",
 		 function );
 
 		return( -1 );
 	}
-	result = libcdata_btree_node_get_sub_node_by_value(
-	          node,
-	          value,
-	          NULL,
-	          &sub_node,
-	          &values_list_element,
-	          error );
+	*sub_node    = NULL;
+	*value_index = -1;
 
-	if( result == -1 )
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sub node by value.",
+		 "%s: unable to retrieve node values.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	if( ( node_values->number_of_sub_nodes != 0 )
+	 && ( ( node_values->number_of_values + 1 ) != node_values->number_of_sub_nodes ) )
 	{
-		if( libcdata_list_element_set_value(
-		     values_list_element,
-		     replacement_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set value in values list element.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( libcdata_tree_node_get_parent_node(
-	     node,
-	     &parent_node,
-	     error ) != 1 )
+	result = libcdata_btree_node_values_get_key_index(
+	          node_values,
+	          key,
+	          &safe_value_index,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve parent node.",
+		 "%s: unable to retrieve key index.",
 		 function );
 
 		return( -1 );
 	}
-	if( parent_node != NULL )
+	if( node_values->number_of_sub_nodes != 0 )
 	{
-		if( libcdata_btree_node_replace_value(
-		     parent_node,
-		     value,
-		     replacement_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to replace value in parent node.",
-			 function );
+		*sub_node = node_values->sub_nodes[ safe_value_index ];
+	}
+	if( result == 1 )
+	{
+		*value_index = safe_value_index;
 
-			return( -1 );
-		}
+		return( 1 );
 	}
-	return( 1 );
+	if( safe_value_index < node_values->number_of_values )
+	{
+		*value_index = safe_value_index;
+	}
+	return( 0 );
 }
 
-/* Flattens a tree node and its sub node
- * Returns 1 if successful or -1 on error
+/* Retrieves the upper node for the specific key
+ * Returns 1 if successful, 0 if the key does not exist or -1 on error
+ * If the key exists value_index is set to the index of the value in the upper node
+ * otherwise it is set to -1
  */
-int libcdata_btree_node_flatten_node(
-     libcdata_tree_node_t **node,
+int libcdata_btree_node_get_upper_node_by_key(
+     libcdata_tree_node_t *node,
+     uint64_t key,
+     libcdata_tree_node_t **upper_node,
+     int *value_index,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *sub_node = NULL;
-	static char *function          = "libcdata_btree_node_flatten_node";
+	libcdata_tree_node_t *safe_node = NULL;
+	libcdata_tree_node_t *sub_node  = NULL;
+	static char *function           = "libcdata_btree_node_get_upper_node_by_key";
+	int result                      = 0;
+	int sub_value_index             = 0;
 
 	if( node == NULL )
 	{
@@ -789,128 +662,342 @@ int libcdata_btree_node_flatten_node(
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_first_sub_node(
-	     *node,
-	     &sub_node,
-	     error ) != 1 )
+	if( upper_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first sub node.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upper node.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_remove_node(
-	     *node,
-	     sub_node,
-	     error ) != 1 )
+	if( value_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-		 "%s: unable to remove sub node from node.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_replace_node(
-	     *node,
-	     sub_node,
+	*upper_node  = NULL;
+	*value_index = -1;
+
+	safe_node = node;
+
+	do
+	{
+		result = libcdata_btree_node_get_sub_node_by_key(
+		          safe_node,
+		          key,
+		          &sub_node,
+		          &sub_value_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node by key.",
+			 function );
+
+			return( -1 );
+		}
+		if( sub_node != NULL )
+		{
+			safe_node = sub_node;
+		}
+	}
+	while( sub_node != NULL );
+
+	*upper_node = safe_node;
+
+	if( result != 0 )
+	{
+		*value_index = sub_value_index;
+	}
+	return( result );
+}
+
+/* Retrieves the value at a specific rank in the B-tree node and its sub nodes
+ * The rank is the (zero-based) position of the value in the sorted values
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_get_value_by_rank(
+     libcdata_tree_node_t *node,
+     int rank,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values     = NULL;
+	libcdata_btree_node_values_t *sub_node_values = NULL;
+	static char *function                         = "libcdata_btree_node_get_value_by_rank";
+	int sub_node_index                            = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to replace node with sub node.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
 		 function );
 
-		libcdata_tree_node_append_node(
-		 *node,
-		 sub_node,
-		 NULL );
+		return( -1 );
+	}
+	if( ( rank < 0 )
+	 || ( rank >= node_values->number_of_leaf_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid rank value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_free(
-	     node,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libcdata_btree_values_list_free,
-	     error ) != 1 )
+	/* Skip the sub nodes that contain values with a lower rank
+	 */
+	while( node_values->number_of_sub_nodes != 0 )
+	{
+		for( sub_node_index = 0;
+		     sub_node_index < node_values->number_of_sub_nodes;
+		     sub_node_index++ )
+		{
+			if( libcdata_btree_node_get_node_values(
+			     node_values->sub_nodes[ sub_node_index ],
+			     &sub_node_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub node: %d values.",
+				 function,
+				 sub_node_index );
+
+				return( -1 );
+			}
+			if( rank < sub_node_values->number_of_leaf_values )
+			{
+				break;
+			}
+			rank -= sub_node_values->number_of_leaf_values;
+		}
+		if( sub_node_index >= node_values->number_of_sub_nodes )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid node values - number of leaf values does not correspond with sub nodes.",
+			 function );
+
+			return( -1 );
+		}
+		node_values = sub_node_values;
+	}
+	if( rank >= node_values->number_of_values )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free node.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid leaf node values - number of leaf values does not correspond with values.",
 		 function );
 
 		return( -1 );
 	}
-	*node = sub_node;
+	*value = node_values->values[ rank ];
 
 	return( 1 );
 }
 
-/* Removes a sub node from the B-tree node
- * Returns 1 if successful or -1 on error
+/* Retrieves the rank of a value in the B-tree node and its sub nodes
+ * The rank is the number of values that are less than the value
+ *
+ * Uses the value_compare_function to determine the order of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ * The rank is also set if there is no such value
  */
-int libcdata_btree_node_remove_sub_node(
+int libcdata_btree_node_get_rank_of_value(
      libcdata_tree_node_t *node,
-     libcdata_tree_node_t **sub_node,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     int *rank,
      libcerror_error_t **error )
 {
-	static char *function = "libcdata_btree_node_remove_sub_node";
+	libcdata_btree_node_values_t *node_values     = NULL;
+	libcdata_btree_node_values_t *sub_node_values = NULL;
+	static char *function                         = "libcdata_btree_node_get_rank_of_value";
+	int result                                    = 0;
+	int safe_rank                                 = 0;
+	int sub_node_index                            = 0;
+	int value_index                               = 0;
 
-	if( node == NULL )
+	if( rank == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node.",
+		 "%s: invalid rank.",
 		 function );
 
 		return( -1 );
 	}
-	if( sub_node == NULL )
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub node.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_remove_node(
+	/* The separator value of a sub node is the last value in the sub node,
+	 * hence the values in the sub nodes before the sub node that can contain
+	 * the value are all less than the value
+	 */
+	do
+	{
+		result = libcdata_btree_node_values_get_value_index(
+		          node_values,
+		          value,
+		          value_compare_function,
+		          &value_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value index.",
+			 function );
+
+			return( -1 );
+		}
+		if( node_values->number_of_sub_nodes == 0 )
+		{
+			break;
+		}
+		for( sub_node_index = 0;
+		     sub_node_index < value_index;
+		     sub_node_index++ )
+		{
+			if( libcdata_btree_node_get_node_values(
+			     node_values->sub_nodes[ sub_node_index ],
+			     &sub_node_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub node: %d values.",
+				 function,
+				 sub_node_index );
+
+				return( -1 );
+			}
+			safe_rank += sub_node_values->number_of_leaf_values;
+		}
+		if( libcdata_btree_node_get_node_values(
+		     node_values->sub_nodes[ value_index ],
+		     &node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node: %d values.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	while( node_values != NULL );
+
+	*rank = safe_rank + value_index;
+
+	return( result );
+}
+
+/* Appends a value and its key into a B-tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_append_value(
+     libcdata_tree_node_t *node,
+     intptr_t *value,
+     uint64_t key,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_btree_node_append_value";
+
+	if( libcdata_btree_node_get_node_values(
 	     node,
-	     *sub_node,
+	     &node_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-		 "%s: unable to remove sub node from node.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_free(
-	     sub_node,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libcdata_btree_values_list_free,
+	if( libcdata_btree_node_values_insert_value(
+	     node_values,
+	     node_values->number_of_values,
+	     value,
+	     key,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free sub node.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value to node values.",
 		 function );
 
 		return( -1 );
@@ -918,690 +1005,2428 @@ int libcdata_btree_node_remove_sub_node(
 	return( 1 );
 }
 
-/* Removes a value from the tree node
- * The tree node must be the most upper node (leaf) in the first call
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Appends a sub node into a B-tree node
+ * Returns 1 if successful or -1 on error
  */
-int libcdata_btree_node_remove_value(
+int libcdata_btree_node_append_sub_node(
      libcdata_tree_node_t *node,
-     intptr_t *value,
-     intptr_t *replacement_value,
+     libcdata_tree_node_t *sub_node,
      libcerror_error_t **error )
 {
-	libcdata_list_t *sub_node_values_list        = NULL;
-	libcdata_list_t *values_list                 = NULL;
-	libcdata_list_element_t *values_list_element = NULL;
-	libcdata_tree_node_t *parent_node            = NULL;
-	libcdata_tree_node_t *sub_node               = NULL;
-	static char *function                        = "libcdata_btree_node_remove_value";
-	int number_of_sub_nodes                      = 0;
-	int number_of_values_list_elements           = 0;
-	int result                                   = 0;
-	int sub_node_number_of_sub_nodes             = 0;
-	int sub_node_number_of_values_list_elements  = 0;
-
-	if( value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value.",
-		 function );
-
-		return( -1 );
-	}
-	result = libcdata_btree_node_get_sub_node_by_value(
-	          node,
-	          value,
-	          NULL,
-	          &sub_node,
-	          &values_list_element,
-	          error );
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_btree_node_append_sub_node";
 
-	if( result == -1 )
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sub node by value.",
+		 "%s: unable to retrieve node values.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_value(
+	if( libcdata_tree_node_append_node(
 	     node,
-	     (intptr_t **) &values_list,
+	     sub_node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve values list.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append sub node to node.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_list_get_number_of_elements(
-	     values_list,
-	     &number_of_values_list_elements,
+	if( libcdata_btree_node_values_insert_sub_node(
+	     node_values,
+	     node_values->number_of_sub_nodes,
+	     sub_node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values list elements.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append sub node to node values.",
 		 function );
 
+		libcdata_tree_node_remove_node(
+		 node,
+		 sub_node,
+		 NULL );
+
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_number_of_sub_nodes(
+	return( 1 );
+}
+
+/* Updates the number of leaf values of the B-tree node from its values or sub nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_update_number_of_leaf_values(
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values     = NULL;
+	libcdata_btree_node_values_t *sub_node_values = NULL;
+	static char *function                         = "libcdata_btree_node_update_number_of_leaf_values";
+	int number_of_leaf_values                     = 0;
+	int sub_node_index                            = 0;
+
+	if( libcdata_btree_node_get_node_values(
 	     node,
-	     &number_of_sub_nodes,
+	     &node_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub nodes.",
+		 "%s: unable to retrieve node values.",
 		 function );
 
 		return( -1 );
 	}
-	if( sub_node != NULL )
+	if( node_values->number_of_sub_nodes == 0 )
 	{
-		if( libcdata_tree_node_get_value(
-		     sub_node,
-		     (intptr_t **) &sub_node_values_list,
+		number_of_leaf_values = node_values->number_of_values;
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < node_values->number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libcdata_btree_node_get_node_values(
+		     node_values->sub_nodes[ sub_node_index ],
+		     &sub_node_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub node values list.",
-			 function );
+			 "%s: unable to retrieve sub node: %d values.",
+			 function,
+			 sub_node_index );
 
 			return( -1 );
 		}
-		if( libcdata_list_get_number_of_elements(
-		     sub_node_values_list,
-		     &sub_node_number_of_values_list_elements,
+		number_of_leaf_values += sub_node_values->number_of_leaf_values;
+	}
+	node_values->number_of_leaf_values = number_of_leaf_values;
+
+	return( 1 );
+}
+
+/* Adjusts the number of leaf values of the B-tree node and its parent nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_adjust_number_of_leaf_values(
+     libcdata_tree_node_t *node,
+     int difference,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_btree_node_adjust_number_of_leaf_values";
+
+	do
+	{
+		if( libcdata_btree_node_get_node_values(
+		     node,
+		     &node_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub node number of values list elements.",
+			 "%s: unable to retrieve node values.",
 			 function );
 
 			return( -1 );
 		}
-		if( libcdata_tree_node_get_number_of_sub_nodes(
-		     sub_node,
-		     &sub_node_number_of_sub_nodes,
+		node_values->number_of_leaf_values += difference;
+
+		if( libcdata_tree_node_get_parent_node(
+		     node,
+		     &node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of sub nodes.",
+			 "%s: unable to retrieve parent node.",
 			 function );
 
 			return( -1 );
 		}
-		/* If the sub node is empty remove it
-		 */
-		if( ( sub_node_number_of_sub_nodes == 0 )
-		 && ( sub_node_number_of_values_list_elements == 0 ) )
-		{
-			if( libcdata_btree_node_remove_sub_node(
-			     node,
-			     &sub_node,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-				 "%s: unable to remove remaining sub node from node.",
-				 function );
+	}
+	while( node != NULL );
+
+	return( 1 );
+}
+
+/* Inserts a value into a B-tree node
+ * The tree node must be the most upper node (leaf)
+ *
+ * Uses the value_compare_function to determine the order of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * Returns 1 if successful, 0 if the value already exists or -1 on error
+ */
+int libcdata_btree_node_insert_value(
+     libcdata_tree_node_t *node,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_btree_node_insert_value";
+	int result                                = 0;
+	int value_index                           = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_compare_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value compare function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_values->number_of_sub_nodes != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: cannot insert value in node with sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdata_btree_node_values_get_value_index(
+	          node_values,
+	          value,
+	          value_compare_function,
+	          &value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_btree_node_values_insert_value(
+	     node_values,
+	     value_index,
+	     value,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert value: %d in node values.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_adjust_number_of_leaf_values(
+	     node,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to adjust number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Inserts a value with a specific key into a B-tree node
+ * The tree node must be the most upper node (leaf)
+ * Returns 1 if successful, 0 if the key already exists or -1 on error
+ */
+int libcdata_btree_node_insert_value_by_key(
+     libcdata_tree_node_t *node,
+     uint64_t key,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_btree_node_insert_value_by_key";
+	int result                                = 0;
+	int value_index                           = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_values->number_of_sub_nodes != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: cannot insert value in node with sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdata_btree_node_values_get_key_index(
+	          node_values,
+	          key,
+	          &value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_btree_node_values_insert_value(
+	     node_values,
+	     value_index,
+	     value,
+	     key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert value: %d in node values.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_adjust_number_of_leaf_values(
+	     node,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to adjust number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Replaces a value and its key in the B-tree node
+ * The tree node must be the most upper node (leaf) in the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_replace_value(
+     libcdata_tree_node_t *node,
+     intptr_t *value,
+     intptr_t *replacement_value,
+     uint64_t replacement_key,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *parent_node         = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	static char *function                     = "libcdata_btree_node_replace_value";
+	int result                                = 0;
+	int value_index                           = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( replacement_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replacement value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdata_btree_node_get_sub_node_by_value(
+	          node,
+	          value,
+	          NULL,
+	          &sub_node,
+	          &value_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub node by value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_btree_node_get_node_values(
+		     node,
+		     &node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve node values.",
+			 function );
+
+			return( -1 );
+		}
+		node_values->keys[ value_index ]   = replacement_key;
+		node_values->values[ value_index ] = replacement_value;
+	}
+	if( libcdata_tree_node_get_parent_node(
+	     node,
+	     &parent_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent node.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_node != NULL )
+	{
+		if( libcdata_btree_node_replace_value(
+		     parent_node,
+		     value,
+		     replacement_value,
+		     replacement_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to replace value in parent node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Flattens a B-tree node and its sub node
+ * The node must have a single sub node, the values and sub nodes of the sub node
+ * are moved into the node so that references to the node remain valid
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_flatten_node(
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values     = NULL;
+	libcdata_btree_node_values_t *sub_node_values = NULL;
+	libcdata_tree_node_t *sub_node                = NULL;
+	libcdata_tree_node_t *sub_sub_node            = NULL;
+	static char *function                         = "libcdata_btree_node_flatten_node";
+	int sub_node_index                            = 0;
+
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_values->number_of_values != 0 )
+	 || ( node_values->number_of_sub_nodes != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported node - only a node with a single sub node can be flattened.",
+		 function );
+
+		return( -1 );
+	}
+	sub_node = node_values->sub_nodes[ 0 ];
+
+	if( libcdata_btree_node_get_node_values(
+	     sub_node,
+	     &sub_node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_remove_node(
+	     node,
+	     sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove sub node from node.",
+		 function );
+
+		return( -1 );
+	}
+	node_values->sub_nodes[ 0 ]      = NULL;
+	node_values->number_of_sub_nodes = 0;
+
+	for( sub_node_index = 0;
+	     sub_node_index < sub_node_values->number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		sub_sub_node = sub_node_values->sub_nodes[ sub_node_index ];
+
+		if( libcdata_tree_node_remove_node(
+		     sub_node,
+		     sub_sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove sub node: %d from sub node.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+		if( libcdata_tree_node_append_node(
+		     node,
+		     sub_sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sub node: %d to node.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+	}
+	/* Swap the node values so that the node values of the sub node
+	 * are freed together with the sub node
+	 */
+	if( libcdata_tree_node_set_value(
+	     node,
+	     (intptr_t *) sub_node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_set_value(
+	     sub_node,
+	     (intptr_t *) node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sub node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_free(
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sub node.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes a sub node from the B-tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_remove_sub_node(
+     libcdata_tree_node_t *node,
+     int sub_node_index,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	static char *function                     = "libcdata_btree_node_remove_sub_node";
+
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_node_index < 0 )
+	 || ( sub_node_index >= node_values->number_of_sub_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sub_node = node_values->sub_nodes[ sub_node_index ];
+
+	if( libcdata_tree_node_remove_node(
+	     node,
+	     sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove sub node: %d from node.",
+		 function,
+		 sub_node_index );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_values_remove_sub_node(
+	     node_values,
+	     sub_node_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove sub node: %d from node values.",
+		 function,
+		 sub_node_index );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_free(
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sub node: %d.",
+		 function,
+		 sub_node_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of a specific sub node in the B-tree node
+ * Returns 1 if successful, 0 if no such sub node or -1 on error
+ */
+int libcdata_btree_node_get_sub_node_index(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *sub_node,
+     int *sub_node_index,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_btree_node_get_sub_node_index";
+	int safe_sub_node_index                   = 0;
+
+	if( sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
+
+		return( -1 );
+	}
+	for( safe_sub_node_index = 0;
+	     safe_sub_node_index < node_values->number_of_sub_nodes;
+	     safe_sub_node_index++ )
+	{
+		if( node_values->sub_nodes[ safe_sub_node_index ] == sub_node )
+		{
+			*sub_node_index = safe_sub_node_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Moves the last value, or sub node, of the previous sub node to a specific sub node
+ * The separator values in the B-tree node are updated accordingly
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_borrow_from_previous_sub_node(
+     libcdata_tree_node_t *node,
+     int sub_node_index,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values          = NULL;
+	libcdata_btree_node_values_t *previous_node_values = NULL;
+	libcdata_btree_node_values_t *sub_node_values      = NULL;
+	libcdata_tree_node_t *previous_node                = NULL;
+	libcdata_tree_node_t *moved_sub_node               = NULL;
+	libcdata_tree_node_t *sub_node                     = NULL;
+	intptr_t *moved_value                              = NULL;
+	intptr_t *separator_value                          = NULL;
+	static char *function                              = "libcdata_btree_node_borrow_from_previous_sub_node";
+	uint64_t moved_key                                 = 0;
+	uint64_t separator_key                             = 0;
+	int last_value_index                               = 0;
+
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_node_index < 1 )
+	 || ( sub_node_index >= node_values->number_of_sub_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	previous_node = node_values->sub_nodes[ sub_node_index - 1 ];
+	sub_node      = node_values->sub_nodes[ sub_node_index ];
+
+	if( libcdata_btree_node_get_node_values(
+	     previous_node,
+	     &previous_node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous sub node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     sub_node,
+	     &sub_node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( previous_node_values->number_of_values < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid previous sub node - not enough values.",
+		 function );
+
+		return( -1 );
+	}
+	last_value_index = previous_node_values->number_of_values - 1;
+
+	if( previous_node_values->number_of_sub_nodes == 0 )
+	{
+		/* In a leaf node the last value of the previous sub node is moved
+		 */
+		moved_key       = previous_node_values->keys[ last_value_index ];
+		moved_value     = previous_node_values->values[ last_value_index ];
+		separator_key   = previous_node_values->keys[ last_value_index - 1 ];
+		separator_value = previous_node_values->values[ last_value_index - 1 ];
+	}
+	else
+	{
+		/* In a branch node the separator value moves down into the sub node
+		 * and the last value of the previous sub node moves up into the node
+		 */
+		moved_key       = node_values->keys[ sub_node_index - 1 ];
+		moved_value     = node_values->values[ sub_node_index - 1 ];
+		moved_sub_node  = previous_node_values->sub_nodes[ last_value_index + 1 ];
+		separator_key   = previous_node_values->keys[ last_value_index ];
+		separator_value = previous_node_values->values[ last_value_index ];
+
+		if( libcdata_tree_node_remove_node(
+		     previous_node,
+		     moved_sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove last sub node from previous sub node.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_btree_node_values_remove_sub_node(
+		     previous_node_values,
+		     last_value_index + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove last sub node from previous sub node values.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_internal_tree_node_insert_node_before_sub_node_with_lock(
+		     sub_node,
+		     sub_node_values->sub_nodes[ 0 ],
+		     moved_sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert sub node in sub node.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_btree_node_values_insert_sub_node(
+		     sub_node_values,
+		     0,
+		     moved_sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert sub node in sub node values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_btree_node_values_insert_value(
+	     sub_node_values,
+	     0,
+	     moved_value,
+	     moved_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert value in sub node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_values_remove_value(
+	     previous_node_values,
+	     last_value_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove last value from previous sub node values.",
+		 function );
+
+		return( -1 );
+	}
+	node_values->keys[ sub_node_index - 1 ]   = separator_key;
+	node_values->values[ sub_node_index - 1 ] = separator_value;
+
+	/* In a leaf node make sure the separator value of the sub node is the last value of the sub node
+	 */
+	if( ( sub_node_values->number_of_sub_nodes == 0 )
+	 && ( sub_node_index < node_values->number_of_values ) )
+	{
+		node_values->keys[ sub_node_index ]   = sub_node_values->keys[ sub_node_values->number_of_values - 1 ];
+		node_values->values[ sub_node_index ] = sub_node_values->values[ sub_node_values->number_of_values - 1 ];
+	}
+	if( libcdata_btree_node_update_number_of_leaf_values(
+	     previous_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update number of leaf values of previous sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_update_number_of_leaf_values(
+	     sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update number of leaf values of sub node.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Moves the first value, or sub node, of the next sub node to a specific sub node
+ * The separator values in the B-tree node are updated accordingly
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_borrow_from_next_sub_node(
+     libcdata_tree_node_t *node,
+     int sub_node_index,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *next_node_values = NULL;
+	libcdata_btree_node_values_t *node_values      = NULL;
+	libcdata_btree_node_values_t *sub_node_values  = NULL;
+	libcdata_tree_node_t *moved_sub_node           = NULL;
+	libcdata_tree_node_t *next_node                = NULL;
+	libcdata_tree_node_t *sub_node                 = NULL;
+	intptr_t *moved_value                          = NULL;
+	intptr_t *separator_value                      = NULL;
+	static char *function                          = "libcdata_btree_node_borrow_from_next_sub_node";
+	uint64_t moved_key                             = 0;
+	uint64_t separator_key                         = 0;
+
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_node_index < 0 )
+	 || ( sub_node_index >= ( node_values->number_of_sub_nodes - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sub_node  = node_values->sub_nodes[ sub_node_index ];
+	next_node = node_values->sub_nodes[ sub_node_index + 1 ];
+
+	if( libcdata_btree_node_get_node_values(
+	     sub_node,
+	     &sub_node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     next_node,
+	     &next_node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next sub node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_node_values->number_of_values < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid next sub node - not enough values.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_node_values->number_of_sub_nodes == 0 )
+	{
+		/* In a leaf node the first value of the next sub node is moved
+		 * and becomes the separator value of the sub node
+		 */
+		moved_key       = next_node_values->keys[ 0 ];
+		moved_value     = next_node_values->values[ 0 ];
+		separator_key   = moved_key;
+		separator_value = moved_value;
+	}
+	else
+	{
+		/* In a branch node the separator value moves down into the sub node
+		 * and the first value of the next sub node moves up into the node
+		 */
+		moved_key       = node_values->keys[ sub_node_index ];
+		moved_value     = node_values->values[ sub_node_index ];
+		moved_sub_node  = next_node_values->sub_nodes[ 0 ];
+		separator_key   = next_node_values->keys[ 0 ];
+		separator_value = next_node_values->values[ 0 ];
+
+		if( libcdata_tree_node_remove_node(
+		     next_node,
+		     moved_sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove first sub node from next sub node.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_btree_node_values_remove_sub_node(
+		     next_node_values,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove first sub node from next sub node values.",
+			 function );
 
-				return( -1 );
-			}
-			if( libcdata_tree_node_get_number_of_sub_nodes(
+			return( -1 );
+		}
+		if( libcdata_btree_node_append_sub_node(
+		     sub_node,
+		     moved_sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sub node to sub node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_btree_node_values_insert_value(
+	     sub_node_values,
+	     sub_node_values->number_of_values,
+	     moved_value,
+	     moved_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value to sub node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_values_remove_value(
+	     next_node_values,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove first value from next sub node values.",
+		 function );
+
+		return( -1 );
+	}
+	node_values->keys[ sub_node_index ]   = separator_key;
+	node_values->values[ sub_node_index ] = separator_value;
+
+	if( libcdata_btree_node_update_number_of_leaf_values(
+	     sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update number of leaf values of sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_update_number_of_leaf_values(
+	     next_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update number of leaf values of next sub node.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Merges the sub node following a specific sub node into the sub node
+ * The separator value between both sub nodes is removed from the B-tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_merge_sub_nodes(
+     libcdata_tree_node_t *node,
+     int sub_node_index,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values     = NULL;
+	libcdata_btree_node_values_t *sub_node_values = NULL;
+	libcdata_tree_node_t *next_node               = NULL;
+	libcdata_tree_node_t *sub_node                = NULL;
+	static char *function                         = "libcdata_btree_node_merge_sub_nodes";
+
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_node_index < 0 )
+	 || ( sub_node_index >= ( node_values->number_of_sub_nodes - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sub_node  = node_values->sub_nodes[ sub_node_index ];
+	next_node = node_values->sub_nodes[ sub_node_index + 1 ];
+
+	if( libcdata_btree_node_get_node_values(
+	     sub_node,
+	     &sub_node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub node values.",
+		 function );
+
+		return( -1 );
+	}
+	/* In a branch node the separator value moves down into the merged sub node
+	 */
+	if( sub_node_values->number_of_sub_nodes != 0 )
+	{
+		if( libcdata_btree_node_append_value(
+		     sub_node,
+		     node_values->values[ sub_node_index ],
+		     node_values->keys[ sub_node_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append separator value to sub node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_btree_node_move_values(
+	     next_node,
+	     0,
+	     sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to move values of next sub node to sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_update_number_of_leaf_values(
+	     sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update number of leaf values of sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_values_remove_value(
+	     node_values,
+	     sub_node_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove separator value: %d from node values.",
+		 function,
+		 sub_node_index );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_remove_sub_node(
+	     node,
+	     sub_node_index + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove next sub node from node.",
+		 function );
+
+		return( -1 );
+	}
+	/* In a leaf node make sure the separator value of the merged sub node is its last value
+	 */
+	if( ( sub_node_values->number_of_sub_nodes == 0 )
+	 && ( sub_node_values->number_of_values > 0 )
+	 && ( sub_node_index < node_values->number_of_values ) )
+	{
+		node_values->keys[ sub_node_index ]   = sub_node_values->keys[ sub_node_values->number_of_values - 1 ];
+		node_values->values[ sub_node_index ] = sub_node_values->values[ sub_node_values->number_of_values - 1 ];
+	}
+	return( 1 );
+}
+
+/* Rebalances a sub node of the B-tree node that contains less than the minimum number of values
+ * The sub node either borrows a value from a sibling sub node that contains more than the
+ * minimum number of values or is merged with a sibling sub node
+ * The sub node that contains the values of the rebalanced sub node is returned in rebalanced_sub_node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_rebalance_sub_node(
+     libcdata_tree_node_t *node,
+     int sub_node_index,
+     libcdata_tree_node_t **rebalanced_sub_node,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values         = NULL;
+	libcdata_btree_node_values_t *sibling_node_values = NULL;
+	static char *function                             = "libcdata_btree_node_rebalance_sub_node";
+	int minimum_number_of_values                      = 0;
+
+	if( rebalanced_sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rebalanced sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_node_index < 0 )
+	 || ( sub_node_index >= node_values->number_of_sub_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	minimum_number_of_values = node_values->maximum_number_of_values / 2;
+
+	*rebalanced_sub_node = node_values->sub_nodes[ sub_node_index ];
+
+	if( sub_node_index > 0 )
+	{
+		if( libcdata_btree_node_get_node_values(
+		     node_values->sub_nodes[ sub_node_index - 1 ],
+		     &sibling_node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve previous sub node values.",
+			 function );
+
+			return( -1 );
+		}
+		if( sibling_node_values->number_of_values > minimum_number_of_values )
+		{
+			if( libcdata_btree_node_borrow_from_previous_sub_node(
 			     node,
-			     &number_of_sub_nodes,
+			     sub_node_index,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve number of sub nodes.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to borrow from previous sub node.",
 				 function );
 
 				return( -1 );
 			}
-			if( values_list_element == NULL )
-			{
-				if( libcdata_list_get_last_element(
-				     values_list,
-				     &values_list_element,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve last values list element.",
-					 function );
-
-					return( -1 );
-				}
-				if( libcdata_list_element_get_value(
-				     values_list_element,
-				     &replacement_value,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve value from last values list element.",
-					 function );
-
-					return( -1 );
-				}
-			}
-			if( values_list_element != NULL )
-			{
-				if( libcdata_btree_values_list_remove_element(
-				     values_list,
-				     &values_list_element,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-					 "%s: unable to remove element from values list.",
-					 function );
-
-					return( -1 );
-				}
-				if( libcdata_list_get_number_of_elements(
-				     values_list,
-				     &number_of_values_list_elements,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve number of values list elements.",
-					 function );
-
-					return( -1 );
-				}
-			}
+			return( 1 );
 		}
 	}
-	if( number_of_sub_nodes != 0 )
+	if( sub_node_index < ( node_values->number_of_sub_nodes - 1 ) )
 	{
-		if( ( number_of_values_list_elements + 1 ) != number_of_sub_nodes )
+		if( libcdata_btree_node_get_node_values(
+		     node_values->sub_nodes[ sub_node_index + 1 ],
+		     &sibling_node_values,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid number of values list elements value out of bounds.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next sub node values.",
 			 function );
 
 			return( -1 );
 		}
-		/* If one sub node remains flatten the node
-		 */
-		if( number_of_sub_nodes == 1 )
+		if( sibling_node_values->number_of_values > minimum_number_of_values )
 		{
-			if( libcdata_btree_node_flatten_node(
-			     &node,
+			if( libcdata_btree_node_borrow_from_next_sub_node(
+			     node,
+			     sub_node_index,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to flatten node.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to borrow from next sub node.",
 				 function );
 
 				return( -1 );
 			}
-			if( libcdata_tree_node_get_value(
+			return( 1 );
+		}
+	}
+	/* Merge with the previous sub node if available, otherwise with the next sub node
+	 */
+	if( sub_node_index > 0 )
+	{
+		sub_node_index -= 1;
+
+		*rebalanced_sub_node = node_values->sub_nodes[ sub_node_index ];
+	}
+	else if( node_values->number_of_sub_nodes < 2 )
+	{
+		return( 1 );
+	}
+	if( libcdata_btree_node_merge_sub_nodes(
+	     node,
+	     sub_node_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to merge sub nodes: %d and %d.",
+		 function,
+		 sub_node_index,
+		 sub_node_index + 1 );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes a value from the B-tree node
+ * The tree node must be the most upper node (leaf)
+ *
+ * Nodes that contain less than half the maximum number of values after the removal
+ * are rebalanced with their sibling nodes and the tree shrinks in height when the
+ * root node is left with a single sub node, where the root node remains the same
+ *
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libcdata_btree_node_remove_value(
+     libcdata_tree_node_t *node,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *parent_node         = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	intptr_t *replacement_value               = NULL;
+	static char *function                     = "libcdata_btree_node_remove_value";
+	uint64_t replacement_key                  = 0;
+	int minimum_number_of_values              = 0;
+	int result                                = 0;
+	int sub_node_index                        = 0;
+	int value_index                           = -1;
+	int value_is_last_value                   = 0;
+
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_values->number_of_sub_nodes != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: cannot remove value from node with sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdata_btree_node_get_sub_node_by_value(
+	          node,
+	          value,
+	          NULL,
+	          &sub_node,
+	          &value_index,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value index.",
+			 function );
+		}
+		return( result );
+	}
+	value_is_last_value = (int) ( value_index == ( node_values->number_of_values - 1 ) );
+
+	if( libcdata_btree_node_values_remove_value(
+	     node_values,
+	     value_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove value: %d from node values.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_adjust_number_of_leaf_values(
+	     node,
+	     -1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to adjust number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	minimum_number_of_values = node_values->maximum_number_of_values / 2;
+
+	/* Rebalance the node and its parent nodes when they contain less than the minimum number of values
+	 * The separator value that refers to the removed value is replaced after the leaf node was
+	 * rebalanced, since only then the last value of the leaf node is known
+	 */
+	while( node != NULL )
+	{
+		if( libcdata_tree_node_get_parent_node(
+		     node,
+		     &parent_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent node.",
+			 function );
+
+			return( -1 );
+		}
+		if( parent_node == NULL )
+		{
+			break;
+		}
+		if( libcdata_btree_node_get_node_values(
+		     node,
+		     &node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve node values.",
+			 function );
+
+			return( -1 );
+		}
+		if( node_values->number_of_values < minimum_number_of_values )
+		{
+			if( libcdata_btree_node_get_sub_node_index(
+			     parent_node,
 			     node,
-			     (intptr_t **) &values_list,
+			     &sub_node_index,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve values list.",
+				 "%s: unable to retrieve sub node index of node in parent node.",
 				 function );
 
 				return( -1 );
 			}
-		}
-		/* If the sub node contains more than one values list elements
-		 * use the replacement value determined in the sub node
-		 */
-		else if( values_list_element != NULL )
-		{
-			if( replacement_value == NULL )
+			if( libcdata_btree_node_rebalance_sub_node(
+			     parent_node,
+			     sub_node_index,
+			     &node,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-				 "%s: invalid replacement value.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to rebalance sub node: %d of parent node.",
+				 function,
+				 sub_node_index );
 
 				return( -1 );
 			}
-			if( libcdata_list_element_set_value(
-			     values_list_element,
-			     replacement_value,
+		}
+		if( value_is_last_value != 0 )
+		{
+			if( libcdata_btree_node_get_node_values(
+			     node,
+			     &node_values,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set value in values list element.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve node values.",
 				 function );
 
 				return( -1 );
 			}
+			if( node_values->number_of_values > 0 )
+			{
+				replacement_key   = node_values->keys[ node_values->number_of_values - 1 ];
+				replacement_value = node_values->values[ node_values->number_of_values - 1 ];
+
+				if( libcdata_btree_node_replace_value(
+				     parent_node,
+				     value,
+				     replacement_value,
+				     replacement_key,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to replace separator value in parent node.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			value_is_last_value = 0;
 		}
+		node = parent_node;
 	}
-	/* In a leaf node remove the values list element from the list
+	/* If the root node contains a single sub node flatten the root node
 	 */
-	else if( values_list_element != NULL )
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_values->number_of_values == 0 )
+	 && ( node_values->number_of_sub_nodes == 1 ) )
 	{
-		if( libcdata_btree_values_list_replace_element_with_previous(
-		     values_list,
-		     &values_list_element,
-		     &replacement_value,
+		if( libcdata_btree_node_flatten_node(
+		     node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to replace values list element with previous.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to flatten root node.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	if( libcdata_tree_node_get_parent_node(
+	return( 1 );
+}
+
+/* Moves the values and sub nodes, starting at a specific index, to another B-tree node
+ * The values and sub nodes are appended to the destination node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_move_values(
+     libcdata_tree_node_t *node,
+     int value_index,
+     libcdata_tree_node_t *destination_node,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	static char *function                     = "libcdata_btree_node_move_values";
+	int move_index                            = 0;
+
+	if( libcdata_btree_node_get_node_values(
 	     node,
-	     &parent_node,
+	     &node_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve parent node.",
+		 "%s: unable to retrieve node values.",
 		 function );
 
 		return( -1 );
 	}
-	if( parent_node != NULL )
+	if( ( value_index < 0 )
+	 || ( value_index > node_values->number_of_values ) )
 	{
-		if( libcdata_btree_node_remove_value(
-		     parent_node,
-		     value,
-		     replacement_value,
-		     error ) == -1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( move_index = value_index;
+	     move_index < node_values->number_of_values;
+	     move_index++ )
+	{
+		if( libcdata_btree_node_append_value(
+		     destination_node,
+		     node_values->values[ move_index ],
+		     node_values->keys[ move_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value: %d to destination node.",
+			 function,
+			 move_index );
+
+			return( -1 );
+		}
+	}
+	for( move_index = value_index;
+	     move_index < node_values->number_of_sub_nodes;
+	     move_index++ )
+	{
+		sub_node = node_values->sub_nodes[ move_index ];
+
+		if( libcdata_tree_node_remove_node(
+		     node,
+		     sub_node,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove value from parent node.",
-			 function );
+			 "%s: unable to remove sub node: %d from node.",
+			 function,
+			 move_index );
+
+			return( -1 );
+		}
+		if( libcdata_btree_node_append_sub_node(
+		     destination_node,
+		     sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sub node: %d to destination node.",
+			 function,
+			 move_index );
 
 			return( -1 );
 		}
+		node_values->sub_nodes[ move_index ] = NULL;
 	}
-	return( result );
+	for( move_index = value_index;
+	     move_index < node_values->number_of_values;
+	     move_index++ )
+	{
+		node_values->keys[ move_index ]   = 0;
+		node_values->values[ move_index ] = NULL;
+	}
+	if( node_values->number_of_values > value_index )
+	{
+		node_values->number_of_values = value_index;
+	}
+	if( node_values->number_of_sub_nodes > value_index )
+	{
+		node_values->number_of_sub_nodes = value_index;
+	}
+	return( 1 );
 }
 
-/* Splits the node
+/* Splits the B-tree node
+ * The upper half of the values, and sub nodes, of the node are moved to a new node
+ * that is inserted into the parent node after the node together with a separator value
+ * If the node is the root node, the lower and upper halves are moved to new sub nodes
+ * of the node, so that the tree grows in height and the root node remains the same
  * Returns 1 if successful or -1 on error
  */
 int libcdata_btree_node_split(
      libcdata_tree_node_t *node,
      libcerror_error_t **error )
 {
-	libcdata_list_t *split_values_list           = NULL;
-	libcdata_list_t *values_list                 = NULL;
-	libcdata_list_element_t *values_list_element = NULL;
-	libcdata_tree_node_t *sub_node               = NULL;
-	intptr_t *values_list_value                  = NULL;
-	static char *function                        = "libcdata_btree_node_split";
-	int number_of_split_values_list_elements     = 0;
-	int number_of_sub_nodes                      = 0;
-	int number_of_values_list_elements           = 0;
-	int split_values_list_element_index          = 0;
-	int sub_node_index                           = 0;
-	int values_list_element_index                = 0;
-
-	if( node == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node.",
-		 function );
-
-		return( -1 );
-	}
-	if( libcdata_tree_node_get_number_of_sub_nodes(
+	libcdata_btree_node_values_t *node_values        = NULL;
+	libcdata_btree_node_values_t *parent_node_values = NULL;
+	libcdata_tree_node_t *lower_node                 = NULL;
+	libcdata_tree_node_t *next_node                  = NULL;
+	libcdata_tree_node_t *parent_node                = NULL;
+	libcdata_tree_node_t *upper_node                 = NULL;
+	intptr_t *separator_value                        = NULL;
+	static char *function                            = "libcdata_btree_node_split";
+	uint64_t separator_key                           = 0;
+	int lower_number_of_values                       = 0;
+	int sub_node_index                               = 0;
+	int upper_value_index                            = 0;
+
+	if( libcdata_btree_node_get_node_values(
 	     node,
-	     &number_of_sub_nodes,
+	     &node_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub nodes.",
+		 "%s: unable to retrieve node values.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( node_values->number_of_sub_nodes == 0 )
+	{
+		if( node_values->number_of_values < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: cannot split leaf node with less than 2 values.",
+			 function );
+
+			return( -1 );
+		}
+		/* The last value of the lower half of a leaf node is used as separator value
+		 */
+		lower_number_of_values = node_values->number_of_values - ( node_values->number_of_values / 2 );
+		separator_key          = node_values->keys[ lower_number_of_values - 1 ];
+		separator_value        = node_values->values[ lower_number_of_values - 1 ];
+		upper_value_index      = lower_number_of_values;
 	}
-	if( number_of_sub_nodes != 0 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: cannot split node with sub nodes.",
-		 function );
+		if( node_values->number_of_values < 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: cannot split branch node without values.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
+		/* The middle value of a branch node is moved to the parent node as separator value
+		 */
+		lower_number_of_values = node_values->number_of_values / 2;
+		separator_key          = node_values->keys[ lower_number_of_values ];
+		separator_value        = node_values->values[ lower_number_of_values ];
+		upper_value_index      = lower_number_of_values + 1;
 	}
-	if( libcdata_tree_node_get_value(
+	if( libcdata_tree_node_get_parent_node(
 	     node,
-	     (intptr_t **) &values_list,
+	     &parent_node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve values list.",
+		 "%s: unable to retrieve parent node.",
 		 function );
 
 		goto on_error;
 	}
-	/* Split to have about 25 values per sub node
-	 */
-	number_of_split_values_list_elements = 25;
+	if( parent_node != NULL )
+	{
+		if( libcdata_btree_node_get_node_values(
+		     parent_node,
+		     &parent_node_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent node values.",
+			 function );
 
-	if( libcdata_list_initialize(
-	     &split_values_list,
+			goto on_error;
+		}
+		if( libcdata_btree_node_get_sub_node_index(
+		     parent_node,
+		     node,
+		     &sub_node_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: unable to find node in parent node values.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( sub_node_index + 1 ) < parent_node_values->number_of_sub_nodes )
+		{
+			next_node = parent_node_values->sub_nodes[ sub_node_index + 1 ];
+		}
+	}
+	if( libcdata_btree_node_initialize(
+	     &upper_node,
+	     node_values->maximum_number_of_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create split values list.",
+		 "%s: unable to create upper node.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_tree_node_set_value(
+	if( libcdata_btree_node_move_values(
 	     node,
-	     (intptr_t *) split_values_list,
+	     upper_value_index,
+	     upper_node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set split values list.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to move upper values to upper node.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_list_get_number_of_elements(
-	     values_list,
-	     &number_of_values_list_elements,
+	if( libcdata_btree_node_update_number_of_leaf_values(
+	     upper_node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values list elements.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update number of leaf values of upper node.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_list_get_first_element(
-	     values_list,
-	     &values_list_element,
-	     error ) != 1 )
+	if( node_values->number_of_values > lower_number_of_values )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first values list element.",
-		 function );
+		if( libcdata_btree_node_values_remove_value(
+		     node_values,
+		     lower_number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove separator value from node values.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	for( values_list_element_index = 0;
-	     values_list_element_index < number_of_values_list_elements;
-	     values_list_element_index++ )
+	if( parent_node == NULL )
 	{
-		if( libcdata_list_element_get_value(
-		     values_list_element,
-		     &values_list_value,
+		if( libcdata_btree_node_initialize(
+		     &lower_node,
+		     node_values->maximum_number_of_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from values list element: %d.",
-			 function,
-			 values_list_element_index );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create lower node.",
+			 function );
 
 			goto on_error;
 		}
-		if( values_list_value == NULL )
+		if( libcdata_btree_node_move_values(
+		     node,
+		     0,
+		     lower_node,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid values list element: %d - missing value.",
-			 function,
-			 values_list_element_index );
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to move lower values to lower node.",
+			 function );
 
 			goto on_error;
 		}
-		if( sub_node == NULL )
+		if( libcdata_btree_node_update_number_of_leaf_values(
+		     lower_node,
+		     error ) != 1 )
 		{
-			if( libcdata_tree_node_initialize(
-			     &sub_node,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create sub node: %d.",
-				 function,
-				 sub_node_index );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update number of leaf values of lower node.",
+			 function );
 
-				goto on_error;
-			}
+			goto on_error;
 		}
 		if( libcdata_btree_node_append_value(
-		     sub_node,
-		     values_list_value,
+		     node,
+		     separator_value,
+		     separator_key,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append value: %d to sub node: %d.",
-			 function,
-			 values_list_element_index,
-			 sub_node_index );
+			 "%s: unable to append separator value to node.",
+			 function );
 
 			goto on_error;
 		}
-		if( values_list_element_index >= split_values_list_element_index )
+		if( libcdata_btree_node_append_sub_node(
+		     node,
+		     lower_node,
+		     error ) != 1 )
 		{
-			if( ( values_list_element_index + 1 ) < number_of_values_list_elements )
-			{
-				if( libcdata_list_append_value(
-				     split_values_list,
-				     values_list_value,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append value: %d to sub nodes values list.",
-					 function,
-					 values_list_element_index );
-
-					goto on_error;
-				}
-			}
-			split_values_list_element_index += number_of_split_values_list_elements;
-
-			if( libcdata_tree_node_append_node(
-			     node,
-			     sub_node,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append sub node: %d to node.",
-				 function,
-				 sub_node_index );
-
-				goto on_error;
-			}
-			sub_node = NULL;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append lower node to node.",
+			 function );
 
-			sub_node_index++;
+			goto on_error;
 		}
-		if( libcdata_list_element_get_next_element(
-		     values_list_element,
-		     &values_list_element,
+		lower_node = NULL;
+
+		if( libcdata_btree_node_append_sub_node(
+		     node,
+		     upper_node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next element from values list element: %d.",
-			 function,
-			 values_list_element_index );
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append upper node to node.",
+			 function );
 
 			goto on_error;
 		}
+		upper_node = NULL;
 	}
-	if( sub_node != NULL )
+	else
 	{
-		if( libcdata_tree_node_append_node(
+		if( libcdata_btree_node_update_number_of_leaf_values(
 		     node,
-		     sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update number of leaf values of node.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_internal_tree_node_insert_node_before_sub_node_with_lock(
+		     parent_node,
+		     next_node,
+		     upper_node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append sub node: %d to node.",
-			 function,
-			 sub_node_index );
+			 "%s: unable to insert upper node in parent node.",
+			 function );
 
 			goto on_error;
 		}
-		sub_node = NULL;
+		if( libcdata_btree_node_values_insert_sub_node(
+		     parent_node_values,
+		     sub_node_index + 1,
+		     upper_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert upper node in parent node values.",
+			 function );
 
-		sub_node_index++;
-	}
-	split_values_list = NULL;
+			libcdata_tree_node_remove_node(
+			 parent_node,
+			 upper_node,
+			 NULL );
 
-	if( libcdata_list_free(
-	     &values_list,
-	     NULL,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free values list.",
-		 function );
+			goto on_error;
+		}
+		upper_node = NULL;
 
-		goto on_error;
+		if( libcdata_btree_node_values_insert_value(
+		     parent_node_values,
+		     sub_node_index,
+		     separator_value,
+		     separator_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert separator value in parent node values.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( 1 );
 
 on_error:
-	if( sub_node != NULL )
+	if( lower_node != NULL )
 	{
-		libcdata_tree_node_remove_node(
-		 node,
-		 sub_node,
-		 NULL );
-		libcdata_tree_node_free(
-		 &sub_node,
-		 NULL,
+		libcdata_btree_node_free(
+		 &lower_node,
 		 NULL );
 	}
-	if( split_values_list != NULL )
+	if( upper_node != NULL )
 	{
-		libcdata_tree_node_empty(
-		 node,
-		 NULL,
-		 NULL );
-		libcdata_tree_node_set_value(
-		 node,
-		 (intptr_t *) values_list,
-		 NULL );
-		libcdata_list_free(
-		 &split_values_list,
-		 NULL,
+		libcdata_btree_node_free(
+		 &upper_node,
 		 NULL );
 	}
 	return( -1 );
 }
 
+/* Retrieves statistics of the B-tree node and its sub nodes
+ * The height is set to the largest depth of the leaf nodes, where the node
+ * is at the specified depth, and the number of nodes and leaf nodes are incremented
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_get_statistics(
+     libcdata_tree_node_t *node,
+     int depth,
+     int *height,
+     int *number_of_nodes,
+     int *number_of_leaf_nodes,
+     libcerror_error_t **error )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	static char *function                     = "libcdata_btree_node_get_statistics";
+	int sub_node_index                        = 0;
+
+	if( height == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid height.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_node_get_node_values(
+	     node,
+	     &node_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_nodes += 1;
+
+	if( node_values->number_of_sub_nodes == 0 )
+	{
+		*number_of_leaf_nodes += 1;
+
+		if( depth > *height )
+		{
+			*height = depth;
+		}
+		return( 1 );
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < node_values->number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libcdata_btree_node_get_statistics(
+		     node_values->sub_nodes[ sub_node_index ],
+		     depth + 1,
+		     height,
+		     number_of_nodes,
+		     number_of_leaf_nodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve statistics of sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
 
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libcdata_btree_node_values.h"
 #include "libcdata_libcerror.h"
 #include "libcdata_types.h"
 
@@ -32,6 +33,26 @@
 extern "C" {
 #endif
 
+int libcdata_btree_node_initialize(
+     libcdata_tree_node_t **node,
+     int maximum_number_of_values,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_free(
+     libcdata_tree_node_t **node,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_get_node_values(
+     libcdata_tree_node_t *node,
+     libcdata_btree_node_values_t **node_values,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_get_value_by_index(
+     libcdata_tree_node_t *node,
+     int value_index,
+     intptr_t **value,
+     libcerror_error_t **error );
+
 int libcdata_btree_node_get_sub_node_by_value(
      libcdata_tree_node_t *node,
      intptr_t *value,
@@ -40,7 +61,7 @@ int libcdata_btree_node_get_sub_node_by_value(
             intptr_t *second_value,
             libcerror_error_t **error ),
      libcdata_tree_node_t **sub_node,
-     libcdata_list_element_t **values_list_element,
+     int *value_index,
      libcerror_error_t **error );
 
 int libcdata_btree_node_get_upper_node_by_value(
@@ -51,12 +72,57 @@ int libcdata_btree_node_get_upper_node_by_value(
             intptr_t *second_value,
             libcerror_error_t **error ),
      libcdata_tree_node_t **upper_node,
-     libcdata_list_element_t **values_list_element,
+     int *value_index,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_get_sub_node_by_key(
+     libcdata_tree_node_t *node,
+     uint64_t key,
+     libcdata_tree_node_t **sub_node,
+     int *value_index,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_get_upper_node_by_key(
+     libcdata_tree_node_t *node,
+     uint64_t key,
+     libcdata_tree_node_t **upper_node,
+     int *value_index,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_get_value_by_rank(
+     libcdata_tree_node_t *node,
+     int rank,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_get_rank_of_value(
+     libcdata_tree_node_t *node,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     int *rank,
      libcerror_error_t **error );
 
 int libcdata_btree_node_append_value(
      libcdata_tree_node_t *node,
      intptr_t *value,
+     uint64_t key,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_append_sub_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *sub_node,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_update_number_of_leaf_values(
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_adjust_number_of_leaf_values(
+     libcdata_tree_node_t *node,
+     int difference,
      libcerror_error_t **error );
 
 int libcdata_btree_node_insert_value(
@@ -68,31 +134,78 @@ int libcdata_btree_node_insert_value(
             libcerror_error_t **error ),
      libcerror_error_t **error );
 
+int libcdata_btree_node_insert_value_by_key(
+     libcdata_tree_node_t *node,
+     uint64_t key,
+     intptr_t *value,
+     libcerror_error_t **error );
+
 int libcdata_btree_node_replace_value(
      libcdata_tree_node_t *node,
      intptr_t *value,
      intptr_t *replacement_value,
+     uint64_t replacement_key,
      libcerror_error_t **error );
 
 int libcdata_btree_node_flatten_node(
-     libcdata_tree_node_t **node,
+     libcdata_tree_node_t *node,
      libcerror_error_t **error );
 
 int libcdata_btree_node_remove_sub_node(
      libcdata_tree_node_t *node,
-     libcdata_tree_node_t **sub_node,
+     int sub_node_index,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_get_sub_node_index(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *sub_node,
+     int *sub_node_index,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_borrow_from_previous_sub_node(
+     libcdata_tree_node_t *node,
+     int sub_node_index,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_borrow_from_next_sub_node(
+     libcdata_tree_node_t *node,
+     int sub_node_index,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_merge_sub_nodes(
+     libcdata_tree_node_t *node,
+     int sub_node_index,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_rebalance_sub_node(
+     libcdata_tree_node_t *node,
+     int sub_node_index,
+     libcdata_tree_node_t **rebalanced_sub_node,
      libcerror_error_t **error );
 
 int libcdata_btree_node_remove_value(
      libcdata_tree_node_t *node,
      intptr_t *value,
-     intptr_t *replacement_value,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_move_values(
+     libcdata_tree_node_t *node,
+     int value_index,
+     libcdata_tree_node_t *destination_node,
      libcerror_error_t **error );
 
 int libcdata_btree_node_split(
      libcdata_tree_node_t *node,
      libcerror_error_t **error );
 
+int libcdata_btree_node_get_statistics(
+     libcdata_tree_node_t *node,
+     int depth,
+     int *height,
+     int *number_of_nodes,
+     int *number_of_leaf_nodes,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,620 @@
+/*
+ * Balanced tree node values functions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdata_btree_node_values.h"
+#include "libcdata_definitions.h"
+#include "libcdata_libcerror.h"
+#include "libcdata_types.h"
+
+/* Creates node values
+ * Make sure the value node_values is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_values_initialize(
+     libcdata_btree_node_values_t **node_values,
+     int maximum_number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function          = "libcdata_btree_node_values_initialize";
+	size_t keys_offset             = 0;
+	size_t node_values_size        = 0;
+	int number_of_allocated_values = 0;
+
+	if( node_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_values <= 0 )
+	 || ( maximum_number_of_values > (int) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( sizeof( uint64_t ) + ( 2 * sizeof( intptr_t * ) ) ) ) - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_allocated_values = maximum_number_of_values + 1;
+
+	/* Make sure the keys are 64-bit aligned
+	 */
+	keys_offset = sizeof( libcdata_btree_node_values_t );
+
+	if( ( keys_offset % sizeof( uint64_t ) ) != 0 )
+	{
+		keys_offset += sizeof( uint64_t ) - ( keys_offset % sizeof( uint64_t ) );
+	}
+	node_values_size = keys_offset
+	                 + ( sizeof( uint64_t ) * number_of_allocated_values )
+	                 + ( sizeof( intptr_t * ) * number_of_allocated_values )
+	                 + ( sizeof( libcdata_tree_node_t * ) * ( number_of_allocated_values + 1 ) );
+
+	*node_values = (libcdata_btree_node_values_t *) memory_allocate(
+	                                                 node_values_size );
+
+	if( *node_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *node_values,
+	     0,
+	     node_values_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear node values.",
+		 function );
+
+		memory_free(
+		 *node_values );
+
+		*node_values = NULL;
+
+		return( -1 );
+	}
+	( *node_values )->maximum_number_of_values = maximum_number_of_values;
+	( *node_values )->keys                     = (uint64_t *) &( ( (uint8_t *) *node_values )[ keys_offset ] );
+	( *node_values )->values                   = (intptr_t **) &( ( ( *node_values )->keys )[ number_of_allocated_values ] );
+	( *node_values )->sub_nodes                = (libcdata_tree_node_t **) &( ( ( *node_values )->values )[ number_of_allocated_values ] );
+
+	return( 1 );
+}
+
+/* Frees node values
+ * The values and sub nodes are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_values_free(
+     libcdata_btree_node_values_t **node_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_btree_node_values_free";
+
+	if( node_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node_values != NULL )
+	{
+		memory_free(
+		 *node_values );
+
+		*node_values = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of a specific value using a binary search
+ *
+ * Uses the value_compare_function to determine the similarity of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * Returns 1 if successful, 0 if the value does not exist or -1 on error
+ * If the value exists value_index is set to the index of the value otherwise
+ * it is set to the index of the first value that is greater than the value
+ * or the number of values if there is no such value
+ */
+int libcdata_btree_node_values_get_value_index(
+     libcdata_btree_node_values_t *node_values,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     int *value_index,
+     libcerror_error_t **error )
+{
+	intptr_t *node_value  = NULL;
+	static char *function = "libcdata_btree_node_values_get_value_index";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int result            = 0;
+	int upper_index       = 0;
+
+	if( node_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_compare_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value compare function.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = node_values->number_of_values;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		node_value = node_values->values[ middle_index ];
+
+		if( node_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid node values - missing value: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		result = value_compare_function(
+		          value,
+		          node_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare value with node value: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		else if( result == LIBCDATA_COMPARE_EQUAL )
+		{
+			*value_index = middle_index;
+
+			return( 1 );
+		}
+		else if( result == LIBCDATA_COMPARE_LESS )
+		{
+			upper_index = middle_index;
+		}
+		else if( result == LIBCDATA_COMPARE_GREATER )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value compare function return value: %d.",
+			 function,
+			 result );
+
+			return( -1 );
+		}
+	}
+	*value_index = lower_index;
+
+	return( 0 );
+}
+
+/* Retrieves the index of a specific key
+ * The search range is narrowed down using a binary search, the keys in the remaining
+ * range are counted without branches so that the compiler can vectorize the comparisons
+ *
+ * Returns 1 if successful, 0 if the key does not exist or -1 on error
+ * If the key exists key_index is set to the index of the key otherwise
+ * it is set to the index of the first key that is greater than the key
+ * or the number of values if there is no such key
+ */
+int libcdata_btree_node_values_get_key_index(
+     libcdata_btree_node_values_t *node_values,
+     uint64_t key,
+     int *key_index,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcdata_btree_node_values_get_key_index";
+	int key_iterator         = 0;
+	int lower_index          = 0;
+	int middle_index         = 0;
+	int number_of_lower_keys = 0;
+	int upper_index          = 0;
+
+	if( node_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key index.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = node_values->number_of_values;
+
+	while( ( upper_index - lower_index ) > 16 )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( node_values->keys[ middle_index ] < key )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	for( key_iterator = lower_index;
+	     key_iterator < upper_index;
+	     key_iterator++ )
+	{
+		number_of_lower_keys += (int) ( node_values->keys[ key_iterator ] < key );
+	}
+	*key_index = lower_index + number_of_lower_keys;
+
+	if( ( *key_index < node_values->number_of_values )
+	 && ( node_values->keys[ *key_index ] == key ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Inserts a value and its key at a specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_values_insert_value(
+     libcdata_btree_node_values_t *node_values,
+     int value_index,
+     intptr_t *value,
+     uint64_t key,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_btree_node_values_insert_value";
+	int value_iterator    = 0;
+
+	if( node_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_index < 0 )
+	 || ( value_index > node_values->number_of_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_values->number_of_values > node_values->maximum_number_of_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_iterator = node_values->number_of_values;
+	     value_iterator > value_index;
+	     value_iterator-- )
+	{
+		node_values->keys[ value_iterator ]   = node_values->keys[ value_iterator - 1 ];
+		node_values->values[ value_iterator ] = node_values->values[ value_iterator - 1 ];
+	}
+	node_values->keys[ value_index ]   = key;
+	node_values->values[ value_index ] = value;
+
+	node_values->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Removes a value at a specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_values_remove_value(
+     libcdata_btree_node_values_t *node_values,
+     int value_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_btree_node_values_remove_value";
+	int value_iterator    = 0;
+
+	if( node_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_index < 0 )
+	 || ( value_index >= node_values->number_of_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	node_values->number_of_values -= 1;
+
+	for( value_iterator = value_index;
+	     value_iterator < node_values->number_of_values;
+	     value_iterator++ )
+	{
+		node_values->keys[ value_iterator ]   = node_values->keys[ value_iterator + 1 ];
+		node_values->values[ value_iterator ] = node_values->values[ value_iterator + 1 ];
+	}
+	node_values->keys[ node_values->number_of_values ]   = 0;
+	node_values->values[ node_values->number_of_values ] = NULL;
+
+	return( 1 );
+}
+
+/* Inserts a sub node at a specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_values_insert_sub_node(
+     libcdata_btree_node_values_t *node_values,
+     int sub_node_index,
+     libcdata_tree_node_t *sub_node,
+     libcerror_error_t **error )
+{
+	static char *function  = "libcdata_btree_node_values_insert_sub_node";
+	int sub_node_iterator = 0;
+
+	if( node_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_node_index < 0 )
+	 || ( sub_node_index > node_values->number_of_sub_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_values->number_of_sub_nodes > ( node_values->maximum_number_of_values + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of sub nodes value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_node_iterator = node_values->number_of_sub_nodes;
+	     sub_node_iterator > sub_node_index;
+	     sub_node_iterator-- )
+	{
+		node_values->sub_nodes[ sub_node_iterator ] = node_values->sub_nodes[ sub_node_iterator - 1 ];
+	}
+	node_values->sub_nodes[ sub_node_index ] = sub_node;
+
+	node_values->number_of_sub_nodes += 1;
+
+	return( 1 );
+}
+
+/* Removes a sub node at a specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_btree_node_values_remove_sub_node(
+     libcdata_btree_node_values_t *node_values,
+     int sub_node_index,
+     libcerror_error_t **error )
+{
+	static char *function  = "libcdata_btree_node_values_remove_sub_node";
+	int sub_node_iterator = 0;
+
+	if( node_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_node_index < 0 )
+	 || ( sub_node_index >= node_values->number_of_sub_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	node_values->number_of_sub_nodes -= 1;
+
+	for( sub_node_iterator = sub_node_index;
+	     sub_node_iterator < node_values->number_of_sub_nodes;
+	     sub_node_iterator++ )
+	{
+		node_values->sub_nodes[ sub_node_iterator ] = node_values->sub_nodes[ sub_node_iterator + 1 ];
+	}
+	node_values->sub_nodes[ node_values->number_of_sub_nodes ] = NULL;
+
+	return( 1 );
+}
+
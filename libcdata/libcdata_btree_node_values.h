@@ -0,0 +1,130 @@
+/*
+ * Balanced tree node values functions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATA_BTREE_NODE_VALUES_H )
+#define _LIBCDATA_BTREE_NODE_VALUES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdata_libcerror.h"
+#include "libcdata_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The values of a balanced tree node
+ * The keys, values and sub nodes are stored in arrays that are allocated
+ * together with the structure in a single allocation
+ */
+typedef struct libcdata_btree_node_values libcdata_btree_node_values_t;
+
+struct libcdata_btree_node_values
+{
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The number of sub nodes, which is either 0 or the number of values + 1
+	 */
+	int number_of_sub_nodes;
+
+	/* The maximum number of values
+	 * A node can contain one value more than the maximum number of values
+	 * before it is split, the arrays are allocated accordingly
+	 */
+	int maximum_number_of_values;
+
+	/* The number of values in the leaf nodes of the (sub) tree of the node
+	 * which is used to determine the rank of a value
+	 */
+	int number_of_leaf_values;
+
+	/* The keys
+	 * The key at a specific index is the 64-bit key of the value at the same index,
+	 * which is only used by trees that are indexed by key
+	 */
+	uint64_t *keys;
+
+	/* The values
+	 */
+	intptr_t **values;
+
+	/* The sub nodes
+	 */
+	libcdata_tree_node_t **sub_nodes;
+};
+
+int libcdata_btree_node_values_initialize(
+     libcdata_btree_node_values_t **node_values,
+     int maximum_number_of_values,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_values_free(
+     libcdata_btree_node_values_t **node_values,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_values_get_value_index(
+     libcdata_btree_node_values_t *node_values,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     int *value_index,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_values_get_key_index(
+     libcdata_btree_node_values_t *node_values,
+     uint64_t key,
+     int *key_index,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_values_insert_value(
+     libcdata_btree_node_values_t *node_values,
+     int value_index,
+     intptr_t *value,
+     uint64_t key,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_values_remove_value(
+     libcdata_btree_node_values_t *node_values,
+     int value_index,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_values_insert_sub_node(
+     libcdata_btree_node_values_t *node_values,
+     int sub_node_index,
+     libcdata_tree_node_t *sub_node,
+     libcerror_error_t **error );
+
+int libcdata_btree_node_values_remove_sub_node(
+     libcdata_btree_node_values_t *node_values,
+     int sub_node_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATA_BTREE_NODE_VALUES_H ) */
+
@@ -169,6 +169,11 @@ int libcdata_range_list_free(
 
 			result = -1;
 		}
+		if( internal_range_list->elements != NULL )
+		{
+			memory_free(
+			 internal_range_list->elements );
+		}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 		if( libcthreads_read_write_lock_free(
 		     &( internal_range_list->read_write_lock ),
@@ -408,8 +413,16 @@ int libcdata_range_list_empty(
 			}
 			list_element = next_element;
 		}
-		internal_range_list->current_element       = NULL;
-		internal_range_list->current_element_index = 0;
+		/* Remove the freed elements from the elements array
+		 */
+		number_of_elements -= internal_range_list->number_of_elements;
+
+		for( element_index = 0;
+		     element_index < internal_range_list->number_of_elements;
+		     element_index++ )
+		{
+			internal_range_list->elements[ element_index ] = internal_range_list->elements[ element_index + number_of_elements ];
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -1038,6 +1051,403 @@ on_error:
 	return( -1 );
 }
 
+/* Resizes the elements array
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_range_list_resize_elements(
+     libcdata_internal_range_list_t *internal_range_list,
+     int number_of_elements,
+     libcerror_error_t **error )
+{
+	void *reallocation               = NULL;
+	static char *function            = "libcdata_internal_range_list_resize_elements";
+	int number_of_allocated_elements = 0;
+
+	if( internal_range_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range list.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_elements < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of elements value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_elements > internal_range_list->number_of_allocated_elements )
+	{
+		/* Grow by half of the number of elements, in blocks of 16 entries,
+		 * to keep the number of reallocations low when a large number
+		 * of ranges is inserted
+		 */
+		if( number_of_elements >= (int) ( ( INT_MAX - 16 ) / 3 * 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of elements value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_allocated_elements = number_of_elements + ( number_of_elements / 2 );
+		number_of_allocated_elements = ( number_of_allocated_elements & ~( 15 ) ) + 16;
+
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+		if( (size_t) number_of_allocated_elements > (size_t) ( SSIZE_MAX / sizeof( libcdata_list_element_t * ) ) )
+#else
+		if( number_of_allocated_elements > (int) ( SSIZE_MAX / sizeof( libcdata_list_element_t * ) ) )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated elements value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                internal_range_list->elements,
+		                sizeof( libcdata_list_element_t * ) * number_of_allocated_elements );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize elements.",
+			 function );
+
+			return( -1 );
+		}
+		internal_range_list->elements                     = (libcdata_list_element_t **) reallocation;
+		internal_range_list->number_of_allocated_elements = number_of_allocated_elements;
+	}
+	return( 1 );
+}
+
+/* Inserts an element in the elements array at a specific index
+ * The elements array should be resized before the element is inserted in the list,
+ * so that inserting the element in the elements array afterwards does not fail
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_range_list_insert_elements_entry(
+     libcdata_internal_range_list_t *internal_range_list,
+     int element_index,
+     libcdata_list_element_t *element,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_internal_range_list_insert_elements_entry";
+	int entry_iterator    = 0;
+
+	if( internal_range_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element_index < 0 )
+	 || ( element_index > internal_range_list->number_of_elements ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_internal_range_list_resize_elements(
+	     internal_range_list,
+	     internal_range_list->number_of_elements + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_iterator = internal_range_list->number_of_elements;
+	     entry_iterator > element_index;
+	     entry_iterator-- )
+	{
+		internal_range_list->elements[ entry_iterator ] = internal_range_list->elements[ entry_iterator - 1 ];
+	}
+	internal_range_list->elements[ element_index ] = element;
+
+	internal_range_list->number_of_elements += 1;
+
+	return( 1 );
+}
+
+/* Removes an element from the elements array at a specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_range_list_remove_elements_entry(
+     libcdata_internal_range_list_t *internal_range_list,
+     int element_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_internal_range_list_remove_elements_entry";
+	int entry_iterator    = 0;
+
+	if( internal_range_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element_index < 0 )
+	 || ( element_index >= internal_range_list->number_of_elements ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_iterator = element_index;
+	     entry_iterator < ( internal_range_list->number_of_elements - 1 );
+	     entry_iterator++ )
+	{
+		internal_range_list->elements[ entry_iterator ] = internal_range_list->elements[ entry_iterator + 1 ];
+	}
+	internal_range_list->elements[ entry_iterator ] = NULL;
+
+	internal_range_list->number_of_elements -= 1;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the last element with a range start less than or equal to the range offset
+ * The element index is set to -1 if the range offset is before the range of the first element
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_range_list_get_index_at_offset(
+     libcdata_internal_range_list_t *internal_range_list,
+     uint64_t range_offset,
+     int *element_index,
+     libcerror_error_t **error )
+{
+	libcdata_range_list_value_t *range_list_value = NULL;
+	static char *function                         = "libcdata_internal_range_list_get_index_at_offset";
+	int lower_element_index                       = 0;
+	int middle_element_index                      = 0;
+	int upper_element_index                       = 0;
+
+	if( internal_range_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range list.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The ranges in the list do not overlap, hence the elements are sorted by range start
+	 */
+	upper_element_index = internal_range_list->number_of_elements;
+
+	while( lower_element_index < upper_element_index )
+	{
+		middle_element_index = lower_element_index + ( ( upper_element_index - lower_element_index ) / 2 );
+
+		if( libcdata_list_element_get_value(
+		     internal_range_list->elements[ middle_element_index ],
+		     (intptr_t **) &range_list_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from list element: %d.",
+			 function,
+			 middle_element_index );
+
+			return( -1 );
+		}
+		if( range_list_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing range list value element: %d.",
+			 function,
+			 middle_element_index );
+
+			return( -1 );
+		}
+		if( range_offset < range_list_value->start )
+		{
+			upper_element_index = middle_element_index;
+		}
+		else
+		{
+			lower_element_index = middle_element_index + 1;
+		}
+	}
+	*element_index = lower_element_index - 1;
+
+	return( 1 );
+}
+
+/* Retrieves the index of a specific element
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_range_list_get_index_of_element(
+     libcdata_internal_range_list_t *internal_range_list,
+     libcdata_list_element_t *element,
+     int *element_index,
+     libcerror_error_t **error )
+{
+	libcdata_range_list_value_t *range_list_value = NULL;
+	static char *function                         = "libcdata_internal_range_list_get_index_of_element";
+	int entry_iterator                            = 0;
+
+	if( internal_range_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range list.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_element_get_value(
+	     element,
+	     (intptr_t **) &range_list_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from element.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_list_value != NULL )
+	{
+		if( libcdata_internal_range_list_get_index_at_offset(
+		     internal_range_list,
+		     range_list_value->start,
+		     &entry_iterator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element index for range offset: %" PRIu64 ".",
+			 function,
+			 range_list_value->start );
+
+			return( -1 );
+		}
+		if( ( entry_iterator >= 0 )
+		 && ( internal_range_list->elements[ entry_iterator ] == element ) )
+		{
+			*element_index = entry_iterator;
+
+			return( 1 );
+		}
+	}
+	/* Fall back to a linear search if the element cannot be found by its range start
+	 */
+	for( entry_iterator = 0;
+	     entry_iterator < internal_range_list->number_of_elements;
+	     entry_iterator++ )
+	{
+		if( internal_range_list->elements[ entry_iterator ] == element )
+		{
+			*element_index = entry_iterator;
+
+			return( 1 );
+		}
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+	 "%s: missing element.",
+	 function );
+
+	return( -1 );
+}
+
 /* Append a list element to the list
  * Returns 1 if successful or -1 on error
  */
@@ -1070,6 +1480,20 @@ int libcdata_internal_range_list_append_element(
 
 		return( -1 );
 	}
+	if( libcdata_internal_range_list_resize_elements(
+	     internal_range_list,
+	     internal_range_list->number_of_elements + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize elements.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_range_list->first_element == NULL )
 	{
 		internal_range_list->first_element = element;
@@ -1088,8 +1512,21 @@ int libcdata_internal_range_list_append_element(
 
 		return( -1 );
 	}
-	internal_range_list->number_of_elements += 1;
+	if( libcdata_internal_range_list_insert_elements_entry(
+	     internal_range_list,
+	     internal_range_list->number_of_elements,
+	     element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert element in elements array.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -1170,6 +1607,7 @@ int libcdata_internal_range_list_remove_element(
 	libcdata_list_element_t *next_element     = NULL;
 	libcdata_list_element_t *previous_element = NULL;
 	static char *function                     = "libcdata_internal_range_list_remove_element";
+	int element_index                         = 0;
 
 	if( internal_range_list == NULL )
 	{
@@ -1182,6 +1620,21 @@ int libcdata_internal_range_list_remove_element(
 
 		return( -1 );
 	}
+	if( libcdata_internal_range_list_get_index_of_element(
+	     internal_range_list,
+	     range_list_element,
+	     &element_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index of range list element.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_list_element_get_elements(
 	     range_list_element,
 	     &previous_element,
@@ -1254,11 +1707,21 @@ int libcdata_internal_range_list_remove_element(
 
 		return( -1 );
 	}
-	internal_range_list->current_element       = NULL;
-	internal_range_list->current_element_index = 0;
-
-	internal_range_list->number_of_elements -= 1;
+	if( libcdata_internal_range_list_remove_elements_entry(
+	     internal_range_list,
+	     element_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove element: %d from elements array.",
+		 function,
+		 element_index );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -1373,11 +1836,9 @@ int libcdata_internal_range_list_insert_range_find_element(
      libcerror_error_t **error )
 {
 	libcdata_list_element_t *current_element      = NULL;
-	libcdata_list_element_t *previous_element     = NULL;
 	libcdata_range_list_value_t *range_list_value = NULL;
 	static char *function                         = "libcdata_internal_range_list_insert_range_find_element";
 	int current_element_index                     = 0;
-	int last_element_index                        = 0;
 
 	LIBCDATA_UNREFERENCED_PARAMETER( range_end )
 
@@ -1414,17 +1875,14 @@ int libcdata_internal_range_list_insert_range_find_element(
 
 		return( -1 );
 	}
-	current_element       = internal_range_list->last_element;
 	current_element_index = internal_range_list->number_of_elements;
 
 	if( internal_range_list->number_of_elements > 0 )
 	{
 		/* Check the last element first, most often the list will be filled linear
 		 */
-		current_element_index--;
-
 		if( libcdata_list_element_get_value(
-		     current_element,
+		     internal_range_list->last_element,
 		     (intptr_t **) &range_list_value,
 		     error ) != 1 )
 		{
@@ -1434,7 +1892,7 @@ int libcdata_internal_range_list_insert_range_find_element(
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 			 "%s: unable to retrieve value from list element: %d.",
 			 function,
-			 current_element_index );
+			 current_element_index - 1 );
 
 			return( -1 );
 		}
@@ -1446,30 +1904,45 @@ int libcdata_internal_range_list_insert_range_find_element(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: missing range list value element: %d.",
 			 function,
-			 current_element_index );
+			 current_element_index - 1 );
 
 			return( -1 );
 		}
-		if( range_start > range_list_value->end )
+		if( range_start <= range_list_value->end )
 		{
-			current_element = NULL;
-
-			current_element_index++;
-		}
-		else if( internal_range_list->number_of_elements > 1 )
-		{
-			last_element_index = current_element_index;
+			/* The element is the first element that ends at or after the range start,
+			 * which is either the last element that starts before the range start
+			 * or the element after it
+			 */
+			current_element_index = -1;
 
-			if( ( current_element_index != internal_range_list->current_element_index )
-			 && ( internal_range_list->current_element != NULL ) )
+			if( range_start > 0 )
 			{
-				/* Check the current element
-				 */
-				current_element       = internal_range_list->current_element;
-				current_element_index = internal_range_list->current_element_index;
+				if( libcdata_internal_range_list_get_index_at_offset(
+				     internal_range_list,
+				     range_start - 1,
+				     &current_element_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve element index for range offset: %" PRIu64 ".",
+					 function,
+					 range_start - 1 );
 
+					return( -1 );
+				}
+			}
+			if( current_element_index < 0 )
+			{
+				current_element_index = 0;
+			}
+			else
+			{
 				if( libcdata_list_element_get_value(
-				     current_element,
+				     internal_range_list->elements[ current_element_index ],
 				     (intptr_t **) &range_list_value,
 				     error ) != 1 )
 				{
@@ -1495,128 +1968,14 @@ int libcdata_internal_range_list_insert_range_find_element(
 
 					return( -1 );
 				}
-			}
-			if( range_start > range_list_value->end )
-			{
-				while( current_element_index < last_element_index )
+				if( range_start > range_list_value->end )
 				{
-					if( libcdata_list_element_get_next_element(
-					     current_element,
-					     &current_element,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve next element from list element: %d.",
-						 function,
-						 current_element_index );
-
-						return( -1 );
-					}
 					current_element_index++;
-
-					if( libcdata_list_element_get_value(
-					     current_element,
-					     (intptr_t **) &range_list_value,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve value from list element: %d.",
-						 function,
-						 current_element_index );
-
-						return( -1 );
-					}
-					if( range_list_value == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing range list value element: %d.",
-						 function,
-						 current_element_index );
-
-						return( -1 );
-					}
-					if( range_start <= range_list_value->end )
-					{
-						break;
-					}
-				}
-			}
-			else
-			{
-				while( current_element_index > 0 )
-				{
-					previous_element = current_element;
-
-					if( libcdata_list_element_get_previous_element(
-					     current_element,
-					     &current_element,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve previous element from list element: %d.",
-						 function,
-						 current_element_index );
-
-						return( -1 );
-					}
-					current_element_index--;
-
-					if( libcdata_list_element_get_value(
-					     current_element,
-					     (intptr_t **) &range_list_value,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve value from list element: %d.",
-						 function,
-						 current_element_index );
-
-						return( -1 );
-					}
-					if( range_list_value == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing range list value element: %d.",
-						 function,
-						 current_element_index );
-
-						return( -1 );
-					}
-					if( range_start > range_list_value->end )
-					{
-						current_element = previous_element;
-
-						current_element_index++;
-
-						break;
-					}
 				}
 			}
+			current_element = internal_range_list->elements[ current_element_index ];
 		}
 	}
-	if( current_element != NULL )
-	{
-		internal_range_list->current_element       = current_element;
-		internal_range_list->current_element_index = current_element_index;
-	}
 	*element       = current_element;
 	*element_index = current_element_index;
 
@@ -1704,6 +2063,7 @@ int libcdata_internal_range_list_insert_range_before_element(
 	libcdata_list_element_t *previous_element         = NULL;
 	libcdata_range_list_value_t *new_range_list_value = NULL;
 	static char *function                             = "libcdata_internal_range_list_insert_range_before_element";
+	int element_index                                 = 0;
 
 	if( internal_range_list == NULL )
 	{
@@ -1741,8 +2101,41 @@ int libcdata_internal_range_list_insert_range_before_element(
 			 "%s: unable to retrieve previous element from range list element.",
 			 function );
 
-			return( -1 );
-		}
+			return( -1 );
+		}
+		if( libcdata_internal_range_list_get_index_of_element(
+		     internal_range_list,
+		     range_list_element,
+		     &element_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve index of range list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		element_index = internal_range_list->number_of_elements;
+	}
+	if( libcdata_internal_range_list_resize_elements(
+	     internal_range_list,
+	     internal_range_list->number_of_elements + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize elements.",
+		 function );
+
+		return( -1 );
 	}
 	if( libcdata_range_list_value_initialize(
 	     &new_range_list_value,
@@ -1878,11 +2271,22 @@ int libcdata_internal_range_list_insert_range_before_element(
 			goto on_error;
 		}
 	}
-	internal_range_list->current_element       = NULL;
-	internal_range_list->current_element_index = 0;
-
-	internal_range_list->number_of_elements += 1;
+	if( libcdata_internal_range_list_insert_elements_entry(
+	     internal_range_list,
+	     element_index,
+	     new_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert element: %d in elements array.",
+		 function,
+		 element_index );
 
+		goto on_error;
+	}
 	*new_range_list_element = new_element;
 
 	return( 1 );
@@ -1922,6 +2326,13 @@ on_error:
 		 previous_element,
 		 NULL );
 	}
+	else if( backup_last_element != NULL )
+	{
+		libcdata_list_element_set_next_element(
+		 backup_last_element,
+		 NULL,
+		 NULL );
+	}
 	internal_range_list->first_element = backup_first_element;
 	internal_range_list->last_element  = backup_last_element;
 
@@ -1941,6 +2352,7 @@ int libcdata_internal_range_list_insert_element_after_element(
 	libcdata_list_element_t *next_element     = NULL;
 	libcdata_list_element_t *previous_element = NULL;
 	static char *function                     = "libcdata_internal_range_list_insert_element_after_element";
+	int element_index                         = 0;
 
 	if( internal_range_list == NULL )
 	{
@@ -1980,6 +2392,40 @@ int libcdata_internal_range_list_insert_element_after_element(
 
 		return( -1 );
 	}
+	if( ( internal_range_list->number_of_elements > 0 )
+	 && ( range_list_element != NULL ) )
+	{
+		if( libcdata_internal_range_list_get_index_of_element(
+		     internal_range_list,
+		     range_list_element,
+		     &element_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve index of range list element.",
+			 function );
+
+			return( -1 );
+		}
+		element_index += 1;
+	}
+	if( libcdata_internal_range_list_resize_elements(
+	     internal_range_list,
+	     internal_range_list->number_of_elements + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize elements.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_range_list->number_of_elements == 0 )
 	{
 		if( internal_range_list->first_element != NULL )
@@ -2127,8 +2573,22 @@ int libcdata_internal_range_list_insert_element_after_element(
 			}
 		}
 	}
-	internal_range_list->number_of_elements += 1;
+	if( libcdata_internal_range_list_insert_elements_entry(
+	     internal_range_list,
+	     element_index,
+	     element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert element: %d in elements array.",
+		 function,
+		 element_index );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -3752,9 +4212,7 @@ int libcdata_internal_range_list_get_element_by_index(
      libcdata_list_element_t **element,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *current_element = NULL;
-	static char *function                    = "libcdata_internal_range_list_get_element_by_index";
-	int current_element_index                = 0;
+	static char *function = "libcdata_internal_range_list_get_element_by_index";
 
 	if( internal_range_list == NULL )
 	{
@@ -3790,123 +4248,7 @@ int libcdata_internal_range_list_get_element_by_index(
 
 		return( -1 );
 	}
-	current_element       = internal_range_list->current_element;
-	current_element_index = internal_range_list->current_element_index;
-
-	if( ( current_element != NULL )
-	 && ( current_element_index != element_index ) )
-	{
-		if( element_index < current_element_index )
-		{
-			if( ( current_element_index - element_index ) < ( internal_range_list->number_of_elements / 2 ) )
-			{
-				while( current_element_index > element_index )
-				{
-					if( libcdata_list_element_get_previous_element(
-					     current_element,
-					     &current_element,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve previous element from list element: %d.",
-						 function,
-						 current_element_index );
-
-						return( -1 );
-					}
-					current_element_index--;
-				}
-			}
-		}
-		else
-		{
-			if( ( element_index - current_element_index ) < ( internal_range_list->number_of_elements / 2 ) )
-			{
-				while( current_element_index < element_index )
-				{
-					if( libcdata_list_element_get_next_element(
-					     current_element,
-					     &current_element,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve next element from list element: %d.",
-						 function,
-						 current_element_index );
-
-						return( -1 );
-					}
-					current_element_index++;
-				}
-			}
-		}
-	}
-	if( ( current_element == NULL )
-	 || ( current_element_index != element_index ) )
-	{
-		if( element_index < ( internal_range_list->number_of_elements / 2 ) )
-		{
-			current_element = internal_range_list->first_element;
-
-			for( current_element_index = 0;
-			     current_element_index < element_index;
-			     current_element_index++ )
-			{
-				if( libcdata_list_element_get_next_element(
-				     current_element,
-				     &current_element,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve next element from list element: %d.",
-					 function,
-					 current_element_index );
-
-					return( -1 );
-				}
-			}
-		}
-		else
-		{
-			current_element = internal_range_list->last_element;
-
-			for( current_element_index = ( internal_range_list->number_of_elements - 1 );
-			     current_element_index > element_index;
-			     current_element_index-- )
-			{
-				if( libcdata_list_element_get_previous_element(
-				     current_element,
-				     &current_element,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve previous element from list element: %d.",
-					 function,
-					 current_element_index );
-
-					return( -1 );
-				}
-			}
-		}
-	}
-	if( current_element != NULL )
-	{
-		internal_range_list->current_element       = current_element;
-		internal_range_list->current_element_index = current_element_index;
-	}
-	*element = current_element;
+	*element = internal_range_list->elements[ element_index ];
 
 	return( 1 );
 }
@@ -3922,7 +4264,6 @@ int libcdata_internal_range_list_get_element_at_offset(
      libcdata_list_element_t **element,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *range_list_element   = NULL;
 	libcdata_range_list_value_t *range_list_value = NULL;
 	static char *function                         = "libcdata_internal_range_list_get_element_at_offset";
 	int element_index                             = 0;
@@ -3960,15 +4301,26 @@ int libcdata_internal_range_list_get_element_at_offset(
 
 		return( -1 );
 	}
-/* TODO add optimization using current element */
-	range_list_element = internal_range_list->first_element;
+	if( libcdata_internal_range_list_get_index_at_offset(
+	     internal_range_list,
+	     range_offset,
+	     &element_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve element index for range offset: %" PRIu64 ".",
+		 function,
+		 range_offset );
 
-	for( element_index = 0;
-	     element_index < internal_range_list->number_of_elements;
-	     element_index++ )
+		return( -1 );
+	}
+	if( element_index >= 0 )
 	{
 		if( libcdata_list_element_get_value(
-		     range_list_element,
+		     internal_range_list->elements[ element_index ],
 		     (intptr_t **) &range_list_value,
 		     error ) != 1 )
 		{
@@ -3994,32 +4346,12 @@ int libcdata_internal_range_list_get_element_at_offset(
 
 			return( -1 );
 		}
-		if( range_offset < range_list_value->start )
-		{
-			break;
-		}
-		if( ( range_offset >= range_list_value->start )
-		 && ( range_offset < range_list_value->end ) )
+		if( range_offset < range_list_value->end )
 		{
-			*element = range_list_element;
+			*element = internal_range_list->elements[ element_index ];
 
 			return( 1 );
 		}
-		if( libcdata_list_element_get_next_element(
-		     range_list_element,
-		     &range_list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next element from list element: %d.",
-			 function,
-			 element_index );
-
-			return( -1 );
-		}
 	}
 	*element = NULL;
 
@@ -4454,7 +4786,6 @@ int libcdata_range_list_range_is_present(
      libcerror_error_t **error )
 {
 	libcdata_internal_range_list_t *internal_range_list = NULL;
-	libcdata_list_element_t *list_element               = NULL;
 	libcdata_range_list_value_t *range_list_value       = NULL;
 	static char *function                               = "libcdata_range_list_range_is_present";
 	uint64_t range_end                                  = 0;
@@ -4524,15 +4855,26 @@ int libcdata_range_list_range_is_present(
 		return( -1 );
 	}
 #endif
-/* TODO add optimization using current element */
-	list_element = internal_range_list->first_element;
+	if( libcdata_internal_range_list_get_index_at_offset(
+	     internal_range_list,
+	     range_start,
+	     &element_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve element index for range offset: %" PRIu64 ".",
+		 function,
+		 range_start );
 
-	for( element_index = 0;
-	     element_index < internal_range_list->number_of_elements;
-	     element_index++ )
+		goto on_error;
+	}
+	if( element_index >= 0 )
 	{
 		if( libcdata_list_element_get_value(
-		     list_element,
+		     internal_range_list->elements[ element_index ],
 		     (intptr_t **) &range_list_value,
 		     error ) != 1 )
 		{
@@ -4546,32 +4888,22 @@ int libcdata_range_list_range_is_present(
 
 			goto on_error;
 		}
-		if( range_end < range_list_value->start )
-		{
-			break;
-		}
-		if( ( range_start >= range_list_value->start )
-		 && ( range_end <= range_list_value->end ) )
-		{
-			result = 1;
-
-			break;
-		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
+		if( range_list_value == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next element from list element: %d.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing range list value element: %d.",
 			 function,
 			 element_index );
 
 			goto on_error;
 		}
+		if( range_end <= range_list_value->end )
+		{
+			result = 1;
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -4610,7 +4942,6 @@ int libcdata_range_list_range_has_overlapping_range(
      libcerror_error_t **error )
 {
 	libcdata_internal_range_list_t *internal_range_list = NULL;
-	libcdata_list_element_t *list_element               = NULL;
 	libcdata_range_list_value_t *range_list_value       = NULL;
 	static char *function                               = "libcdata_range_list_range_has_overlapping_range";
 	uint64_t range_end                                  = 0;
@@ -4680,15 +5011,26 @@ int libcdata_range_list_range_has_overlapping_range(
 		return( -1 );
 	}
 #endif
-/* TODO add optimization using current element */
-	list_element = internal_range_list->first_element;
+	if( libcdata_internal_range_list_get_index_at_offset(
+	     internal_range_list,
+	     range_start,
+	     &element_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve element index for range offset: %" PRIu64 ".",
+		 function,
+		 range_start );
 
-	for( element_index = 0;
-	     element_index < internal_range_list->number_of_elements;
-	     element_index++ )
+		goto on_error;
+	}
+	if( element_index >= 0 )
 	{
 		if( libcdata_list_element_get_value(
-		     list_element,
+		     internal_range_list->elements[ element_index ],
 		     (intptr_t **) &range_list_value,
 		     error ) != 1 )
 		{
@@ -4702,39 +5044,77 @@ int libcdata_range_list_range_has_overlapping_range(
 
 			goto on_error;
 		}
-		if( range_end < range_list_value->start )
-		{
-			break;
-		}
-		if( ( range_start >= range_list_value->start )
-		 && ( range_start < range_list_value->end ) )
+		if( range_list_value == NULL )
 		{
-			result = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing range list value element: %d.",
+			 function,
+			 element_index );
 
-			break;
+			goto on_error;
 		}
-		if( ( range_end > range_list_value->start )
-		 && ( range_end <= range_list_value->end ) )
+		if( range_start < range_list_value->end )
 		{
 			result = 1;
-
-			break;
 		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
+	}
+	if( ( result == 0 )
+	 && ( range_end > 0 ) )
+	{
+		if( libcdata_internal_range_list_get_index_at_offset(
+		     internal_range_list,
+		     range_end - 1,
+		     &element_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next element from list element: %d.",
+			 "%s: unable to retrieve element index for range offset: %" PRIu64 ".",
 			 function,
-			 element_index );
+			 range_end - 1 );
 
 			goto on_error;
 		}
+		if( element_index >= 0 )
+		{
+			if( libcdata_list_element_get_value(
+			     internal_range_list->elements[ element_index ],
+			     (intptr_t **) &range_list_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from list element: %d.",
+				 function,
+				 element_index );
+
+				goto on_error;
+			}
+			if( range_list_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing range list value element: %d.",
+				 function,
+				 element_index );
+
+				goto on_error;
+			}
+			if( ( range_end > range_list_value->start )
+			 && ( range_end <= range_list_value->end ) )
+			{
+				result = 1;
+			}
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 	if( libcthreads_read_write_lock_release_for_read(
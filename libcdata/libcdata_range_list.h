@@ -51,13 +51,14 @@ struct libcdata_internal_range_list
 	 */
 	libcdata_list_element_t *last_element;
 
-	/* The current list element
+	/* The elements in the order of the list, which are used to look up
+	 * an element by index or by offset without walking the list
 	 */
-	libcdata_list_element_t *current_element;
+	libcdata_list_element_t **elements;
 
-	/* The current list element index
+	/* The number of allocated elements
 	 */
-	int current_element_index;
+	int number_of_allocated_elements;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 	/* The read/write lock
@@ -136,6 +137,34 @@ int libcdata_internal_range_list_set_last_element(
      libcdata_list_element_t *element,
      libcerror_error_t **error );
 
+int libcdata_internal_range_list_resize_elements(
+     libcdata_internal_range_list_t *internal_range_list,
+     int number_of_elements,
+     libcerror_error_t **error );
+
+int libcdata_internal_range_list_insert_elements_entry(
+     libcdata_internal_range_list_t *internal_range_list,
+     int element_index,
+     libcdata_list_element_t *element,
+     libcerror_error_t **error );
+
+int libcdata_internal_range_list_remove_elements_entry(
+     libcdata_internal_range_list_t *internal_range_list,
+     int element_index,
+     libcerror_error_t **error );
+
+int libcdata_internal_range_list_get_index_at_offset(
+     libcdata_internal_range_list_t *internal_range_list,
+     uint64_t range_offset,
+     int *element_index,
+     libcerror_error_t **error );
+
+int libcdata_internal_range_list_get_index_of_element(
+     libcdata_internal_range_list_t *internal_range_list,
+     libcdata_list_element_t *element,
+     int *element_index,
+     libcerror_error_t **error );
+
 int libcdata_internal_range_list_append_element(
      libcdata_internal_range_list_t *internal_range_list,
      libcdata_list_element_t *element,
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -28,8 +29,12 @@
 #include "libcdata_libcthreads.h"
 #include "libcdata_list.h"
 #include "libcdata_tree_node.h"
+#include "libcdata_tree_node_visitor.h"
+#include "libcdata_tree_view.h"
 #include "libcdata_types.h"
 
+#include "cdata_serialized_tree.h"
+
 /* Creates a tree node
  * Make sure the value node is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -122,6 +127,149 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a tree node that owns an arena
+ * The sub nodes created from the node, such as by append value, are allocated
+ * from the arena and freeing the node frees all the nodes in the arena at once
+ * Make sure the value node is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_initialize_with_arena(
+     libcdata_tree_node_t **node,
+     int number_of_nodes_per_chunk,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_arena_t *arena = NULL;
+	static char *function             = "libcdata_tree_node_initialize_with_arena";
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_arena_initialize(
+	     &arena,
+	     number_of_nodes_per_chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_tree_node_arena_allocate_node(
+	     arena,
+	     node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to allocate node from arena.",
+		 function );
+
+		goto on_error;
+	}
+	arena->root_node = *node;
+
+	return( 1 );
+
+on_error:
+	if( arena != NULL )
+	{
+		libcdata_tree_node_arena_free(
+		 &arena,
+		 NULL,
+		 NULL );
+	}
+	*node = NULL;
+
+	return( -1 );
+}
+
+/* Creates a tree node in the same arena as another node
+ * If the other node was not allocated from an arena the node is allocated on the heap
+ * Make sure the value node is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_initialize_in_arena(
+     libcdata_tree_node_t **node,
+     libcdata_tree_node_t *arena_node,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_node_t *internal_arena_node = NULL;
+	static char *function                              = "libcdata_tree_node_initialize_in_arena";
+
+	if( arena_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena node.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena_node = (libcdata_internal_tree_node_t *) arena_node;
+
+	if( internal_arena_node->arena == NULL )
+	{
+		if( libcdata_tree_node_initialize(
+		     node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libcdata_tree_node_arena_allocate_node(
+		     internal_arena_node->arena,
+		     node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to allocate node from arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Frees a tree node, its sub nodes
  * Uses the value_free_function to free the value
  * Returns 1 if successful or -1 on error
@@ -134,6 +282,7 @@ int libcdata_tree_node_free(
      libcerror_error_t **error )
 {
 	libcdata_internal_tree_node_t *internal_node = NULL;
+	libcdata_tree_node_arena_t *arena            = NULL;
 	static char *function                        = "libcdata_tree_node_free";
 	int result                                   = 1;
 
@@ -167,10 +316,35 @@ int libcdata_tree_node_free(
 		}
 		*node = NULL;
 
-		if( libcdata_internal_tree_node_free(
-		     &internal_node,
-		     value_free_function,
-		     error ) != 1 )
+		/* If the node owns an arena all the nodes in the arena are freed
+		 * without walking the tree
+		 */
+		if( ( internal_node->arena != NULL )
+		 && ( internal_node->arena->root_node == (libcdata_tree_node_t *) internal_node ) )
+		{
+			/* The node itself is stored in the arena
+			 */
+			arena = internal_node->arena;
+
+			if( libcdata_tree_node_arena_free(
+			     &arena,
+			     value_free_function,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free arena.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( libcdata_internal_tree_node_free(
+		          &internal_node,
+		          value_free_function,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -227,6 +401,32 @@ int libcdata_internal_tree_node_free(
 
 			result = -1;
 		}
+		if( libcdata_internal_tree_node_free_sub_nodes_array(
+		     *internal_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub nodes array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_internal_tree_node_free_sub_nodes_hash_table(
+		     *internal_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub nodes hash table.",
+			 function );
+
+			result = -1;
+		}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 		if( libcthreads_read_write_lock_free(
 		     &( ( *internal_node )->read_write_lock ),
@@ -262,9 +462,14 @@ int libcdata_internal_tree_node_free(
 				( *internal_node )->value = NULL;
 			}
 		}
-		memory_free(
-		 *internal_node );
-
+		/* The memory of a node allocated from an arena is released
+		 * when the arena is freed
+		 */
+		if( ( *internal_node )->arena == NULL )
+		{
+			memory_free(
+			 *internal_node );
+		}
 		*internal_node = NULL;
 	}
 	return( result );
@@ -281,15 +486,12 @@ int libcdata_tree_node_empty(
             libcerror_error_t **error ),
      libcerror_error_t **error )
 {
-	libcdata_internal_tree_node_t *internal_node = NULL;
-	libcdata_tree_node_t *next_node              = NULL;
-	libcdata_tree_node_t *parent_node            = NULL;
-	libcdata_tree_node_t *previous_node          = NULL;
-	libcdata_tree_node_t *sub_node               = NULL;
-	static char *function                        = "libcdata_tree_node_empty";
-	int number_of_sub_nodes                      = 0;
-	int result                                   = 1;
-	int sub_node_index                           = 0;
+	libcdata_internal_tree_node_t *internal_node        = NULL;
+	libcdata_internal_tree_node_t *internal_parent_node = NULL;
+	libcdata_internal_tree_node_t *internal_sub_node    = NULL;
+	libcdata_tree_node_t *next_node                     = NULL;
+	static char *function                               = "libcdata_tree_node_empty";
+	int result                                          = 1;
 
 	if( tree_node == NULL )
 	{
@@ -319,88 +521,107 @@ int libcdata_tree_node_empty(
 		return( -1 );
 	}
 #endif
-	number_of_sub_nodes = internal_node->number_of_sub_nodes;
+	if( libcdata_internal_tree_node_free_sub_nodes_array(
+	     internal_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sub nodes array.",
+		 function );
 
-	sub_node = internal_node->first_sub_node;
+		goto on_error;
+	}
+	if( libcdata_internal_tree_node_free_sub_nodes_hash_table(
+	     internal_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sub nodes hash table.",
+		 function );
 
-	for( sub_node_index = 0;
-	     sub_node_index < number_of_sub_nodes;
-	     sub_node_index++ )
+		goto on_error;
+	}
+	/* The sub tree is torn down in post-order without recursion so that
+	 * the stack usage does not depend on the depth of the tree. Every
+	 * iteration detaches the first leaf node and frees it, the parent
+	 * of a leaf node becomes a leaf node once its last sub node is freed.
+	 */
+	internal_sub_node = (libcdata_internal_tree_node_t *) internal_node->first_sub_node;
+
+	while( internal_sub_node != NULL )
 	{
-		if( libcdata_tree_node_get_nodes(
-		     sub_node,
-		     &parent_node,
-		     &previous_node,
-		     &next_node,
-		     error ) != 1 )
+		while( internal_sub_node->first_sub_node != NULL )
+		{
+			internal_sub_node = (libcdata_internal_tree_node_t *) internal_sub_node->first_sub_node;
+		}
+		internal_parent_node = (libcdata_internal_tree_node_t *) internal_sub_node->parent_node;
+
+		if( internal_parent_node == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve nodes of sub node: %d.",
-			 function,
-			 sub_node_index );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid sub node - missing parent node.",
+			 function );
 
 			goto on_error;
 		}
-		if( previous_node != NULL )
+		if( internal_sub_node->previous_node != NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-			 "%s: invalid sub node: %d - previous node is set.",
-			 function,
-			 sub_node_index );
+			 "%s: invalid sub node - previous node is set.",
+			 function );
 
 			goto on_error;
 		}
-		internal_node->first_sub_node = next_node;
-
-		if( internal_node->last_sub_node == sub_node )
-		{
-			internal_node->last_sub_node = next_node;
-		}
-		internal_node->number_of_sub_nodes -= 1;
+		next_node = internal_sub_node->next_node;
 
-		if( next_node != NULL )
+		if( internal_parent_node != internal_node )
 		{
-			if( libcdata_tree_node_set_previous_node(
-			     next_node,
-			     NULL,
+			/* The sub nodes array of the parent node is no longer valid
+			 * once its first sub node is detached
+			 */
+			if( libcdata_internal_tree_node_free_sub_nodes_array(
+			     internal_parent_node,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set previous node of sub node: %d.",
-				 function,
-				 sub_node_index + 1 );
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub nodes array of parent node.",
+				 function );
 
 				goto on_error;
 			}
 		}
-		if( libcdata_tree_node_set_nodes(
-		     sub_node,
-		     NULL,
-		     NULL,
-		     NULL,
-		     error ) != 1 )
+		internal_parent_node->first_sub_node = next_node;
+
+		if( internal_parent_node->last_sub_node == (libcdata_tree_node_t *) internal_sub_node )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set nodes of sub node: %d.",
-			 function,
-			 sub_node_index );
+			internal_parent_node->last_sub_node = next_node;
+		}
+		internal_parent_node->number_of_sub_nodes -= 1;
 
-			goto on_error;
+		if( next_node != NULL )
+		{
+			( (libcdata_internal_tree_node_t *) next_node )->previous_node = NULL;
 		}
+		internal_sub_node->parent_node = NULL;
+		internal_sub_node->next_node   = NULL;
+
 		if( libcdata_internal_tree_node_free(
-		     (libcdata_internal_tree_node_t **) &sub_node,
+		     &internal_sub_node,
 		     value_free_function,
 		     error ) != 1 )
 		{
@@ -408,13 +629,19 @@ int libcdata_tree_node_empty(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub node: %d.",
-			 function,
-			 sub_node_index );
+			 "%s: unable to free sub node.",
+			 function );
 
 			result = -1;
 		}
-		sub_node = next_node;
+		if( next_node != NULL )
+		{
+			internal_sub_node = (libcdata_internal_tree_node_t *) next_node;
+		}
+		else if( internal_parent_node != internal_node )
+		{
+			internal_sub_node = internal_parent_node;
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -431,6 +658,19 @@ int libcdata_tree_node_empty(
 		return( -1 );
 	}
 #endif
+	if( libcdata_internal_tree_node_invalidate_number_of_descendants(
+	     internal_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to invalidate number of descendants.",
+		 function );
+
+		return( -1 );
+	}
 	return( result );
 
 on_error:
@@ -461,12 +701,15 @@ int libcdata_tree_node_clone(
             libcerror_error_t **error ),
      libcerror_error_t **error )
 {
-	libcdata_internal_tree_node_t *internal_destination_node = NULL;
-	libcdata_internal_tree_node_t *internal_source_node      = NULL;
-	libcdata_tree_node_t *destination_sub_node               = NULL;
-	libcdata_tree_node_t *sub_node                           = NULL;
-	static char *function                                    = "libcdata_tree_node_clone";
-	int sub_node_index                                       = 0;
+	libcdata_internal_tree_node_t *internal_destination_node        = NULL;
+	libcdata_internal_tree_node_t *internal_destination_parent_node = NULL;
+	libcdata_internal_tree_node_t *internal_destination_sub_node    = NULL;
+	libcdata_tree_node_t *next_node                                 = NULL;
+	libcdata_tree_node_t *parent_node                               = NULL;
+	libcdata_tree_node_t *previous_node                             = NULL;
+	libcdata_tree_node_t *sub_node                                  = NULL;
+	intptr_t *value                                                 = NULL;
+	static char *function                                           = "libcdata_tree_node_clone";
 
 	if( destination_node == NULL )
 	{
@@ -518,165 +761,164 @@ int libcdata_tree_node_clone(
 
 		return( 1 );
 	}
-	internal_source_node = (libcdata_internal_tree_node_t *) source_node;
+	/* The source tree is cloned in pre-order without recursion so that
+	 * the stack usage does not depend on the depth of the tree. The parent
+	 * node of the destination sub node is tracked in lockstep with the
+	 * source sub node using the parent node references.
+	 */
+	sub_node = source_node;
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_source_node->read_write_lock,
-	     error ) != 1 )
+	while( sub_node != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
-
-		return( -1 );
-	}
-#endif
-	if( libcdata_tree_node_initialize(
-	     (libcdata_tree_node_t **) &internal_destination_node,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination tree node.",
-		 function );
-
-		goto on_error;
-	}
-	if( internal_destination_node == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing destination tree node.",
-		 function );
-
-		goto on_error;
-	}
-	if( value_clone_function(
-	     &( internal_destination_node->value ),
-	     internal_source_node->value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination tree node value.",
-		 function );
+		if( libcdata_tree_node_get_value(
+		     sub_node,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from source sub node.",
+			 function );
 
-		goto on_error;
-	}
-	/* Clone the sub nodes
-	 */
-	sub_node = internal_source_node->first_sub_node;
+			goto on_error;
+		}
+		if( libcdata_tree_node_initialize(
+		     (libcdata_tree_node_t **) &internal_destination_sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination tree node.",
+			 function );
 
-	for( sub_node_index = 0;
-	     sub_node_index < internal_source_node->number_of_sub_nodes;
-	     sub_node_index++ )
-	{
-		if( sub_node == NULL )
+			goto on_error;
+		}
+		if( internal_destination_sub_node == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected in source sub node: %d.",
-			 function,
-			 sub_node_index );
+			 "%s: missing destination tree node.",
+			 function );
 
 			goto on_error;
 		}
-		if( libcdata_tree_node_clone(
-		     &destination_sub_node,
-		     sub_node,
-		     value_free_function,
-		     value_clone_function,
+		if( value_clone_function(
+		     &( internal_destination_sub_node->value ),
+		     value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to create destination sub node: %d.",
-			 function,
-			 sub_node_index );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination tree node value.",
+			 function );
 
 			goto on_error;
 		}
-		if( libcdata_internal_tree_node_append_node(
-		     internal_destination_node,
-		     destination_sub_node,
-		     error ) != 1 )
+		if( internal_destination_parent_node == NULL )
+		{
+			internal_destination_node = internal_destination_sub_node;
+		}
+		else if( libcdata_internal_tree_node_append_node(
+		          internal_destination_parent_node,
+		          (libcdata_tree_node_t *) internal_destination_sub_node,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append sub node: %d to destination tree node.",
-			 function,
-			 sub_node_index );
+			 "%s: unable to append sub node to destination tree node.",
+			 function );
 
 			goto on_error;
 		}
-		destination_sub_node = NULL;
-
-		if( libcdata_tree_node_get_next_node(
+		if( libcdata_tree_node_get_first_sub_node(
 		     sub_node,
-		     &sub_node,
+		     &next_node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next node of sub node: %d.",
-			 function,
-			 sub_node_index );
+			 "%s: unable to retrieve first sub node of source sub node.",
+			 function );
+
+			internal_destination_sub_node = NULL;
 
 			goto on_error;
 		}
-	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_source_node->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( next_node != NULL )
+		{
+			internal_destination_parent_node = internal_destination_sub_node;
+			internal_destination_sub_node    = NULL;
 
-		libcdata_internal_tree_node_free(
-		 (libcdata_internal_tree_node_t **) &destination_sub_node,
-		 value_free_function,
-		 NULL );
+			sub_node = next_node;
 
-		return( -1 );
+			continue;
+		}
+		internal_destination_sub_node = NULL;
+
+		/* Ascend until a source sub node with a next node is found
+		 */
+		while( sub_node != source_node )
+		{
+			if( libcdata_tree_node_get_nodes(
+			     sub_node,
+			     &parent_node,
+			     &previous_node,
+			     &next_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve nodes of source sub node.",
+				 function );
+
+				goto on_error;
+			}
+			if( next_node != NULL )
+			{
+				break;
+			}
+			if( ( parent_node == NULL )
+			 || ( internal_destination_parent_node == NULL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: corruption detected in source sub node - missing parent node.",
+				 function );
+
+				goto on_error;
+			}
+			sub_node = parent_node;
+
+			internal_destination_parent_node = (libcdata_internal_tree_node_t *) internal_destination_parent_node->parent_node;
+		}
+		sub_node = next_node;
 	}
-#endif
 	*destination_node = (libcdata_tree_node_t *) internal_destination_node;
 
 	return( 1 );
 
 on_error:
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_source_node->read_write_lock,
-	 NULL );
-#endif
-	if( destination_sub_node != NULL )
+	if( ( internal_destination_sub_node != NULL )
+	 && ( internal_destination_sub_node != internal_destination_node ) )
 	{
 		libcdata_internal_tree_node_free(
-		 (libcdata_internal_tree_node_t **) &destination_sub_node,
+		 &internal_destination_sub_node,
 		 value_free_function,
 		 NULL );
 	}
@@ -768,11 +1010,12 @@ int libcdata_tree_node_set_value(
      intptr_t *value,
      libcerror_error_t **error )
 {
-	libcdata_internal_tree_node_t *internal_node = NULL;
-	static char *function                        = "libcdata_tree_node_set_value";
+	libcdata_internal_tree_node_t *internal_node        = NULL;
+	libcdata_internal_tree_node_t *internal_parent_node = NULL;
+	static char *function                               = "libcdata_tree_node_set_value";
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	intptr_t *backup_value                       = NULL;
+	intptr_t *backup_value                              = NULL;
 #endif
 
 	if( node == NULL )
@@ -806,6 +1049,7 @@ int libcdata_tree_node_set_value(
 #endif
 
 	internal_node->value = value;
+	internal_parent_node = (libcdata_internal_tree_node_t *) internal_node->parent_node;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -822,6 +1066,43 @@ int libcdata_tree_node_set_value(
 		goto on_error;
 	}
 #endif
+	/* The sub nodes hash table of the parent node is indexed by value
+	 */
+	if( internal_parent_node != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_parent_node->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock of parent node for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		internal_parent_node->sub_nodes_hash_table_is_stale = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_parent_node->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock of parent node for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
 	return( 1 );
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
@@ -1910,6 +2191,8 @@ int libcdata_tree_node_set_sub_nodes(
 	internal_node->first_sub_node = first_sub_node;
 	internal_node->last_sub_node  = last_sub_node;
 
+	internal_node->sub_nodes_hash_table_is_stale = 1;
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_node->read_write_lock,
@@ -1936,18 +2219,15 @@ on_error:
 #endif
 }
 
-/* Appends a sub tree node to the node
+/* Frees the sub nodes array of the tree node
+ * This function assumes the caller holds the write lock of the node
  * Returns 1 if successful or -1 on error
  */
-int libcdata_internal_tree_node_append_node(
+int libcdata_internal_tree_node_free_sub_nodes_array(
      libcdata_internal_tree_node_t *internal_node,
-     libcdata_tree_node_t *node_to_append,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *to_append_next_node     = NULL;
-	libcdata_tree_node_t *to_append_parent_node   = NULL;
-	libcdata_tree_node_t *to_append_previous_node = NULL;
-	static char *function                         = "libcdata_internal_tree_node_append_node";
+	static char *function = "libcdata_internal_tree_node_free_sub_nodes_array";
 
 	if( internal_node == NULL )
 	{
@@ -1960,167 +2240,278 @@ int libcdata_internal_tree_node_append_node(
 
 		return( -1 );
 	}
-	if( node_to_append == NULL )
+	if( internal_node->sub_nodes_array != NULL )
+	{
+		memory_free(
+		 internal_node->sub_nodes_array );
+
+		internal_node->sub_nodes_array = NULL;
+	}
+	internal_node->number_of_allocated_sub_nodes_array_entries = 0;
+
+	if( internal_node->sub_nodes_cumulative_sizes != NULL )
+	{
+		memory_free(
+		 internal_node->sub_nodes_cumulative_sizes );
+
+		internal_node->sub_nodes_cumulative_sizes = NULL;
+	}
+	internal_node->number_of_sub_nodes_cumulative_sizes = 0;
+
+	return( 1 );
+}
+
+/* Resizes the sub nodes array of the tree node to hold number_of_sub_nodes entries
+ * The sub nodes array is created, from the current sub nodes, when the number
+ * of sub nodes reaches LIBCDATA_TREE_NODE_SUB_NODES_ARRAY_THRESHOLD
+ * This function assumes the caller holds the write lock of the node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_tree_node_resize_sub_nodes_array(
+     libcdata_internal_tree_node_t *internal_node,
+     int number_of_sub_nodes,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t **reallocation = NULL;
+	libcdata_tree_node_t *sub_node      = NULL;
+	static char *function               = "libcdata_internal_tree_node_resize_sub_nodes_array";
+	size_t entries_size                 = 0;
+	int number_of_allocated_entries     = 0;
+	int sub_node_index                  = 0;
+
+	if( internal_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node to append.",
+		 "%s: invalid node.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_nodes(
-	     node_to_append,
-	     &to_append_parent_node,
-	     &to_append_previous_node,
-	     &to_append_next_node,
-	     error ) != 1 )
+	if( number_of_sub_nodes < internal_node->number_of_sub_nodes )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve nodes of node to append.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sub nodes value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( to_append_parent_node != NULL )
-	 || ( to_append_previous_node != NULL )
-	 || ( to_append_next_node != NULL ) )
+	if( ( internal_node->sub_nodes_array == NULL )
+	 && ( number_of_sub_nodes < LIBCDATA_TREE_NODE_SUB_NODES_ARRAY_THRESHOLD ) )
+	{
+		return( 1 );
+	}
+	if( number_of_sub_nodes <= internal_node->number_of_allocated_sub_nodes_array_entries )
+	{
+		return( 1 );
+	}
+	/* Pre-allocate in blocks of 16 entries
+	 */
+	if( number_of_sub_nodes >= (int) ( INT_MAX - 16 ) )
+	{
+		number_of_allocated_entries = INT_MAX;
+	}
+	else
+	{
+		number_of_allocated_entries = ( number_of_sub_nodes & ~( 15 ) ) + 16;
+	}
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+	if( (size_t) number_of_allocated_entries > (size_t) ( SSIZE_MAX / sizeof( libcdata_tree_node_t * ) ) )
+#else
+	if( number_of_allocated_entries > (int) ( SSIZE_MAX / sizeof( libcdata_tree_node_t * ) ) )
+#endif
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid node to append - node is already part of a tree.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of allocated entries value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_node->number_of_sub_nodes == 0 )
+	entries_size = sizeof( libcdata_tree_node_t * ) * number_of_allocated_entries;
+
+	if( internal_node->sub_nodes_array == NULL )
 	{
-		if( internal_node->first_sub_node != NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-			 "%s: corruption detected - first sub node already set.",
-			 function );
+		reallocation = (libcdata_tree_node_t **) memory_allocate(
+		                                          entries_size );
 
-			return( -1 );
-		}
-		if( internal_node->last_sub_node != NULL )
+		if( reallocation == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-			 "%s: corruption detected - last sub node already set.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub nodes array.",
 			 function );
 
 			return( -1 );
 		}
-		internal_node->first_sub_node = node_to_append;
-		internal_node->last_sub_node  = node_to_append;
-	}
-	else
-	{
-		if( internal_node->first_sub_node == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - missing first sub node.",
-			 function );
+		sub_node = internal_node->first_sub_node;
 
-			return( -1 );
-		}
-		if( internal_node->last_sub_node == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - missing last sub node.",
-			 function );
-
-			return( -1 );
-		}
-		if( libcdata_tree_node_set_next_node(
-		     internal_node->last_sub_node,
-		     node_to_append,
-		     error ) != 1 )
+		for( sub_node_index = 0;
+		     sub_node_index < internal_node->number_of_sub_nodes;
+		     sub_node_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set next node of last sub node.",
-			 function );
+			if( sub_node == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: corruption detected - missing sub node: %d.",
+				 function,
+				 sub_node_index );
 
-			return( -1 );
+				goto on_error;
+			}
+			reallocation[ sub_node_index ] = sub_node;
+
+			if( libcdata_tree_node_get_next_node(
+			     sub_node,
+			     &sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next node of sub node: %d.",
+				 function,
+				 sub_node_index );
+
+				goto on_error;
+			}
 		}
-		if( libcdata_tree_node_set_previous_node(
-		     node_to_append,
-		     internal_node->last_sub_node,
-		     error ) != 1 )
+	}
+	else
+	{
+		reallocation = (libcdata_tree_node_t **) memory_reallocate(
+		                                          internal_node->sub_nodes_array,
+		                                          entries_size );
+
+		if( reallocation == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set previous node of node to append.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize sub nodes array.",
 			 function );
 
 			return( -1 );
 		}
-		internal_node->last_sub_node = node_to_append;
 	}
-	if( libcdata_tree_node_set_parent_node(
-	     node_to_append,
-	     (libcdata_tree_node_t *) internal_node,
-	     error ) != 1 )
+	internal_node->sub_nodes_array                             = reallocation;
+	internal_node->number_of_allocated_sub_nodes_array_entries = number_of_allocated_entries;
+
+	return( 1 );
+
+on_error:
+	if( reallocation != NULL )
+	{
+		memory_free(
+		 reallocation );
+	}
+	return( -1 );
+}
+
+/* Retrieves the index of a sub node in the sub nodes array of the tree node
+ * This function assumes the caller holds the lock of the node
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libcdata_internal_tree_node_get_sub_nodes_array_entry_index(
+     libcdata_internal_tree_node_t *internal_node,
+     libcdata_tree_node_t *sub_node,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_internal_tree_node_get_sub_nodes_array_entry_index";
+	int sub_node_index    = 0;
+
+	if( internal_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set parent node of node to append.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
 		 function );
 
 		return( -1 );
 	}
-	internal_node->number_of_sub_nodes += 1;
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
 
-	return( 1 );
+		return( -1 );
+	}
+	if( internal_node->sub_nodes_array == NULL )
+	{
+		return( 0 );
+	}
+	/* The sub nodes array is contiguous so scanning it does not require
+	 * the sub nodes to be locked
+	 */
+	for( sub_node_index = 0;
+	     sub_node_index < internal_node->number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( internal_node->sub_nodes_array[ sub_node_index ] == sub_node )
+		{
+			*entry_index = sub_node_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
 }
 
-/* Appends a tree node to the node
- * Returns 1 if successful or -1 on error
+/* Searches the sub nodes array of the tree node for the entry the value should be stored before
+ * The sub nodes are expected to be sorted by value
+ *
+ * Uses the value_compare_function to determine the order of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * The entry index is set to the first entry that is greater than or equal to the value
+ * or, if skip_equal_entries is set, to the first entry that is greater than the value.
+ * On return the entry index is set to the number of sub nodes if there is no such entry.
+ *
+ * This function assumes the caller holds the lock of the node
+ * Returns 1 if the entry is equal to the value, 0 if not or -1 on error
  */
-int libcdata_tree_node_append_node(
-     libcdata_tree_node_t *node,
-     libcdata_tree_node_t *node_to_append,
+int libcdata_internal_tree_node_bisect_sub_nodes_array(
+     libcdata_internal_tree_node_t *internal_node,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     uint8_t skip_equal_entries,
+     int *entry_index,
      libcerror_error_t **error )
 {
-	libcdata_internal_tree_node_t *internal_node  = NULL;
-	libcdata_tree_node_t *to_append_next_node     = NULL;
-	libcdata_tree_node_t *to_append_parent_node   = NULL;
-	libcdata_tree_node_t *to_append_previous_node = NULL;
-	static char *function                         = "libcdata_tree_node_append_node";
-	int result                                    = 1;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	libcdata_tree_node_t *backup_first_sub_node   = NULL;
-	libcdata_tree_node_t *backup_last_sub_node    = NULL;
-#endif
+	intptr_t *sub_node_value = NULL;
+	static char *function    = "libcdata_internal_tree_node_bisect_sub_nodes_array";
+	int compare_result       = 0;
+	int last_compare_result  = LIBCDATA_COMPARE_LESS;
+	int lower_entry_index    = 0;
+	int middle_entry_index   = 0;
+	int upper_entry_index    = 0;
 
-	if( node == NULL )
+	if( internal_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2131,236 +2522,244 @@ int libcdata_tree_node_append_node(
 
 		return( -1 );
 	}
-	internal_node = (libcdata_internal_tree_node_t *) node;
+	if( internal_node->sub_nodes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid node - missing sub nodes array.",
+		 function );
 
-	if( internal_node->number_of_sub_nodes == 0 )
+		return( -1 );
+	}
+	if( value_compare_function == NULL )
 	{
-		if( internal_node->first_sub_node != NULL )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value compare function.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	upper_entry_index = internal_node->number_of_sub_nodes;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		middle_entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		if( libcdata_tree_node_get_value(
+		     internal_node->sub_nodes_array[ middle_entry_index ],
+		     &sub_node_value,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - first sub node already set.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value of sub node: %d.",
+			 function,
+			 middle_entry_index );
 
 			return( -1 );
 		}
-		if( internal_node->last_sub_node != NULL )
+		compare_result = value_compare_function(
+		                  value,
+		                  sub_node_value,
+		                  error );
+
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - last sub node already set.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare sub node: %d.",
+			 function,
+			 middle_entry_index );
 
 			return( -1 );
 		}
-	}
-	else
-	{
-		if( internal_node->first_sub_node == NULL )
+		else if( ( compare_result != LIBCDATA_COMPARE_LESS )
+		      && ( compare_result != LIBCDATA_COMPARE_EQUAL )
+		      && ( compare_result != LIBCDATA_COMPARE_GREATER ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - missing first sub node.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value compare function return value: %d.",
+			 function,
+			 compare_result );
 
 			return( -1 );
 		}
-		if( internal_node->last_sub_node == NULL )
+		if( ( compare_result == LIBCDATA_COMPARE_GREATER )
+		 || ( ( compare_result == LIBCDATA_COMPARE_EQUAL )
+		  &&  ( skip_equal_entries != 0 ) ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - missing last sub node.",
-			 function );
-
-			return( -1 );
+			lower_entry_index = middle_entry_index + 1;
+		}
+		else
+		{
+			/* Keep track of the comparison with the entry at the upper entry index
+			 * since this is the entry that is returned
+			 */
+			upper_entry_index   = middle_entry_index;
+			last_compare_result = compare_result;
 		}
 	}
-	if( libcdata_tree_node_get_nodes(
-	     node_to_append,
-	     &to_append_parent_node,
-	     &to_append_previous_node,
-	     &to_append_next_node,
-	     error ) != 1 )
+	*entry_index = upper_entry_index;
+
+	if( ( upper_entry_index < internal_node->number_of_sub_nodes )
+	 && ( last_compare_result == LIBCDATA_COMPARE_EQUAL ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Inserts a sub node in the sub nodes array of the tree node
+ * The sub nodes array must have been resized to hold the additional entry
+ * and the entry must be inserted before the number of sub nodes is updated
+ * This function assumes the caller holds the write lock of the node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_tree_node_insert_sub_nodes_array_entry(
+     libcdata_internal_tree_node_t *internal_node,
+     int entry_index,
+     libcdata_tree_node_t *sub_node,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_internal_tree_node_insert_sub_nodes_array_entry";
+	int sub_node_index    = 0;
+
+	if( internal_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve nodes of node to append.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( to_append_parent_node != NULL )
-	 || ( to_append_previous_node != NULL )
-	 || ( to_append_next_node != NULL ) )
+	if( internal_node->sub_nodes_array == NULL )
+	{
+		return( 1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index > internal_node->number_of_sub_nodes ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid node to append - node is already part of a tree.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_node->read_write_lock,
-	     error ) != 1 )
+	if( internal_node->number_of_sub_nodes >= internal_node->number_of_allocated_sub_nodes_array_entries )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node - sub nodes array too small.",
 		 function );
 
 		return( -1 );
 	}
-	backup_first_sub_node = internal_node->first_sub_node;
-	backup_last_sub_node  = internal_node->last_sub_node;
-#endif
-
-	result = libcdata_tree_node_set_parent_node(
-	          node_to_append,
-	          node,
-	          error );
-
-	if( result != 1 )
+	for( sub_node_index = internal_node->number_of_sub_nodes;
+	     sub_node_index > entry_index;
+	     sub_node_index-- )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set parent node of node to append.",
-		 function );
-
-		result = -1;
+		internal_node->sub_nodes_array[ sub_node_index ] = internal_node->sub_nodes_array[ sub_node_index - 1 ];
 	}
-	if( result == 1 )
-	{
-		result = libcdata_tree_node_set_previous_node(
-		          node_to_append,
-		          internal_node->last_sub_node,
-		          error );
+	internal_node->sub_nodes_array[ entry_index ] = sub_node;
 
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set previous node of node to append.",
-			 function );
+	return( 1 );
+}
 
-			libcdata_tree_node_set_parent_node(
-			 node_to_append,
-			 NULL,
-			 NULL );
+/* Removes a sub node from the sub nodes array of the tree node
+ * The entry must be removed before the number of sub nodes is updated
+ * This function assumes the caller holds the write lock of the node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_tree_node_remove_sub_nodes_array_entry(
+     libcdata_internal_tree_node_t *internal_node,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_internal_tree_node_remove_sub_nodes_array_entry";
+	int sub_node_index    = 0;
 
-			result = -1;
-		}
-	}
-	if( result == 1 )
+	if( internal_node == NULL )
 	{
-		if( internal_node->last_sub_node != NULL )
-		{
-			result = libcdata_tree_node_set_next_node(
-			          internal_node->last_sub_node,
-			          node_to_append,
-			          error );
-
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set next node of last sub node.",
-				 function );
-
-				libcdata_tree_node_set_parent_node(
-				 node_to_append,
-				 NULL,
-				 NULL );
-
-				libcdata_tree_node_set_previous_node(
-				 node_to_append,
-				 NULL,
-				 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
 
-				result = -1;
-			}
-		}
+		return( -1 );
 	}
-	if( result == 1 )
+	if( internal_node->sub_nodes_array == NULL )
 	{
-		if( internal_node->first_sub_node == NULL )
-		{
-			internal_node->first_sub_node = node_to_append;
-		}
-		internal_node->last_sub_node = node_to_append;
-
-		internal_node->number_of_sub_nodes += 1;
+		return( 1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_node->read_write_lock,
-	     error ) != 1 )
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_node->number_of_sub_nodes ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#endif
-	return( result );
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-on_error:
-	libcdata_tree_node_set_parent_node(
-	 node_to_append,
-	 NULL,
-	 NULL );
-
-	libcdata_tree_node_set_previous_node(
-	 node_to_append,
-	 NULL,
-	 NULL );
-
-	internal_node->first_sub_node = backup_first_sub_node;
-	internal_node->last_sub_node  = backup_last_sub_node;
-
-	internal_node->number_of_sub_nodes -= 1;
+	for( sub_node_index = entry_index;
+	     sub_node_index < ( internal_node->number_of_sub_nodes - 1 );
+	     sub_node_index++ )
+	{
+		internal_node->sub_nodes_array[ sub_node_index ] = internal_node->sub_nodes_array[ sub_node_index + 1 ];
+	}
+	internal_node->sub_nodes_array[ internal_node->number_of_sub_nodes - 1 ] = NULL;
 
-	return( -1 );
-#endif
+	return( 1 );
 }
 
-/* Appends a value to the node
- * Creates a new sub tree node
+/* Replaces a sub node in the sub nodes array of the tree node
  * Returns 1 if successful or -1 on error
  */
-int libcdata_tree_node_append_value(
+int libcdata_internal_tree_node_replace_sub_nodes_array_entry(
      libcdata_tree_node_t *node,
-     intptr_t *value,
+     libcdata_tree_node_t *sub_node,
+     libcdata_tree_node_t *replacement_sub_node,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *sub_node = NULL;
-	static char *function          = "libcdata_tree_node_append_value";
+	libcdata_internal_tree_node_t *internal_node = NULL;
+	static char *function                        = "libcdata_internal_tree_node_replace_sub_nodes_array_entry";
+	int entry_index                              = 0;
+	int result                                   = 0;
 
 	if( node == NULL )
 	{
@@ -2373,92 +2772,89 @@ int libcdata_tree_node_append_value(
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_initialize(
-	     &sub_node,
+	internal_node = (libcdata_internal_tree_node_t *) node;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_node->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sub node.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_tree_node_set_value(
-	     sub_node,
-	     value,
-	     error ) != 1 )
+#endif
+	result = libcdata_internal_tree_node_get_sub_nodes_array_entry_index(
+	          internal_node,
+	          sub_node,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to set value in sub node.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub nodes array entry index.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		internal_node->sub_nodes_array[ entry_index ] = replacement_sub_node;
+	}
+	else if( internal_node->sub_nodes_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: corruption detected - missing sub node in sub nodes array.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	if( libcdata_tree_node_append_node(
-	     node,
-	     sub_node,
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_node->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append sub node to node.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	if( sub_node != NULL )
+#endif
+	if( result == -1 )
 	{
-		libcdata_internal_tree_node_free(
-		 (libcdata_internal_tree_node_t **) &sub_node,
-		 NULL,
-		 NULL );
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-
-/* Retrieves the node which the sub node should be inserted before
- *
- * Uses the value_compare_function to determine the order of the entries
- * The value_compare_function should return LIBCDATA_COMPARE_LESS,
- * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
- *
- * Duplicate entries are allowed by default and inserted after the last duplicate value.
- * Only allowing unique entries can be enforced by setting the flag LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES
- *
- * On return sub_node will be set to NULL if the sub node should be inserted at the end of the list.
- *
- * Returns 1 if successful, 0 if a sub node containing the value already exists or -1 on error
+/* Appends a sub tree node to the node
+ * The number of descendants of the node is marked stale, the caller is
+ * responsible for marking the parent nodes stale
+ * Returns 1 if successful or -1 on error
  */
-int libcdata_internal_tree_node_insert_node_find_sub_node(
+int libcdata_internal_tree_node_append_node(
      libcdata_internal_tree_node_t *internal_node,
-     intptr_t *value_to_insert,
-     int (*value_compare_function)(
-            intptr_t *first_value,
-            intptr_t *second_value,
-            libcerror_error_t **error ),
-     uint8_t insert_flags,
-     int *sub_node_index,
-     libcdata_tree_node_t **sub_node,
+     libcdata_tree_node_t *node_to_append,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *sub_tree_node = NULL;
-	intptr_t *sub_node_value            = NULL;
-	static char *function               = "libcdata_internal_tree_node_insert_node_find_sub_node";
-	int compare_result                  = 0;
-	int result                          = 1;
-	int safe_sub_node_index             = 0;
+	libcdata_tree_node_t *to_append_next_node     = NULL;
+	libcdata_tree_node_t *to_append_parent_node   = NULL;
+	libcdata_tree_node_t *to_append_previous_node = NULL;
+	static char *function                         = "libcdata_internal_tree_node_append_node";
 
 	if( internal_node == NULL )
 	{
@@ -2471,497 +2867,309 @@ int libcdata_internal_tree_node_insert_node_find_sub_node(
 
 		return( -1 );
 	}
-	if( value_compare_function == NULL )
+	if( node_to_append == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value compare function.",
+		 "%s: invalid node to append.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( insert_flags & ~( LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES ) ) != 0 )
+	if( libcdata_tree_node_get_nodes(
+	     node_to_append,
+	     &to_append_parent_node,
+	     &to_append_previous_node,
+	     &to_append_next_node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported insert flags: 0x%02" PRIx8 ".",
-		 function,
-		 insert_flags );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve nodes of node to append.",
+		 function );
 
 		return( -1 );
 	}
-	if( sub_node_index == NULL )
+	if( ( to_append_parent_node != NULL )
+	 || ( to_append_previous_node != NULL )
+	 || ( to_append_next_node != NULL ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub node index.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node to append - node is already part of a tree.",
 		 function );
 
 		return( -1 );
 	}
-	if( sub_node == NULL )
+	if( libcdata_internal_tree_node_resize_sub_nodes_array(
+	     internal_node,
+	     internal_node->number_of_sub_nodes + 1,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub node.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sub nodes array.",
 		 function );
 
 		return( -1 );
 	}
-	sub_tree_node = internal_node->first_sub_node;
-
-	for( safe_sub_node_index = 0;
-	     safe_sub_node_index < internal_node->number_of_sub_nodes;
-	     safe_sub_node_index++ )
+	if( internal_node->number_of_sub_nodes == 0 )
 	{
-		if( libcdata_tree_node_get_value(
-		     sub_tree_node,
-		     &sub_node_value,
-		     error ) != 1 )
+		if( internal_node->first_sub_node != NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value of sub node: %d.",
-			 function,
-			 safe_sub_node_index );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: corruption detected - first sub node already set.",
+			 function );
 
 			return( -1 );
 		}
-		compare_result = value_compare_function(
-		                  value_to_insert,
-		                  sub_node_value,
-		                  error );
-
-		if( compare_result == -1 )
+		if( internal_node->last_sub_node != NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to compare sub node: %d.",
-			 function,
-			 safe_sub_node_index );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: corruption detected - last sub node already set.",
+			 function );
 
 			return( -1 );
 		}
-		else if( compare_result == LIBCDATA_COMPARE_EQUAL )
+		internal_node->first_sub_node = node_to_append;
+		internal_node->last_sub_node  = node_to_append;
+	}
+	else
+	{
+		if( internal_node->first_sub_node == NULL )
 		{
-			if( ( insert_flags & LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES ) != 0 )
-			{
-				result = 0;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - missing first sub node.",
+			 function );
 
-				break;
-			}
+			return( -1 );
 		}
-		else if( compare_result == LIBCDATA_COMPARE_LESS )
+		if( internal_node->last_sub_node == NULL )
 		{
-			break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - missing last sub node.",
+			 function );
+
+			return( -1 );
 		}
-		else if( compare_result != LIBCDATA_COMPARE_GREATER )
+		if( libcdata_tree_node_set_next_node(
+		     internal_node->last_sub_node,
+		     node_to_append,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported value compare function return value: %d.",
-			 function,
-			 result );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set next node of last sub node.",
+			 function );
 
 			return( -1 );
 		}
-		if( libcdata_tree_node_get_next_node(
-		     sub_tree_node,
-		     &sub_tree_node,
+		if( libcdata_tree_node_set_previous_node(
+		     node_to_append,
+		     internal_node->last_sub_node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next node of sub node: %d.",
-			 function,
-			 safe_sub_node_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set previous node of node to append.",
+			 function );
 
 			return( -1 );
 		}
+		internal_node->last_sub_node = node_to_append;
 	}
-	if( ( compare_result == LIBCDATA_COMPARE_EQUAL )
-	 || ( compare_result == LIBCDATA_COMPARE_LESS ) )
+	if( libcdata_tree_node_set_parent_node(
+	     node_to_append,
+	     (libcdata_tree_node_t *) internal_node,
+	     error ) != 1 )
 	{
-		*sub_node_index = safe_sub_node_index;
-		*sub_node       = sub_tree_node;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set parent node of node to append.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( libcdata_internal_tree_node_insert_sub_nodes_array_entry(
+	     internal_node,
+	     internal_node->number_of_sub_nodes,
+	     node_to_append,
+	     error ) != 1 )
 	{
-		*sub_node_index = internal_node->number_of_sub_nodes;
-		*sub_node       = NULL;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append node to sub nodes array.",
+		 function );
+
+		return( -1 );
 	}
-	return( result );
+	internal_node->number_of_sub_nodes += 1;
+
+	internal_node->number_of_descendants_is_stale = 1;
+	internal_node->sub_nodes_hash_table_is_stale  = 1;
+
+	return( 1 );
 }
 
-/* Inserts the node before the sub node
- * If sub_node is NULL the node is inserted before or as the first sub node in the list
- * Returns 1 if successful, or -1 on error
+/* Appends a tree node to the node
+ * Returns 1 if successful or -1 on error
  */
-int libcdata_internal_tree_node_insert_node_before_sub_node(
-     libcdata_internal_tree_node_t *internal_node,
-     libcdata_tree_node_t *sub_node,
-     libcdata_tree_node_t *node_to_insert,
+int libcdata_tree_node_append_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *node_to_append,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *backup_first_sub_node = NULL;
-	libcdata_tree_node_t *backup_last_sub_node  = NULL;
-	libcdata_tree_node_t *previous_node         = NULL;
-	static char *function                       = "libcdata_internal_tree_node_insert_node_before_sub_node";
+	libcdata_internal_tree_node_t *internal_node  = NULL;
+	libcdata_tree_node_t *to_append_next_node     = NULL;
+	libcdata_tree_node_t *to_append_parent_node   = NULL;
+	libcdata_tree_node_t *to_append_previous_node = NULL;
+	static char *function                         = "libcdata_tree_node_append_node";
+	int result                                    = 1;
 
-	if( internal_node == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node.",
-		 function );
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	libcdata_tree_node_t *backup_first_sub_node   = NULL;
+	libcdata_tree_node_t *backup_last_sub_node    = NULL;
+#endif
 
-		return( -1 );
-	}
-	if( node_to_insert == NULL )
+	if( node == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node to insert.",
+		 "%s: invalid node.",
 		 function );
 
 		return( -1 );
 	}
-	backup_first_sub_node = internal_node->first_sub_node;
-	backup_last_sub_node  = internal_node->last_sub_node;
+	internal_node = (libcdata_internal_tree_node_t *) node;
 
-	if( sub_node != NULL )
+	if( internal_node->number_of_sub_nodes == 0 )
 	{
-		if( libcdata_tree_node_get_previous_node(
-		     sub_node,
-		     &previous_node,
-		     error ) != 1 )
+		if( internal_node->first_sub_node != NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve previous node from sub node.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - first sub node already set.",
 			 function );
 
 			return( -1 );
 		}
-	}
-	if( internal_node->number_of_sub_nodes == 0 )
-	{
-		internal_node->first_sub_node = node_to_insert;
-		internal_node->last_sub_node  = node_to_insert;
-	}
-	else if( sub_node == NULL )
-	{
-		if( libcdata_internal_tree_node_set_last_sub_node(
-		     internal_node,
-		     node_to_insert,
-		     error ) != 1 )
+		if( internal_node->last_sub_node != NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set last sub node.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - last sub node already set.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
 	else
 	{
-		if( libcdata_tree_node_set_nodes(
-		     node_to_insert,
-		     (libcdata_tree_node_t *) internal_node,
-		     previous_node,
-		     sub_node,
-		     error ) != 1 )
+		if( internal_node->first_sub_node == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set parent, previous and next node of node to insert.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - missing first sub node.",
 			 function );
 
-			goto on_error;
-		}
-		if( internal_node->first_sub_node == sub_node )
-		{
-			internal_node->first_sub_node = node_to_insert;
-		}
-		else
-		{
-			if( libcdata_tree_node_set_next_node(
-			     previous_node,
-			     node_to_insert,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set next node of previous node.",
-				 function );
-
-				goto on_error;
-			}
+			return( -1 );
 		}
-		if( libcdata_tree_node_set_previous_node(
-		     sub_node,
-		     node_to_insert,
-		     error ) != 1 )
+		if( internal_node->last_sub_node == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set previous node of sub node.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - missing last sub node.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libcdata_tree_node_set_parent_node(
-	     node_to_insert,
-	     (libcdata_tree_node_t *) internal_node,
+	if( libcdata_tree_node_get_nodes(
+	     node_to_append,
+	     &to_append_parent_node,
+	     &to_append_previous_node,
+	     &to_append_next_node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set parent node of node to insert.",
-		 function );
-
-		goto on_error;
-	}
-	internal_node->number_of_sub_nodes += 1;
-
-	return( 1 );
-
-on_error:
-	if( node_to_insert != NULL )
-	{
-		libcdata_tree_node_set_nodes(
-		 node_to_insert,
-		 NULL,
-		 NULL,
-		 NULL,
-		 NULL );
-	}
-	if( previous_node != NULL )
-	{
-		libcdata_tree_node_set_next_node(
-		 previous_node,
-		 sub_node,
-		 NULL );
-	}
-	if( sub_node != NULL )
-	{
-		libcdata_tree_node_set_previous_node(
-		 sub_node,
-		 previous_node,
-		 NULL );
-	}
-	internal_node->first_sub_node = backup_first_sub_node;
-	internal_node->last_sub_node  = backup_last_sub_node;
-
-	return( -1 );
-}
-
-/* Inserts a sub node in the node
- *
- * Uses the value_compare_function to determine the order of the entries
- * The value_compare_function should return LIBCDATA_COMPARE_LESS,
- * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
- *
- * Duplicate entries are allowed by default and inserted after the last duplicate value.
- * Only allowing unique entries can be enforced by setting the flag LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES
- *
- * Returns 1 if successful, 0 if the node already exists or -1 on error
- */
-int libcdata_tree_node_insert_node(
-     libcdata_tree_node_t *node,
-     libcdata_tree_node_t *node_to_insert,
-     int (*value_compare_function)(
-            intptr_t *first_value,
-            intptr_t *second_value,
-            libcerror_error_t **error ),
-     uint8_t insert_flags,
-     libcerror_error_t **error )
-{
-	libcdata_internal_tree_node_t *internal_node = NULL;
-	libcdata_tree_node_t *next_node              = NULL;
-	libcdata_tree_node_t *parent_node            = NULL;
-	libcdata_tree_node_t *previous_node          = NULL;
-	libcdata_tree_node_t *sub_node               = NULL;
-	intptr_t *value_to_insert                    = NULL;
-	static char *function                        = "libcdata_tree_node_insert_node";
-	int result                                   = 1;
-	int sub_node_index                           = 0;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	libcdata_tree_node_t *backup_first_sub_node  = NULL;
-	libcdata_tree_node_t *backup_last_sub_node   = NULL;
-#endif
-
-	if( node == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node.",
-		 function );
-
-		return( -1 );
-	}
-	internal_node = (libcdata_internal_tree_node_t *) node;
-
-	if( internal_node->number_of_sub_nodes == 0 )
-	{
-		if( internal_node->first_sub_node != NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - first sub node already set.",
-			 function );
-
-			return( -1 );
-		}
-		if( internal_node->last_sub_node != NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - last sub node already set.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	else
-	{
-		if( internal_node->first_sub_node == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - missing first sub node.",
-			 function );
-
-			return( -1 );
-		}
-		if( internal_node->last_sub_node == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - missing last sub node.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( node_to_insert == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node to insert.",
-		 function );
-
-		return( -1 );
-	}
-	if( value_compare_function == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value compare function.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve nodes of node to append.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( insert_flags & ~( LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES ) ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported insert flags: 0x%02" PRIx8 ".",
-		 function,
-		 insert_flags );
-
-		return( -1 );
-	}
-	if( libcdata_tree_node_get_nodes(
-	     node_to_insert,
-	     &parent_node,
-	     &previous_node,
-	     &next_node,
-	     error ) != 1 )
+	if( ( to_append_parent_node != NULL )
+	 || ( to_append_previous_node != NULL )
+	 || ( to_append_next_node != NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve nodes of node to insert.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node to append - node is already part of a tree.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( parent_node != NULL )
-	 || ( previous_node != NULL )
-	 || ( next_node != NULL ) )
+	if( ( (libcdata_internal_tree_node_t *) node_to_append )->arena != internal_node->arena )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid node to insert - node is already part of a tree.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node to append - not allocated from the same arena.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_value(
-	     node_to_insert,
-	     &value_to_insert,
-	     error ) != 1 )
+	if( ( internal_node->arena != NULL )
+	 && ( internal_node->arena->root_node == node_to_append ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from node to insert.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node to append - node owns the arena.",
 		 function );
 
 		return( -1 );
@@ -2984,67 +3192,146 @@ int libcdata_tree_node_insert_node(
 	backup_last_sub_node  = internal_node->last_sub_node;
 #endif
 
-	result = libcdata_internal_tree_node_insert_node_find_sub_node(
+	result = libcdata_internal_tree_node_resize_sub_nodes_array(
 	          internal_node,
-	          value_to_insert,
-	          value_compare_function,
-	          insert_flags,
-	          &sub_node_index,
-	          &sub_node,
+	          internal_node->number_of_sub_nodes + 1,
 	          error );
 
-	if( result == -1 )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to find sub node in tree node.",
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sub nodes array.",
 		 function );
 
 		result = -1;
 	}
-	else if( result == 1 )
+	if( result == 1 )
 	{
-		if( sub_node != NULL )
+		result = libcdata_tree_node_set_parent_node(
+		          node_to_append,
+		          node,
+		          error );
+
+		if( result != 1 )
 		{
-			if( libcdata_tree_node_get_nodes(
-			     sub_node,
-			     &parent_node,
-			     &previous_node,
-			     &next_node,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve nodes of sub node: %d.",
-				 function,
-				 sub_node_index );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set parent node of node to append.",
+			 function );
 
-				result = -1;
-			}
+			result = -1;
 		}
-		if( result == 1 )
+	}
+	if( result == 1 )
+	{
+		result = libcdata_tree_node_set_previous_node(
+		          node_to_append,
+		          internal_node->last_sub_node,
+		          error );
+
+		if( result != 1 )
 		{
-			if( libcdata_internal_tree_node_insert_node_before_sub_node(
-			     internal_node,
-			     sub_node,
-			     node_to_insert,
-			     error ) != 1 )
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set previous node of node to append.",
+			 function );
+
+			libcdata_tree_node_set_parent_node(
+			 node_to_append,
+			 NULL,
+			 NULL );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( internal_node->last_sub_node != NULL )
+		{
+			result = libcdata_tree_node_set_next_node(
+			          internal_node->last_sub_node,
+			          node_to_append,
+			          error );
+
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to insert node before tree sub node.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set next node of last sub node.",
 				 function );
 
+				libcdata_tree_node_set_parent_node(
+				 node_to_append,
+				 NULL,
+				 NULL );
+
+				libcdata_tree_node_set_previous_node(
+				 node_to_append,
+				 NULL,
+				 NULL );
+
 				result = -1;
 			}
 		}
 	}
+	if( result == 1 )
+	{
+		result = libcdata_internal_tree_node_insert_sub_nodes_array_entry(
+		          internal_node,
+		          internal_node->number_of_sub_nodes,
+		          node_to_append,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append node to sub nodes array.",
+			 function );
+
+			libcdata_tree_node_set_parent_node(
+			 node_to_append,
+			 NULL,
+			 NULL );
+
+			libcdata_tree_node_set_previous_node(
+			 node_to_append,
+			 NULL,
+			 NULL );
+
+			if( internal_node->last_sub_node != NULL )
+			{
+				libcdata_tree_node_set_next_node(
+				 internal_node->last_sub_node,
+				 NULL,
+				 NULL );
+			}
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( internal_node->first_sub_node == NULL )
+		{
+			internal_node->first_sub_node = node_to_append;
+		}
+		internal_node->last_sub_node = node_to_append;
+
+		internal_node->number_of_sub_nodes += 1;
+
+		internal_node->sub_nodes_hash_table_is_stale = 1;
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_node->read_write_lock,
@@ -3060,71 +3347,61 @@ int libcdata_tree_node_insert_node(
 		goto on_error;
 	}
 #endif
-	return( result );
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-on_error:
 	if( result == 1 )
 	{
-		if( node_to_insert != NULL )
-		{
-			libcdata_tree_node_set_nodes(
-			 node_to_insert,
-			 NULL,
-			 NULL,
-			 NULL,
-			 NULL );
-		}
-		if( previous_node != NULL )
-		{
-			libcdata_tree_node_set_next_node(
-			 previous_node,
-			 sub_node,
-			 NULL );
-		}
-		if( sub_node != NULL )
+		if( libcdata_internal_tree_node_invalidate_number_of_descendants(
+		     internal_node,
+		     error ) != 1 )
 		{
-			libcdata_tree_node_set_previous_node(
-			 sub_node,
-			 previous_node,
-			 NULL );
-		}
-		internal_node->first_sub_node = backup_first_sub_node;
-		internal_node->last_sub_node  = backup_last_sub_node;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to invalidate number of descendants.",
+			 function );
 
-		internal_node->number_of_sub_nodes -= 1;
+			return( -1 );
+		}
 	}
-	return( -1 );
+	return( result );
 
-#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA ) */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+on_error:
+	libcdata_tree_node_set_parent_node(
+	 node_to_append,
+	 NULL,
+	 NULL );
+
+	libcdata_tree_node_set_previous_node(
+	 node_to_append,
+	 NULL,
+	 NULL );
+
+	internal_node->first_sub_node = backup_first_sub_node;
+	internal_node->last_sub_node  = backup_last_sub_node;
+
+	libcdata_internal_tree_node_remove_sub_nodes_array_entry(
+	 internal_node,
+	 internal_node->number_of_sub_nodes - 1,
+	 NULL );
+
+	internal_node->number_of_sub_nodes -= 1;
+
+	return( -1 );
+#endif
 }
 
-/* Inserts a value in the node
- *
+/* Appends a value to the node
  * Creates a new sub tree node
- *
- * Uses the value_compare_function to determine the order of the entries
- * The value_compare_function should return LIBCDATA_COMPARE_LESS,
- * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
- *
- * Duplicate entries are allowed by default and inserted after the last duplicate value.
- * Only allowing unique entries can be enforced by setting the flag LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES
- *
- * Returns 1 if successful, 0 if the node already exists or -1 on error
+ * Returns 1 if successful or -1 on error
  */
-int libcdata_tree_node_insert_value(
+int libcdata_tree_node_append_value(
      libcdata_tree_node_t *node,
      intptr_t *value,
-     int (*value_compare_function)(
-            intptr_t *first_value,
-            intptr_t *second_value,
-            libcerror_error_t **error ),
-     uint8_t insert_flags,
      libcerror_error_t **error )
 {
 	libcdata_tree_node_t *sub_node = NULL;
-	static char *function          = "libcdata_tree_node_insert_value";
-	int result                     = 0;
+	static char *function          = "libcdata_tree_node_append_value";
 
 	if( node == NULL )
 	{
@@ -3137,8 +3414,9 @@ int libcdata_tree_node_insert_value(
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_initialize(
+	if( libcdata_tree_node_initialize_in_arena(
 	     &sub_node,
+	     node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3164,48 +3442,21 @@ int libcdata_tree_node_insert_value(
 
 		goto on_error;
 	}
-	result = libcdata_tree_node_insert_node(
-	          node,
-	          sub_node,
-	          value_compare_function,
-	          insert_flags,
-	          error );
-
-	if( result == -1 )
+	if( libcdata_tree_node_append_node(
+	     node,
+	     sub_node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert node.",
+		 "%s: unable to append sub node to node.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result == 0 )
-	{
-		if( libcdata_internal_tree_node_free(
-		     (libcdata_internal_tree_node_t **) &sub_node,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub node.",
-			 function );
-
-			goto on_error;
-		}
-	}
-#if defined( __clang_analyzer__ )
-	else
-	{
-		__builtin_assume( ( (libcdata_internal_tree_node_t *) node )->first_sub_node == sub_node );
-	}
-#endif
-	return( result );
+	return( 1 );
 
 on_error:
 	if( sub_node != NULL )
@@ -3218,29 +3469,43 @@ on_error:
 	return( -1 );
 }
 
-/* Replaces a tree node with another tree node
- * Returns 1 if successful or -1 on error
+
+/* Retrieves the node which the sub node should be inserted before
+ *
+ * Uses the value_compare_function to determine the order of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * Duplicate entries are allowed by default and inserted after the last duplicate value.
+ * Only allowing unique entries can be enforced by setting the flag LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES
+ *
+ * On return sub_node will be set to NULL if the sub node should be inserted at the end of the list.
+ *
+ * If the node has a sub nodes array it is searched using binary search,
+ * otherwise the sub nodes are searched sequentially
+ *
+ * Returns 1 if successful, 0 if a sub node containing the value already exists or -1 on error
  */
-int libcdata_tree_node_replace_node(
-     libcdata_tree_node_t *node,
-     libcdata_tree_node_t *replacement_node,
+int libcdata_internal_tree_node_insert_node_find_sub_node(
+     libcdata_internal_tree_node_t *internal_node,
+     intptr_t *value_to_insert,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     uint8_t insert_flags,
+     int *sub_node_index,
+     libcdata_tree_node_t **sub_node,
      libcerror_error_t **error )
 {
-	libcdata_internal_tree_node_t *internal_node       = NULL;
-	libcdata_tree_node_t *backup_parent_first_sub_node = NULL;
-	libcdata_tree_node_t *backup_parent_last_sub_node  = NULL;
-	libcdata_tree_node_t *next_node                    = NULL;
-	libcdata_tree_node_t *parent_first_sub_node        = NULL;
-	libcdata_tree_node_t *parent_last_sub_node         = NULL;
-	libcdata_tree_node_t *parent_node                  = NULL;
-	libcdata_tree_node_t *previous_node                = NULL;
-	libcdata_tree_node_t *replacement_next_node        = NULL;
-	libcdata_tree_node_t *replacement_parent_node      = NULL;
-	libcdata_tree_node_t *replacement_previous_node    = NULL;
-	static char *function                              = "libcdata_tree_node_replace_node";
-	int result                                         = 1;
+	libcdata_tree_node_t *sub_tree_node = NULL;
+	intptr_t *sub_node_value            = NULL;
+	static char *function               = "libcdata_internal_tree_node_insert_node_find_sub_node";
+	int compare_result                  = 0;
+	int result                          = 1;
+	int safe_sub_node_index             = 0;
 
-	if( node == NULL )
+	if( internal_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3251,161 +3516,339 @@ int libcdata_tree_node_replace_node(
 
 		return( -1 );
 	}
-	internal_node = (libcdata_internal_tree_node_t *) node;
+	if( value_compare_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value compare function.",
+		 function );
 
-	if( replacement_node == NULL )
+		return( -1 );
+	}
+	if( ( insert_flags & ~( LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported insert flags: 0x%02" PRIx8 ".",
+		 function,
+		 insert_flags );
+
+		return( -1 );
+	}
+	if( sub_node_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid replacement node.",
+		 "%s: invalid sub node index.",
 		 function );
 
 		return( -1 );
 	}
-	if( replacement_node == node )
+	if( sub_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: cannot replace node with itself.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_nodes(
-	     replacement_node,
-	     &replacement_parent_node,
-	     &replacement_previous_node,
-	     &replacement_next_node,
-	     error ) != 1 )
+	if( internal_node->sub_nodes_array != NULL )
+	{
+		result = libcdata_internal_tree_node_bisect_sub_nodes_array(
+		          internal_node,
+		          value_to_insert,
+		          value_compare_function,
+		          (uint8_t) ( ( insert_flags & LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES ) == 0 ),
+		          &safe_sub_node_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to search sub nodes array.",
+			 function );
+
+			return( -1 );
+		}
+		*sub_node_index = safe_sub_node_index;
+
+		if( safe_sub_node_index < internal_node->number_of_sub_nodes )
+		{
+			*sub_node = internal_node->sub_nodes_array[ safe_sub_node_index ];
+		}
+		else
+		{
+			*sub_node = NULL;
+		}
+		/* The sub node is only equal to the value if unique entries are enforced
+		 */
+		if( result == 1 )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	sub_tree_node = internal_node->first_sub_node;
+
+	for( safe_sub_node_index = 0;
+	     safe_sub_node_index < internal_node->number_of_sub_nodes;
+	     safe_sub_node_index++ )
+	{
+		if( libcdata_tree_node_get_value(
+		     sub_tree_node,
+		     &sub_node_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value of sub node: %d.",
+			 function,
+			 safe_sub_node_index );
+
+			return( -1 );
+		}
+		compare_result = value_compare_function(
+		                  value_to_insert,
+		                  sub_node_value,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare sub node: %d.",
+			 function,
+			 safe_sub_node_index );
+
+			return( -1 );
+		}
+		else if( compare_result == LIBCDATA_COMPARE_EQUAL )
+		{
+			if( ( insert_flags & LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES ) != 0 )
+			{
+				result = 0;
+
+				break;
+			}
+		}
+		else if( compare_result == LIBCDATA_COMPARE_LESS )
+		{
+			break;
+		}
+		else if( compare_result != LIBCDATA_COMPARE_GREATER )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value compare function return value: %d.",
+			 function,
+			 result );
+
+			return( -1 );
+		}
+		if( libcdata_tree_node_get_next_node(
+		     sub_tree_node,
+		     &sub_tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node of sub node: %d.",
+			 function,
+			 safe_sub_node_index );
+
+			return( -1 );
+		}
+	}
+	if( ( compare_result == LIBCDATA_COMPARE_EQUAL )
+	 || ( compare_result == LIBCDATA_COMPARE_LESS ) )
+	{
+		*sub_node_index = safe_sub_node_index;
+		*sub_node       = sub_tree_node;
+	}
+	else
+	{
+		*sub_node_index = internal_node->number_of_sub_nodes;
+		*sub_node       = NULL;
+	}
+	return( result );
+}
+
+/* Inserts the node before the sub node
+ * If sub_node is NULL the node is inserted before or as the first sub node in the list
+ * Returns 1 if successful, or -1 on error
+ */
+int libcdata_internal_tree_node_insert_node_before_sub_node(
+     libcdata_internal_tree_node_t *internal_node,
+     libcdata_tree_node_t *sub_node,
+     libcdata_tree_node_t *node_to_insert,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *backup_first_sub_node = NULL;
+	libcdata_tree_node_t *backup_last_sub_node  = NULL;
+	libcdata_tree_node_t *previous_node         = NULL;
+	static char *function                       = "libcdata_internal_tree_node_insert_node_before_sub_node";
+	int entry_index                             = 0;
+	int result                                  = 0;
+
+	if( internal_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve nodes of replacement node.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( replacement_parent_node != NULL )
-	 || ( replacement_previous_node != NULL )
-	 || ( replacement_next_node != NULL ) )
+	if( node_to_insert == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid replacement node - already part of a tree.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node to insert.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_node->read_write_lock,
+	if( libcdata_internal_tree_node_resize_sub_nodes_array(
+	     internal_node,
+	     internal_node->number_of_sub_nodes + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sub nodes array.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	parent_node   = internal_node->parent_node;
-	previous_node = internal_node->previous_node;
-	next_node     = internal_node->next_node;
+	entry_index = internal_node->number_of_sub_nodes;
 
-	if( parent_node != NULL )
+	if( sub_node != NULL )
 	{
-		if( libcdata_tree_node_get_sub_nodes(
-		     parent_node,
-		     &parent_first_sub_node,
-		     &parent_last_sub_node,
-		     error ) != 1 )
+		result = libcdata_internal_tree_node_get_sub_nodes_array_entry_index(
+		          internal_node,
+		          sub_node,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub nodes of parent node.",
+			 "%s: unable to retrieve sub nodes array entry index of sub node.",
 			 function );
 
-			result = -1;
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      && ( internal_node->sub_nodes_array != NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - missing sub node in sub nodes array.",
+			 function );
+
+			return( -1 );
 		}
 	}
-	if( result == 1 )
+	backup_first_sub_node = internal_node->first_sub_node;
+	backup_last_sub_node  = internal_node->last_sub_node;
+
+	if( sub_node != NULL )
 	{
-		if( libcdata_tree_node_set_nodes(
-		     replacement_node,
-		     parent_node,
-		     previous_node,
-		     next_node,
+		if( libcdata_tree_node_get_previous_node(
+		     sub_node,
+		     &previous_node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set nodes of replacement node.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve previous node from sub node.",
 			 function );
 
-			result = -1;
+			return( -1 );
 		}
 	}
-	if( result == 1 )
+	if( internal_node->number_of_sub_nodes == 0 )
 	{
-		if( parent_node != NULL )
+		internal_node->first_sub_node = node_to_insert;
+		internal_node->last_sub_node  = node_to_insert;
+	}
+	else if( sub_node == NULL )
+	{
+		if( libcdata_internal_tree_node_set_last_sub_node(
+		     internal_node,
+		     node_to_insert,
+		     error ) != 1 )
 		{
-			backup_parent_first_sub_node = parent_first_sub_node;
-			backup_parent_last_sub_node  = parent_last_sub_node;
-
-			if( parent_first_sub_node == node )
-			{
-				parent_first_sub_node = replacement_node;
-			}
-			if( parent_last_sub_node == node )
-			{
-				parent_last_sub_node = replacement_node;
-			}
-			if( libcdata_tree_node_set_sub_nodes(
-			     parent_node,
-			     parent_first_sub_node,
-			     parent_last_sub_node,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set sub nodes of parent node.",
-				 function );
-
-				libcdata_tree_node_set_nodes(
-				 replacement_node,
-				 NULL,
-				 NULL,
-				 NULL,
-				 NULL );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set last sub node.",
+			 function );
 
-				result = -1;
-			}
+			goto on_error;
 		}
 	}
-	if( result == 1 )
+	else
 	{
-		if( previous_node != NULL )
+		if( libcdata_tree_node_set_nodes(
+		     node_to_insert,
+		     (libcdata_tree_node_t *) internal_node,
+		     previous_node,
+		     sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set parent, previous and next node of node to insert.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_node->first_sub_node == sub_node )
+		{
+			internal_node->first_sub_node = node_to_insert;
+		}
+		else
 		{
 			if( libcdata_tree_node_set_next_node(
 			     previous_node,
-			     replacement_node,
+			     node_to_insert,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -3415,150 +3858,107 @@ int libcdata_tree_node_replace_node(
 				 "%s: unable to set next node of previous node.",
 				 function );
 
-				libcdata_tree_node_set_nodes(
-				 replacement_node,
-				 NULL,
-				 NULL,
-				 NULL,
-				 NULL );
-
-				if( parent_node != NULL )
-				{
-					libcdata_tree_node_set_sub_nodes(
-					 parent_node,
-					 backup_parent_first_sub_node,
-					 backup_parent_last_sub_node,
-					 NULL );
-				}
-				result = -1;
+				goto on_error;
 			}
 		}
-	}
-	if( result == 1 )
-	{
-		if( next_node != NULL )
+		if( libcdata_tree_node_set_previous_node(
+		     sub_node,
+		     node_to_insert,
+		     error ) != 1 )
 		{
-			if( libcdata_tree_node_set_previous_node(
-			     next_node,
-			     replacement_node,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set previous node of next node.",
-				 function );
-
-				libcdata_tree_node_set_nodes(
-				 replacement_node,
-				 NULL,
-				 NULL,
-				 NULL,
-				 NULL );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set previous node of sub node.",
+			 function );
 
-				if( parent_node != NULL )
-				{
-					libcdata_tree_node_set_sub_nodes(
-					 parent_node,
-					 backup_parent_first_sub_node,
-					 backup_parent_last_sub_node,
-					 NULL );
-				}
-				if( previous_node != NULL )
-				{
-					libcdata_tree_node_set_next_node(
-					 previous_node,
-					 node,
-					 NULL );
-				}
-				result = -1;
-			}
+			goto on_error;
 		}
 	}
-	if( result == 1 )
+	if( libcdata_tree_node_set_parent_node(
+	     node_to_insert,
+	     (libcdata_tree_node_t *) internal_node,
+	     error ) != 1 )
 	{
-		internal_node->parent_node   = NULL;
-		internal_node->previous_node = NULL;
-		internal_node->next_node     = NULL;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set parent node of node to insert.",
+		 function );
+
+		goto on_error;
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_node->read_write_lock,
+	if( libcdata_internal_tree_node_insert_sub_nodes_array_entry(
+	     internal_node,
+	     entry_index,
+	     node_to_insert,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert node in sub nodes array.",
 		 function );
 
 		goto on_error;
 	}
-#endif
-	return( result );
+	internal_node->number_of_sub_nodes += 1;
+
+	internal_node->sub_nodes_hash_table_is_stale = 1;
+
+	return( 1 );
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 on_error:
-	if( result == 1 )
+	if( node_to_insert != NULL )
 	{
 		libcdata_tree_node_set_nodes(
-		 replacement_node,
+		 node_to_insert,
 		 NULL,
 		 NULL,
 		 NULL,
 		 NULL );
-
-		if( parent_node != NULL )
-		{
-			libcdata_tree_node_set_sub_nodes(
-			 parent_node,
-			 backup_parent_first_sub_node,
-			 backup_parent_last_sub_node,
-			 NULL );
-		}
-		if( previous_node != NULL )
-		{
-			libcdata_tree_node_set_next_node(
-			 previous_node,
-			 node,
-			 NULL );
-		}
-		if( next_node != NULL )
-		{
-			libcdata_tree_node_set_previous_node(
-			 next_node,
-			 node,
-			 NULL );
-		}
-		internal_node->parent_node   = parent_node;
-		internal_node->previous_node = previous_node;
-		internal_node->next_node     = next_node;
 	}
+	if( previous_node != NULL )
+	{
+		libcdata_tree_node_set_next_node(
+		 previous_node,
+		 sub_node,
+		 NULL );
+	}
+	if( sub_node != NULL )
+	{
+		libcdata_tree_node_set_previous_node(
+		 sub_node,
+		 previous_node,
+		 NULL );
+	}
+	internal_node->first_sub_node = backup_first_sub_node;
+	internal_node->last_sub_node  = backup_last_sub_node;
+
 	return( -1 );
-#endif
 }
 
-/* Removes a sub tree node from the tree node
+/* Inserts a tree node before a specific sub node of the node
+ * If sub_node is NULL the node is appended
+ * This function grabs the write lock of the node
  * Returns 1 if successful or -1 on error
  */
-int libcdata_tree_node_remove_node(
+int libcdata_internal_tree_node_insert_node_before_sub_node_with_lock(
      libcdata_tree_node_t *node,
-     libcdata_tree_node_t *sub_node_to_remove,
+     libcdata_tree_node_t *sub_node,
+     libcdata_tree_node_t *node_to_insert,
      libcerror_error_t **error )
 {
-	libcdata_internal_tree_node_t *internal_node = NULL;
-	libcdata_tree_node_t *next_node              = NULL;
-	libcdata_tree_node_t *parent_node            = NULL;
-	libcdata_tree_node_t *previous_node          = NULL;
-	static char *function                        = "libcdata_tree_node_remove_node";
-	int result                                   = 1;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	libcdata_tree_node_t *backup_first_sub_node  = NULL;
-	libcdata_tree_node_t *backup_last_sub_node   = NULL;
-#endif
+	libcdata_internal_tree_node_t *internal_node  = NULL;
+	libcdata_tree_node_t *sub_node_parent_node    = NULL;
+	libcdata_tree_node_t *to_insert_next_node     = NULL;
+	libcdata_tree_node_t *to_insert_parent_node   = NULL;
+	libcdata_tree_node_t *to_insert_previous_node = NULL;
+	static char *function                         = "libcdata_internal_tree_node_insert_node_before_sub_node_with_lock";
+	int result                                    = 0;
 
 	if( node == NULL )
 	{
@@ -3573,296 +3973,4270 @@ int libcdata_tree_node_remove_node(
 	}
 	internal_node = (libcdata_internal_tree_node_t *) node;
 
-	if( internal_node->number_of_sub_nodes == 0 )
+	if( sub_node == NULL )
 	{
-		if( internal_node->first_sub_node != NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - first sub node already set.",
-			 function );
-
-			return( -1 );
-		}
-		if( internal_node->last_sub_node != NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - last sub node already set.",
-			 function );
-
-			return( -1 );
-		}
+		return( libcdata_tree_node_append_node(
+		         node,
+		         node_to_insert,
+		         error ) );
 	}
-	else
+	if( libcdata_tree_node_get_parent_node(
+	     sub_node,
+	     &sub_node_parent_node,
+	     error ) != 1 )
 	{
-		if( internal_node->first_sub_node == NULL )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent node of sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node_parent_node != node )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid sub node - not a sub node of the node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_nodes(
+	     node_to_insert,
+	     &to_insert_parent_node,
+	     &to_insert_previous_node,
+	     &to_insert_next_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve nodes of node to insert.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( to_insert_parent_node != NULL )
+	 || ( to_insert_previous_node != NULL )
+	 || ( to_insert_next_node != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node to insert - node is already part of a tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (libcdata_internal_tree_node_t *) node_to_insert )->arena != internal_node->arena )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node to insert - not allocated from the same arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_node->arena != NULL )
+	 && ( internal_node->arena->root_node == node_to_insert ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node to insert - node owns the arena.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_internal_tree_node_insert_node_before_sub_node(
+	          internal_node,
+	          sub_node,
+	          node_to_insert,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert node before tree sub node.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		if( libcdata_internal_tree_node_invalidate_number_of_descendants(
+		     internal_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to invalidate number of descendants.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Inserts a sub node in the node
+ *
+ * Uses the value_compare_function to determine the order of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * Duplicate entries are allowed by default and inserted after the last duplicate value.
+ * Only allowing unique entries can be enforced by setting the flag LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES
+ *
+ * Returns 1 if successful, 0 if the node already exists or -1 on error
+ */
+int libcdata_tree_node_insert_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *node_to_insert,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     uint8_t insert_flags,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_node_t *internal_node = NULL;
+	libcdata_tree_node_t *next_node              = NULL;
+	libcdata_tree_node_t *parent_node            = NULL;
+	libcdata_tree_node_t *previous_node          = NULL;
+	libcdata_tree_node_t *sub_node               = NULL;
+	intptr_t *value_to_insert                    = NULL;
+	static char *function                        = "libcdata_tree_node_insert_node";
+	int result                                   = 1;
+	int sub_node_index                           = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	libcdata_tree_node_t *backup_first_sub_node  = NULL;
+	libcdata_tree_node_t *backup_last_sub_node   = NULL;
+#endif
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	internal_node = (libcdata_internal_tree_node_t *) node;
+
+	if( internal_node->number_of_sub_nodes == 0 )
+	{
+		if( internal_node->first_sub_node != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - first sub node already set.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_node->last_sub_node != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - last sub node already set.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( internal_node->first_sub_node == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - missing first sub node.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_node->last_sub_node == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - missing last sub node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( node_to_insert == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node to insert.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_compare_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value compare function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( insert_flags & ~( LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported insert flags: 0x%02" PRIx8 ".",
+		 function,
+		 insert_flags );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_nodes(
+	     node_to_insert,
+	     &parent_node,
+	     &previous_node,
+	     &next_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve nodes of node to insert.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parent_node != NULL )
+	 || ( previous_node != NULL )
+	 || ( next_node != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node to insert - node is already part of a tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (libcdata_internal_tree_node_t *) node_to_insert )->arena != internal_node->arena )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node to insert - not allocated from the same arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_node->arena != NULL )
+	 && ( internal_node->arena->root_node == node_to_insert ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node to insert - node owns the arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_value(
+	     node_to_insert,
+	     &value_to_insert,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from node to insert.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	backup_first_sub_node = internal_node->first_sub_node;
+	backup_last_sub_node  = internal_node->last_sub_node;
+#endif
+
+	result = libcdata_internal_tree_node_insert_node_find_sub_node(
+	          internal_node,
+	          value_to_insert,
+	          value_compare_function,
+	          insert_flags,
+	          &sub_node_index,
+	          &sub_node,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to find sub node in tree node.",
+		 function );
+
+		result = -1;
+	}
+	else if( result == 1 )
+	{
+		if( sub_node != NULL )
+		{
+			if( libcdata_tree_node_get_nodes(
+			     sub_node,
+			     &parent_node,
+			     &previous_node,
+			     &next_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve nodes of sub node: %d.",
+				 function,
+				 sub_node_index );
+
+				result = -1;
+			}
+		}
+		if( result == 1 )
+		{
+			if( libcdata_internal_tree_node_insert_node_before_sub_node(
+			     internal_node,
+			     sub_node,
+			     node_to_insert,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert node before tree sub node.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == 1 )
+	{
+		if( libcdata_internal_tree_node_invalidate_number_of_descendants(
+		     internal_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to invalidate number of descendants.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+on_error:
+	if( result == 1 )
+	{
+		if( node_to_insert != NULL )
+		{
+			libcdata_tree_node_set_nodes(
+			 node_to_insert,
+			 NULL,
+			 NULL,
+			 NULL,
+			 NULL );
+		}
+		if( previous_node != NULL )
+		{
+			libcdata_tree_node_set_next_node(
+			 previous_node,
+			 sub_node,
+			 NULL );
+		}
+		if( sub_node != NULL )
+		{
+			libcdata_tree_node_set_previous_node(
+			 sub_node,
+			 previous_node,
+			 NULL );
+		}
+		internal_node->first_sub_node = backup_first_sub_node;
+		internal_node->last_sub_node  = backup_last_sub_node;
+
+		if( libcdata_internal_tree_node_get_sub_nodes_array_entry_index(
+		     internal_node,
+		     node_to_insert,
+		     &sub_node_index,
+		     NULL ) == 1 )
+		{
+			libcdata_internal_tree_node_remove_sub_nodes_array_entry(
+			 internal_node,
+			 sub_node_index,
+			 NULL );
+		}
+		internal_node->number_of_sub_nodes -= 1;
+	}
+	return( -1 );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA ) */
+}
+
+/* Inserts a value in the node
+ *
+ * Creates a new sub tree node
+ *
+ * Uses the value_compare_function to determine the order of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * Duplicate entries are allowed by default and inserted after the last duplicate value.
+ * Only allowing unique entries can be enforced by setting the flag LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES
+ *
+ * Returns 1 if successful, 0 if the node already exists or -1 on error
+ */
+int libcdata_tree_node_insert_value(
+     libcdata_tree_node_t *node,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     uint8_t insert_flags,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *sub_node = NULL;
+	static char *function          = "libcdata_tree_node_insert_value";
+	int result                     = 0;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_initialize_in_arena(
+	     &sub_node,
+	     node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_tree_node_set_value(
+	     sub_node,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to set value in sub node.",
+		 function );
+
+		goto on_error;
+	}
+	result = libcdata_tree_node_insert_node(
+	          node,
+	          sub_node,
+	          value_compare_function,
+	          insert_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert node.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libcdata_internal_tree_node_free(
+		     (libcdata_internal_tree_node_t **) &sub_node,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub node.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( __clang_analyzer__ )
+	else
+	{
+		__builtin_assume( ( (libcdata_internal_tree_node_t *) node )->first_sub_node == sub_node );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( sub_node != NULL )
+	{
+		libcdata_internal_tree_node_free(
+		 (libcdata_internal_tree_node_t **) &sub_node,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Replaces a tree node with another tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_replace_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *replacement_node,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_node_t *internal_node       = NULL;
+	libcdata_tree_node_t *backup_parent_first_sub_node = NULL;
+	libcdata_tree_node_t *backup_parent_last_sub_node  = NULL;
+	libcdata_tree_node_t *next_node                    = NULL;
+	libcdata_tree_node_t *parent_first_sub_node        = NULL;
+	libcdata_tree_node_t *parent_last_sub_node         = NULL;
+	libcdata_tree_node_t *parent_node                  = NULL;
+	libcdata_tree_node_t *previous_node                = NULL;
+	libcdata_tree_node_t *replacement_next_node        = NULL;
+	libcdata_tree_node_t *replacement_parent_node      = NULL;
+	libcdata_tree_node_t *replacement_previous_node    = NULL;
+	static char *function                              = "libcdata_tree_node_replace_node";
+	int result                                         = 1;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	internal_node = (libcdata_internal_tree_node_t *) node;
+
+	if( replacement_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replacement node.",
+		 function );
+
+		return( -1 );
+	}
+	if( replacement_node == node )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: cannot replace node with itself.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_nodes(
+	     replacement_node,
+	     &replacement_parent_node,
+	     &replacement_previous_node,
+	     &replacement_next_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve nodes of replacement node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( replacement_parent_node != NULL )
+	 || ( replacement_previous_node != NULL )
+	 || ( replacement_next_node != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid replacement node - already part of a tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (libcdata_internal_tree_node_t *) replacement_node )->arena != internal_node->arena )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid replacement node - not allocated from the same arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_node->arena != NULL )
+	 && ( internal_node->arena->root_node == replacement_node ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid replacement node - node owns the arena.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	parent_node   = internal_node->parent_node;
+	previous_node = internal_node->previous_node;
+	next_node     = internal_node->next_node;
+
+	if( parent_node != NULL )
+	{
+		if( libcdata_tree_node_get_sub_nodes(
+		     parent_node,
+		     &parent_first_sub_node,
+		     &parent_last_sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub nodes of parent node.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libcdata_tree_node_set_nodes(
+		     replacement_node,
+		     parent_node,
+		     previous_node,
+		     next_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set nodes of replacement node.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( parent_node != NULL )
+		{
+			backup_parent_first_sub_node = parent_first_sub_node;
+			backup_parent_last_sub_node  = parent_last_sub_node;
+
+			if( parent_first_sub_node == node )
+			{
+				parent_first_sub_node = replacement_node;
+			}
+			if( parent_last_sub_node == node )
+			{
+				parent_last_sub_node = replacement_node;
+			}
+			if( libcdata_tree_node_set_sub_nodes(
+			     parent_node,
+			     parent_first_sub_node,
+			     parent_last_sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set sub nodes of parent node.",
+				 function );
+
+				libcdata_tree_node_set_nodes(
+				 replacement_node,
+				 NULL,
+				 NULL,
+				 NULL,
+				 NULL );
+
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		if( previous_node != NULL )
+		{
+			if( libcdata_tree_node_set_next_node(
+			     previous_node,
+			     replacement_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set next node of previous node.",
+				 function );
+
+				libcdata_tree_node_set_nodes(
+				 replacement_node,
+				 NULL,
+				 NULL,
+				 NULL,
+				 NULL );
+
+				if( parent_node != NULL )
+				{
+					libcdata_tree_node_set_sub_nodes(
+					 parent_node,
+					 backup_parent_first_sub_node,
+					 backup_parent_last_sub_node,
+					 NULL );
+				}
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		if( next_node != NULL )
+		{
+			if( libcdata_tree_node_set_previous_node(
+			     next_node,
+			     replacement_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set previous node of next node.",
+				 function );
+
+				libcdata_tree_node_set_nodes(
+				 replacement_node,
+				 NULL,
+				 NULL,
+				 NULL,
+				 NULL );
+
+				if( parent_node != NULL )
+				{
+					libcdata_tree_node_set_sub_nodes(
+					 parent_node,
+					 backup_parent_first_sub_node,
+					 backup_parent_last_sub_node,
+					 NULL );
+				}
+				if( previous_node != NULL )
+				{
+					libcdata_tree_node_set_next_node(
+					 previous_node,
+					 node,
+					 NULL );
+				}
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		if( parent_node != NULL )
+		{
+			if( libcdata_internal_tree_node_replace_sub_nodes_array_entry(
+			     parent_node,
+			     node,
+			     replacement_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to replace node in sub nodes array of parent node.",
+				 function );
+
+				libcdata_tree_node_set_nodes(
+				 replacement_node,
+				 NULL,
+				 NULL,
+				 NULL,
+				 NULL );
+
+				libcdata_tree_node_set_sub_nodes(
+				 parent_node,
+				 backup_parent_first_sub_node,
+				 backup_parent_last_sub_node,
+				 NULL );
+
+				if( previous_node != NULL )
+				{
+					libcdata_tree_node_set_next_node(
+					 previous_node,
+					 node,
+					 NULL );
+				}
+				if( next_node != NULL )
+				{
+					libcdata_tree_node_set_previous_node(
+					 next_node,
+					 node,
+					 NULL );
+				}
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		internal_node->parent_node   = NULL;
+		internal_node->previous_node = NULL;
+		internal_node->next_node     = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == 1 )
+	{
+		if( libcdata_internal_tree_node_invalidate_number_of_descendants(
+		     (libcdata_internal_tree_node_t *) parent_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to invalidate number of descendants.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+on_error:
+	if( result == 1 )
+	{
+		libcdata_tree_node_set_nodes(
+		 replacement_node,
+		 NULL,
+		 NULL,
+		 NULL,
+		 NULL );
+
+		if( parent_node != NULL )
+		{
+			libcdata_tree_node_set_sub_nodes(
+			 parent_node,
+			 backup_parent_first_sub_node,
+			 backup_parent_last_sub_node,
+			 NULL );
+
+			libcdata_internal_tree_node_replace_sub_nodes_array_entry(
+			 parent_node,
+			 replacement_node,
+			 node,
+			 NULL );
+		}
+		if( previous_node != NULL )
+		{
+			libcdata_tree_node_set_next_node(
+			 previous_node,
+			 node,
+			 NULL );
+		}
+		if( next_node != NULL )
+		{
+			libcdata_tree_node_set_previous_node(
+			 next_node,
+			 node,
+			 NULL );
+		}
+		internal_node->parent_node   = parent_node;
+		internal_node->previous_node = previous_node;
+		internal_node->next_node     = next_node;
+	}
+	return( -1 );
+#endif
+}
+
+/* Removes a sub tree node from the tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_remove_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *sub_node_to_remove,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_node_t *internal_node = NULL;
+	libcdata_tree_node_t *next_node              = NULL;
+	libcdata_tree_node_t *parent_node            = NULL;
+	libcdata_tree_node_t *previous_node          = NULL;
+	static char *function                        = "libcdata_tree_node_remove_node";
+	int entry_index                              = 0;
+	int result                                   = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	libcdata_tree_node_t *backup_first_sub_node  = NULL;
+	libcdata_tree_node_t *backup_last_sub_node   = NULL;
+#endif
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	internal_node = (libcdata_internal_tree_node_t *) node;
+
+	if( internal_node->number_of_sub_nodes == 0 )
+	{
+		if( internal_node->first_sub_node != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - first sub node already set.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_node->last_sub_node != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - last sub node already set.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( internal_node->first_sub_node == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - missing first sub node.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_node->last_sub_node == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: corruption detected - missing last sub node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( sub_node_to_remove == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node to remove.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_node->number_of_sub_nodes == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid node - missing number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_node->first_sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid node - missing first sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_node->last_sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid node - missing last sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_nodes(
+	     sub_node_to_remove,
+	     &parent_node,
+	     &previous_node,
+	     &next_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve nodes of node to remove.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_node != node )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node to remove - parent node mismatch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	backup_first_sub_node = internal_node->first_sub_node;
+	backup_last_sub_node  = internal_node->last_sub_node;
+#endif
+	result = libcdata_internal_tree_node_get_sub_nodes_array_entry_index(
+	          internal_node,
+	          sub_node_to_remove,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub nodes array entry index of node to remove.",
+		 function );
+	}
+	else if( ( result == 0 )
+	      && ( internal_node->sub_nodes_array != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: corruption detected - missing node to remove in sub nodes array.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libcdata_tree_node_set_nodes(
+		          sub_node_to_remove,
+		          NULL,
+		          NULL,
+		          NULL,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set nodes of node to remove.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( next_node != NULL )
+		{
+			if( libcdata_tree_node_set_previous_node(
+			     next_node,
+			     previous_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set previous node of next node.",
+				 function );
+
+				libcdata_tree_node_set_nodes(
+				 sub_node_to_remove,
+				 parent_node,
+				 previous_node,
+				 next_node,
+				 NULL );
+
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		if( previous_node != NULL )
+		{
+			if( libcdata_tree_node_set_next_node(
+			     previous_node,
+			     next_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set next node of previous node.",
+				 function );
+
+				libcdata_tree_node_set_nodes(
+				 sub_node_to_remove,
+				 parent_node,
+				 previous_node,
+				 next_node,
+				 NULL );
+
+				if( next_node != NULL )
+				{
+					libcdata_tree_node_set_previous_node(
+					 next_node,
+					 sub_node_to_remove,
+					 NULL );
+				}
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		if( internal_node->first_sub_node == sub_node_to_remove )
+		{
+			internal_node->first_sub_node = next_node;
+		}
+		if( internal_node->last_sub_node == sub_node_to_remove )
+		{
+			internal_node->last_sub_node = previous_node;
+		}
+		libcdata_internal_tree_node_remove_sub_nodes_array_entry(
+		 internal_node,
+		 entry_index,
+		 NULL );
+
+		internal_node->number_of_sub_nodes -= 1;
+
+		internal_node->sub_nodes_hash_table_is_stale = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == 1 )
+	{
+		if( libcdata_internal_tree_node_invalidate_number_of_descendants(
+		     internal_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to invalidate number of descendants.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+on_error:
+	if( result == 1 )
+	{
+		libcdata_tree_node_set_nodes(
+		 sub_node_to_remove,
+		 parent_node,
+		 previous_node,
+		 next_node,
+		 NULL );
+
+		if( next_node != NULL )
+		{
+			libcdata_tree_node_set_previous_node(
+			 next_node,
+			 sub_node_to_remove,
+			 NULL );
+		}
+		if( previous_node != NULL )
+		{
+			libcdata_tree_node_set_next_node(
+			 previous_node,
+			 sub_node_to_remove,
+			 NULL );
+		}
+		internal_node->first_sub_node = backup_first_sub_node;
+		internal_node->last_sub_node  = backup_last_sub_node;
+
+		libcdata_internal_tree_node_insert_sub_nodes_array_entry(
+		 internal_node,
+		 entry_index,
+		 sub_node_to_remove,
+		 NULL );
+
+		internal_node->number_of_sub_nodes += 1;
+	}
+	return( -1 );
+#endif
+}
+
+/* Retrieves the number of sub nodes in the tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_get_number_of_sub_nodes(
+     libcdata_tree_node_t *node,
+     int *number_of_sub_nodes,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_node_t *internal_node = NULL;
+	static char *function                        = "libcdata_tree_node_get_number_of_sub_nodes";
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	internal_node = (libcdata_internal_tree_node_t *) node;
+
+	if( number_of_sub_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_sub_nodes = internal_node->number_of_sub_nodes;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific sub node from the tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_get_sub_node_by_index(
+     libcdata_tree_node_t *node,
+     int sub_node_index,
+     libcdata_tree_node_t **sub_node,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_node_t *internal_node = NULL;
+	libcdata_tree_node_t *safe_sub_node          = NULL;
+	static char *function                        = "libcdata_tree_node_get_sub_node_by_index";
+	int result                                   = -1;
+	int sub_node_iterator                        = 0;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	internal_node = (libcdata_internal_tree_node_t *) node;
+
+	if( ( sub_node_index < 0 )
+	 || ( sub_node_index >= internal_node->number_of_sub_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_node->sub_nodes_array != NULL )
+	{
+		safe_sub_node = internal_node->sub_nodes_array[ sub_node_index ];
+
+		result = 1;
+	}
+	/* Check if the sub nodes should be searched front to back
+	 * or back to front
+	 */
+	else if( sub_node_index < ( internal_node->number_of_sub_nodes / 2 ) )
+	{
+		safe_sub_node = internal_node->first_sub_node;
+
+		for( sub_node_iterator = 0;
+		     sub_node_iterator < internal_node->number_of_sub_nodes;
+		     sub_node_iterator++ )
+		{
+			if( sub_node_iterator == sub_node_index )
+			{
+				result = 1;
+
+				break;
+			}
+			if( libcdata_tree_node_get_next_node(
+			     safe_sub_node,
+			     &safe_sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next node of sub node: %d.",
+				 function,
+				 sub_node_iterator );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+	{
+		safe_sub_node = internal_node->last_sub_node;
+
+		for( sub_node_iterator = ( internal_node->number_of_sub_nodes - 1 );
+		     sub_node_iterator >= 0;
+		     sub_node_iterator-- )
+		{
+			if( sub_node_iterator == sub_node_index )
+			{
+				result = 1;
+
+				break;
+			}
+			if( libcdata_tree_node_get_previous_node(
+			     safe_sub_node,
+			     &safe_sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve previous node of sub node: %d.",
+				 function,
+				 sub_node_iterator );
+
+				goto on_error;
+			}
+		}
+	}
+	*sub_node = safe_sub_node;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_node->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the sub node that contains a specific value
+ * The sub nodes are expected to be sorted by value, e.g. by libcdata_tree_node_insert_node
+ *
+ * Uses the value_compare_function to determine the order of the entries
+ * The value_compare_function should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ *
+ * If the node has a sub nodes array it is searched using binary search,
+ * otherwise the sub nodes are searched sequentially
+ *
+ * Returns 1 if successful, 0 if no such sub node or -1 on error
+ */
+int libcdata_tree_node_get_sub_node_by_value(
+     libcdata_tree_node_t *node,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **sub_node,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_node_t *internal_node = NULL;
+	libcdata_tree_node_t *safe_sub_node          = NULL;
+	intptr_t *sub_node_value                     = NULL;
+	static char *function                        = "libcdata_tree_node_get_sub_node_by_value";
+	int compare_result                           = 0;
+	int result                                   = 0;
+	int sub_node_index                           = 0;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	internal_node = (libcdata_internal_tree_node_t *) node;
+
+	if( value_compare_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value compare function.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_node->sub_nodes_array != NULL )
+	{
+		result = libcdata_internal_tree_node_bisect_sub_nodes_array(
+		          internal_node,
+		          value,
+		          value_compare_function,
+		          0,
+		          &sub_node_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to search sub nodes array.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 1 )
+		{
+			safe_sub_node = internal_node->sub_nodes_array[ sub_node_index ];
+		}
+	}
+	else
+	{
+		safe_sub_node = internal_node->first_sub_node;
+
+		for( sub_node_index = 0;
+		     sub_node_index < internal_node->number_of_sub_nodes;
+		     sub_node_index++ )
+		{
+			if( libcdata_tree_node_get_value(
+			     safe_sub_node,
+			     &sub_node_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value of sub node: %d.",
+				 function,
+				 sub_node_index );
+
+				goto on_error;
+			}
+			compare_result = value_compare_function(
+			                  value,
+			                  sub_node_value,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to compare sub node: %d.",
+				 function,
+				 sub_node_index );
+
+				goto on_error;
+			}
+			else if( compare_result == LIBCDATA_COMPARE_EQUAL )
+			{
+				result = 1;
+
+				break;
+			}
+			else if( compare_result == LIBCDATA_COMPARE_LESS )
+			{
+				break;
+			}
+			else if( compare_result != LIBCDATA_COMPARE_GREATER )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported value compare function return value: %d.",
+				 function,
+				 compare_result );
+
+				goto on_error;
+			}
+			if( libcdata_tree_node_get_next_node(
+			     safe_sub_node,
+			     &safe_sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next node of sub node: %d.",
+				 function,
+				 sub_node_index );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*sub_node = safe_sub_node;
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_node->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Frees the sub nodes hash table of the tree node
+ * This function assumes the caller holds the write lock of the node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_tree_node_free_sub_nodes_hash_table(
+     libcdata_internal_tree_node_t *internal_node,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_internal_tree_node_free_sub_nodes_hash_table";
+
+	if( internal_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_node->sub_nodes_hash_table != NULL )
+	{
+		memory_free(
+		 internal_node->sub_nodes_hash_table );
+
+		internal_node->sub_nodes_hash_table = NULL;
+	}
+	internal_node->number_of_sub_nodes_hash_table_entries = 0;
+	internal_node->sub_nodes_hash_function                = NULL;
+	internal_node->sub_nodes_hash_table_is_stale          = 0;
+
+	return( 1 );
+}
+
+/* Builds the sub nodes hash table of the tree node
+ * The hash table uses open addressing with linear probing and has at least
+ * twice as many entries as there are sub nodes. Sub nodes without a value
+ * are not added to the hash table.
+ * This function assumes the caller holds the write lock of the node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_tree_node_build_sub_nodes_hash_table(
+     libcdata_internal_tree_node_t *internal_node,
+     int (*hash_function)(
+            intptr_t *value,
+            uint64_t *hash,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *sub_node = NULL;
+	intptr_t *sub_node_value       = NULL;
+	static char *function          = "libcdata_internal_tree_node_build_sub_nodes_hash_table";
+	size_t hash_table_size         = 0;
+	uint64_t hash                  = 0;
+	int entry_index                = 0;
+	int number_of_entries          = 0;
+	int sub_node_index             = 0;
+
+	if( internal_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash function.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_node->number_of_sub_nodes > ( INT_MAX / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid node - number of sub nodes value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = 1;
+
+	while( number_of_entries < ( internal_node->number_of_sub_nodes * 2 ) )
+	{
+		number_of_entries <<= 1;
+	}
+	if( (size_t) number_of_entries > (size_t) ( SSIZE_MAX / sizeof( libcdata_tree_node_hash_table_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_size = sizeof( libcdata_tree_node_hash_table_entry_t ) * number_of_entries;
+
+	/* The hash table is reused when the number of entries does not change
+	 */
+	if( number_of_entries != internal_node->number_of_sub_nodes_hash_table_entries )
+	{
+		if( libcdata_internal_tree_node_free_sub_nodes_hash_table(
+		     internal_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub nodes hash table.",
+			 function );
+
+			return( -1 );
+		}
+		internal_node->sub_nodes_hash_table = (libcdata_tree_node_hash_table_entry_t *) memory_allocate(
+		                                                                                 hash_table_size );
+
+		if( internal_node->sub_nodes_hash_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub nodes hash table.",
+			 function );
+
+			return( -1 );
+		}
+		internal_node->number_of_sub_nodes_hash_table_entries = number_of_entries;
+	}
+	internal_node->sub_nodes_hash_function = NULL;
+
+	if( memory_set(
+	     internal_node->sub_nodes_hash_table,
+	     0,
+	     hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sub nodes hash table.",
+		 function );
+
+		goto on_error;
+	}
+	sub_node = internal_node->first_sub_node;
+
+	for( sub_node_index = 0;
+	     sub_node_index < internal_node->number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libcdata_tree_node_get_value(
+		     sub_node,
+		     &sub_node_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value of sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
+		}
+		if( sub_node_value != NULL )
+		{
+			if( hash_function(
+			     sub_node_value,
+			     &hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve hash of sub node: %d.",
+				 function,
+				 sub_node_index );
+
+				goto on_error;
+			}
+			entry_index = (int) ( hash & (uint64_t) ( number_of_entries - 1 ) );
+
+			while( internal_node->sub_nodes_hash_table[ entry_index ].sub_node != NULL )
+			{
+				entry_index = ( entry_index + 1 ) & ( number_of_entries - 1 );
+			}
+			internal_node->sub_nodes_hash_table[ entry_index ].hash     = hash;
+			internal_node->sub_nodes_hash_table[ entry_index ].sub_node = sub_node;
+		}
+		if( libcdata_tree_node_get_next_node(
+		     sub_node,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node of sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			goto on_error;
+		}
+	}
+	internal_node->sub_nodes_hash_function       = hash_function;
+	internal_node->sub_nodes_hash_table_is_stale = 0;
+
+	return( 1 );
+
+on_error:
+	libcdata_internal_tree_node_free_sub_nodes_hash_table(
+	 internal_node,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Compares the value of the tree node with a key
+ * Uses the value_compare_function to compare the key with the value
+ * Returns 1 if the value equals the key, 0 if not or if the node has no value or -1 on error
+ */
+int libcdata_internal_tree_node_compare_key(
+     libcdata_tree_node_t *node,
+     intptr_t *key,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	intptr_t *value       = NULL;
+	static char *function = "libcdata_internal_tree_node_compare_key";
+	int compare_result    = 0;
+
+	if( value_compare_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value compare function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_value(
+	     node,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		return( 0 );
+	}
+	compare_result = value_compare_function(
+	                  key,
+	                  value,
+	                  error );
+
+	if( compare_result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to compare key with value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( compare_result == LIBCDATA_COMPARE_EQUAL )
+	{
+		return( 1 );
+	}
+	else if( ( compare_result != LIBCDATA_COMPARE_LESS )
+	      && ( compare_result != LIBCDATA_COMPARE_GREATER ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value compare function return value: %d.",
+		 function,
+		 compare_result );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Finds the first sub node of the tree node with a value that equals the key
+ * The sub nodes hash table is used if it was built with the hash_function and
+ * is not stale, otherwise the sub nodes are searched sequentially
+ * This function assumes the caller holds the read or write lock of the node
+ * Returns 1 if successful, 0 if no such sub node or -1 on error
+ */
+int libcdata_internal_tree_node_find_sub_node_by_key(
+     libcdata_internal_tree_node_t *internal_node,
+     intptr_t *key,
+     int (*hash_function)(
+            intptr_t *value,
+            uint64_t *hash,
+            libcerror_error_t **error ),
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **sub_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *safe_sub_node = NULL;
+	static char *function               = "libcdata_internal_tree_node_find_sub_node_by_key";
+	uint64_t hash                       = 0;
+	int entry_index                     = 0;
+	int result                          = 0;
+	int sub_node_index                  = 0;
+
+	if( internal_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_function != NULL )
+	 && ( internal_node->sub_nodes_hash_table != NULL )
+	 && ( internal_node->sub_nodes_hash_function == hash_function )
+	 && ( internal_node->sub_nodes_hash_table_is_stale == 0 ) )
+	{
+		if( hash_function(
+		     key,
+		     &hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hash of key.",
+			 function );
+
+			return( -1 );
+		}
+		entry_index = (int) ( hash & (uint64_t) ( internal_node->number_of_sub_nodes_hash_table_entries - 1 ) );
+
+		/* The sub nodes were added to the hash table in order, hence the probe
+		 * sequence finds the first sub node that equals the key first
+		 */
+		while( internal_node->sub_nodes_hash_table[ entry_index ].sub_node != NULL )
+		{
+			if( internal_node->sub_nodes_hash_table[ entry_index ].hash == hash )
+			{
+				safe_sub_node = internal_node->sub_nodes_hash_table[ entry_index ].sub_node;
+
+				result = libcdata_internal_tree_node_compare_key(
+				          safe_sub_node,
+				          key,
+				          value_compare_function,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to compare sub node in hash table entry: %d.",
+					 function,
+					 entry_index );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					break;
+				}
+			}
+			entry_index = ( entry_index + 1 ) & ( internal_node->number_of_sub_nodes_hash_table_entries - 1 );
+		}
+	}
+	else
+	{
+		safe_sub_node = internal_node->first_sub_node;
+
+		for( sub_node_index = 0;
+		     sub_node_index < internal_node->number_of_sub_nodes;
+		     sub_node_index++ )
+		{
+			result = libcdata_internal_tree_node_compare_key(
+			          safe_sub_node,
+			          key,
+			          value_compare_function,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to compare sub node: %d.",
+				 function,
+				 sub_node_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+			if( libcdata_tree_node_get_next_node(
+			     safe_sub_node,
+			     &safe_sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next node of sub node: %d.",
+				 function,
+				 sub_node_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		*sub_node = safe_sub_node;
+	}
+	return( result );
+}
+
+/* Retrieves the first sub node of the tree node with a value that equals the key
+ * The sub nodes hash table is built, or rebuilt if stale, when a hash_function
+ * is provided and the node has LIBCDATA_TREE_NODE_SUB_NODES_ARRAY_THRESHOLD or more sub nodes
+ * Returns 1 if successful, 0 if no such sub node or -1 on error
+ */
+int libcdata_internal_tree_node_get_sub_node_by_key(
+     libcdata_internal_tree_node_t *internal_node,
+     intptr_t *key,
+     int (*hash_function)(
+            intptr_t *value,
+            uint64_t *hash,
+            libcerror_error_t **error ),
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **sub_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *safe_sub_node = NULL;
+	static char *function               = "libcdata_internal_tree_node_get_sub_node_by_key";
+	uint8_t build_hash_table            = 0;
+	int result                          = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	uint8_t is_write_locked             = 0;
+#endif
+
+	if( internal_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( hash_function != NULL )
+	 && ( internal_node->number_of_sub_nodes >= LIBCDATA_TREE_NODE_SUB_NODES_ARRAY_THRESHOLD )
+	 && ( ( internal_node->sub_nodes_hash_table == NULL )
+	  ||  ( internal_node->sub_nodes_hash_function != hash_function )
+	  ||  ( internal_node->sub_nodes_hash_table_is_stale != 0 ) ) )
+	{
+		build_hash_table = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	/* Building the hash table requires the write lock, the node is checked
+	 * again since another thread could have built the hash table in between
+	 */
+	if( build_hash_table != 0 )
+	{
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_node->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_node->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+		is_write_locked = 1;
+
+		if( ( internal_node->number_of_sub_nodes < LIBCDATA_TREE_NODE_SUB_NODES_ARRAY_THRESHOLD )
+		 || ( ( internal_node->sub_nodes_hash_table != NULL )
+		  &&  ( internal_node->sub_nodes_hash_function == hash_function )
+		  &&  ( internal_node->sub_nodes_hash_table_is_stale == 0 ) ) )
+		{
+			build_hash_table = 0;
+		}
+	}
+#endif
+	if( build_hash_table != 0 )
+	{
+		if( libcdata_internal_tree_node_build_sub_nodes_hash_table(
+		     internal_node,
+		     hash_function,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build sub nodes hash table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libcdata_internal_tree_node_find_sub_node_by_key(
+	          internal_node,
+	          key,
+	          hash_function,
+	          value_compare_function,
+	          &safe_sub_node,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to find sub node by key.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( is_write_locked != 0 )
+	{
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_node->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_node->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( result == 1 )
+	{
+		*sub_node = safe_sub_node;
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( is_write_locked != 0 )
+	{
+		libcthreads_read_write_lock_release_for_write(
+		 internal_node->read_write_lock,
+		 NULL );
+	}
+	else
+	{
+		libcthreads_read_write_lock_release_for_read(
+		 internal_node->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Retrieves the node at the end of a path of keys
+ *
+ * Starting at the node, every key selects the first sub node with a value
+ * that equals the key. Uses the value_compare_function to compare a key with
+ * the value of a sub node, which should return LIBCDATA_COMPARE_LESS,
+ * LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error.
+ * The sub nodes do not need to be sorted.
+ *
+ * If a hash_function is provided, a hash table of the sub nodes is built on
+ * demand for nodes with LIBCDATA_TREE_NODE_SUB_NODES_ARRAY_THRESHOLD or more
+ * sub nodes, so that every key is resolved without searching all the sub nodes.
+ * The hash_function is used to hash both the keys and the sub node values and
+ * should return the same hash for a key and a value that compare equal. The
+ * hash table is rebuilt when the sub nodes or their values are changed by the
+ * tree node functions, changes made directly to a value are not detected.
+ *
+ * Returns 1 if successful, 0 if no such node or -1 on error
+ */
+int libcdata_tree_node_get_node_by_path(
+     libcdata_tree_node_t *node,
+     intptr_t **keys,
+     int number_of_keys,
+     int (*hash_function)(
+            intptr_t *value,
+            uint64_t *hash,
+            libcerror_error_t **error ),
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **path_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *safe_path_node = NULL;
+	static char *function                = "libcdata_tree_node_get_node_by_path";
+	int key_index                        = 0;
+	int result                           = 1;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_keys < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of keys value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( keys == NULL )
+	 && ( number_of_keys > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_compare_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value compare function.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path node.",
+		 function );
+
+		return( -1 );
+	}
+	safe_path_node = node;
+
+	for( key_index = 0;
+	     key_index < number_of_keys;
+	     key_index++ )
+	{
+		result = libcdata_internal_tree_node_get_sub_node_by_key(
+		          (libcdata_internal_tree_node_t *) safe_path_node,
+		          keys[ key_index ],
+		          hash_function,
+		          value_compare_function,
+		          &safe_path_node,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node for key: %d.",
+			 function,
+			 key_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	if( result == 1 )
+	{
+		*path_node = safe_path_node;
+	}
+	return( result );
+}
+
+/* Marks the number of descendants of the node and its parent nodes as stale
+ * Stops at the first node that already is stale, since its parent nodes are stale as well
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_tree_node_invalidate_number_of_descendants(
+     libcdata_internal_tree_node_t *internal_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *parent_node = NULL;
+	static char *function             = "libcdata_internal_tree_node_invalidate_number_of_descendants";
+	uint8_t is_stale                  = 0;
+
+	while( internal_node != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_node->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		is_stale    = internal_node->number_of_descendants_is_stale;
+		parent_node = internal_node->parent_node;
+
+		internal_node->number_of_descendants_is_stale = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_node->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( is_stale != 0 )
+		{
+			break;
+		}
+		internal_node = (libcdata_internal_tree_node_t *) parent_node;
+	}
+	return( 1 );
+}
+
+/* Retrieves the values of the tree node used to calculate the number of descendants
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_tree_node_get_number_of_descendants_values(
+     libcdata_internal_tree_node_t *internal_node,
+     libcdata_tree_node_t **first_sub_node,
+     libcdata_tree_node_t **next_node,
+     int *number_of_descendants,
+     uint8_t *number_of_descendants_is_stale,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_internal_tree_node_get_number_of_descendants_values";
+
+	if( internal_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next node.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_descendants == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of descendants.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_descendants_is_stale == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of descendants is stale.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*first_sub_node                 = internal_node->first_sub_node;
+	*next_node                      = internal_node->next_node;
+	*number_of_descendants          = internal_node->number_of_descendants;
+	*number_of_descendants_is_stale = internal_node->number_of_descendants_is_stale;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the number of descendants of the tree node from the number of descendants of its sub nodes
+ * The cumulative sizes of the sub nodes are set as well for nodes with a sub nodes array
+ * The sub nodes are read while the write lock of the node is held, if a sub node is stale
+ * the node remains stale and the sub node is returned in stale_sub_node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_tree_node_set_number_of_descendants(
+     libcdata_internal_tree_node_t *internal_node,
+     libcdata_tree_node_t **stale_sub_node,
+     libcdata_tree_node_t **parent_node,
+     libcdata_tree_node_t **next_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *safe_stale_sub_node  = NULL;
+	libcdata_tree_node_t *sub_first_sub_node   = NULL;
+	libcdata_tree_node_t *sub_next_node        = NULL;
+	libcdata_tree_node_t *sub_node             = NULL;
+	int *reallocation                          = NULL;
+	static char *function                      = "libcdata_internal_tree_node_set_number_of_descendants";
+	size_t entries_size                        = 0;
+	uint8_t sub_number_of_descendants_is_stale = 0;
+	int number_of_descendants                  = 0;
+	int sub_node_index                         = 0;
+	int sub_number_of_descendants              = 0;
+
+	if( internal_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( stale_sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stale sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent node.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next node.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have set the number of descendants in between
+	 */
+	if( internal_node->number_of_descendants_is_stale != 0 )
+	{
+		if( ( internal_node->sub_nodes_array != NULL )
+		 && ( internal_node->number_of_sub_nodes_cumulative_sizes != internal_node->number_of_sub_nodes ) )
+		{
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+			if( (size_t) internal_node->number_of_sub_nodes > (size_t) ( SSIZE_MAX / sizeof( int ) ) )
+#else
+			if( internal_node->number_of_sub_nodes > (int) ( SSIZE_MAX / sizeof( int ) ) )
+#endif
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of sub nodes value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			entries_size = sizeof( int ) * internal_node->number_of_sub_nodes;
+
+			reallocation = (int *) memory_reallocate(
+			                        internal_node->sub_nodes_cumulative_sizes,
+			                        entries_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize sub nodes cumulative sizes.",
+				 function );
+
+				goto on_error;
+			}
+			internal_node->sub_nodes_cumulative_sizes           = reallocation;
+			internal_node->number_of_sub_nodes_cumulative_sizes = internal_node->number_of_sub_nodes;
+		}
+		sub_node = internal_node->first_sub_node;
+
+		while( sub_node != NULL )
+		{
+			if( libcdata_internal_tree_node_get_number_of_descendants_values(
+			     (libcdata_internal_tree_node_t *) sub_node,
+			     &sub_first_sub_node,
+			     &sub_next_node,
+			     &sub_number_of_descendants,
+			     &sub_number_of_descendants_is_stale,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of descendants values of sub node: %d.",
+				 function,
+				 sub_node_index );
+
+				goto on_error;
+			}
+			if( sub_number_of_descendants_is_stale != 0 )
+			{
+				safe_stale_sub_node = sub_node;
+
+				break;
+			}
+			number_of_descendants += sub_number_of_descendants + 1;
+
+			if( ( internal_node->sub_nodes_array != NULL )
+			 && ( sub_node_index < internal_node->number_of_sub_nodes_cumulative_sizes ) )
+			{
+				internal_node->sub_nodes_cumulative_sizes[ sub_node_index ] = number_of_descendants;
+			}
+			sub_node_index++;
+
+			sub_node = sub_next_node;
+		}
+		if( safe_stale_sub_node == NULL )
+		{
+			internal_node->number_of_descendants          = number_of_descendants;
+			internal_node->number_of_descendants_is_stale = 0;
+		}
+	}
+	*stale_sub_node = safe_stale_sub_node;
+	*parent_node    = internal_node->parent_node;
+	*next_node      = internal_node->next_node;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_node->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Calculates the number of descendants of the stale nodes in the sub tree
+ * The stale nodes are calculated in post-order, sub trees that are not stale are skipped
+ * The fields of every node are only accessed while holding the lock of that node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_tree_node_calculate_number_of_descendants(
+     libcdata_internal_tree_node_t *internal_node,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_node_t *internal_current_node = NULL;
+	libcdata_tree_node_t *first_sub_node                 = NULL;
+	libcdata_tree_node_t *next_node                      = NULL;
+	libcdata_tree_node_t *parent_node                    = NULL;
+	libcdata_tree_node_t *stale_sub_node                 = NULL;
+	libcdata_tree_node_t *sub_node                       = NULL;
+	static char *function                                = "libcdata_internal_tree_node_calculate_number_of_descendants";
+	uint8_t number_of_descendants_is_stale               = 0;
+	int number_of_descendants                            = 0;
+
+	if( internal_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_internal_tree_node_get_number_of_descendants_values(
+	     internal_node,
+	     &sub_node,
+	     &next_node,
+	     &number_of_descendants,
+	     &number_of_descendants_is_stale,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of descendants values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_descendants_is_stale == 0 )
+	{
+		return( 1 );
+	}
+	internal_current_node = internal_node;
+
+	while( internal_current_node != NULL )
+	{
+		/* Skip the sub nodes that are not stale
+		 */
+		while( sub_node != NULL )
+		{
+			if( libcdata_internal_tree_node_get_number_of_descendants_values(
+			     (libcdata_internal_tree_node_t *) sub_node,
+			     &first_sub_node,
+			     &next_node,
+			     &number_of_descendants,
+			     &number_of_descendants_is_stale,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of descendants values of sub node.",
+				 function );
+
+				return( -1 );
+			}
+			if( number_of_descendants_is_stale != 0 )
+			{
+				break;
+			}
+			sub_node = next_node;
+		}
+		if( sub_node != NULL )
+		{
+			internal_current_node = (libcdata_internal_tree_node_t *) sub_node;
+			sub_node              = first_sub_node;
+
+			continue;
+		}
+		/* None of the sub nodes are stale
+		 */
+		if( libcdata_internal_tree_node_set_number_of_descendants(
+		     internal_current_node,
+		     &stale_sub_node,
+		     &parent_node,
+		     &next_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set number of descendants.",
+			 function );
+
+			return( -1 );
+		}
+		if( stale_sub_node != NULL )
+		{
+			/* A sub node was marked stale in between, calculate it first
+			 */
+			sub_node = stale_sub_node;
+
+			continue;
+		}
+		if( internal_current_node == internal_node )
+		{
+			break;
+		}
+		sub_node              = next_node;
+		internal_current_node = (libcdata_internal_tree_node_t *) parent_node;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of descendants of the tree node
+ * The number of descendants is the number of nodes in the sub tree without the node itself
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_get_number_of_descendants(
+     libcdata_tree_node_t *node,
+     int *number_of_descendants,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_node_t *internal_node = NULL;
+	static char *function                        = "libcdata_tree_node_get_number_of_descendants";
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	internal_node = (libcdata_internal_tree_node_t *) node;
+
+	if( number_of_descendants == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of descendants.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_internal_tree_node_calculate_number_of_descendants(
+	     internal_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate number of descendants.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_descendants = internal_node->number_of_descendants;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the sub node of the tree node that contains a specific pre-order index
+ * The pre-order index is relative to the first sub node and is updated to be relative to the sub node
+ * The cumulative sizes of the sub nodes are binary searched when they are available,
+ * otherwise the sub nodes are scanned
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_tree_node_get_sub_node_by_preorder_index(
+     libcdata_internal_tree_node_t *internal_node,
+     int *preorder_index,
+     libcdata_tree_node_t **sub_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *first_sub_node   = NULL;
+	libcdata_tree_node_t *next_node        = NULL;
+	libcdata_tree_node_t *safe_sub_node    = NULL;
+	static char *function                  = "libcdata_internal_tree_node_get_sub_node_by_preorder_index";
+	uint8_t number_of_descendants_is_stale = 0;
+	int first_entry_index                  = 0;
+	int last_entry_index                   = 0;
+	int middle_entry_index                 = 0;
+	int number_of_descendants              = 0;
+	int safe_preorder_index                = 0;
+
+	if( internal_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( preorder_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pre-order index.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
+		 function );
+
+		return( -1 );
+	}
+	safe_preorder_index = *preorder_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_node->number_of_descendants_is_stale == 0 )
+	 && ( internal_node->sub_nodes_array != NULL )
+	 && ( internal_node->sub_nodes_cumulative_sizes != NULL )
+	 && ( internal_node->number_of_sub_nodes_cumulative_sizes == internal_node->number_of_sub_nodes )
+	 && ( internal_node->number_of_sub_nodes > 0 ) )
+	{
+		/* Entry N of the cumulative sizes contains the number of nodes
+		 * in the sub trees of the sub nodes 0 to N
+		 */
+		first_entry_index = 0;
+		last_entry_index  = internal_node->number_of_sub_nodes - 1;
+
+		while( first_entry_index < last_entry_index )
+		{
+			middle_entry_index = first_entry_index + ( ( last_entry_index - first_entry_index ) / 2 );
+
+			if( safe_preorder_index < internal_node->sub_nodes_cumulative_sizes[ middle_entry_index ] )
+			{
+				last_entry_index = middle_entry_index;
+			}
+			else
+			{
+				first_entry_index = middle_entry_index + 1;
+			}
+		}
+		if( safe_preorder_index < internal_node->sub_nodes_cumulative_sizes[ first_entry_index ] )
+		{
+			if( first_entry_index > 0 )
+			{
+				safe_preorder_index -= internal_node->sub_nodes_cumulative_sizes[ first_entry_index - 1 ];
+			}
+			safe_sub_node = internal_node->sub_nodes_array[ first_entry_index ];
+		}
+	}
+	else
+	{
+		safe_sub_node = internal_node->first_sub_node;
+
+		while( safe_sub_node != NULL )
+		{
+			if( libcdata_internal_tree_node_get_number_of_descendants_values(
+			     (libcdata_internal_tree_node_t *) safe_sub_node,
+			     &first_sub_node,
+			     &next_node,
+			     &number_of_descendants,
+			     &number_of_descendants_is_stale,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of descendants values of sub node.",
+				 function );
+
+				goto on_error;
+			}
+			if( safe_preorder_index <= number_of_descendants )
+			{
+				break;
+			}
+			safe_preorder_index -= number_of_descendants + 1;
+
+			safe_sub_node = next_node;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_node->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( safe_sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: corruption detected - missing sub node.",
+		 function );
+
+		return( -1 );
+	}
+	*preorder_index = safe_preorder_index;
+	*sub_node       = safe_sub_node;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_node->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a specific node of the (sub) tree in pre-order
+ * The node itself has pre-order index 0
+ * The number of descendants of the sub nodes is used to skip sub trees,
+ * hence only the nodes on the path to the node are visited. For nodes with
+ * LIBCDATA_TREE_NODE_SUB_NODES_ARRAY_THRESHOLD or more sub nodes the sub node
+ * is found by a binary search, hence the lookup is O(depth * log(fan-out))
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_get_node_by_preorder_index(
+     libcdata_tree_node_t *node,
+     int preorder_index,
+     libcdata_tree_node_t **preorder_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *safe_preorder_node = NULL;
+	static char *function                    = "libcdata_tree_node_get_node_by_preorder_index";
+	int number_of_descendants                = 0;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( preorder_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid pre-order index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( preorder_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pre-order node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_number_of_descendants(
+	     node,
+	     &number_of_descendants,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of descendants.",
+		 function );
+
+		return( -1 );
+	}
+	if( preorder_index > number_of_descendants )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid pre-order index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_preorder_node = node;
+
+	while( preorder_index > 0 )
+	{
+		/* Skip the node itself
+		 */
+		preorder_index -= 1;
+
+		if( libcdata_internal_tree_node_get_sub_node_by_preorder_index(
+		     (libcdata_internal_tree_node_t *) safe_preorder_node,
+		     &preorder_index,
+		     &safe_preorder_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node by pre-order index.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*preorder_node = safe_preorder_node;
+
+	return( 1 );
+}
+
+/* Retrieves the first leaf node of the (sub) tree
+ * The first leaf node is found by following the first sub nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_tree_node_get_first_leaf_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **leaf_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *safe_leaf_node = NULL;
+	libcdata_tree_node_t *sub_node       = NULL;
+	static char *function                = "libcdata_internal_tree_node_get_first_leaf_node";
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	sub_node = node;
+
+	while( sub_node != NULL )
+	{
+		safe_leaf_node = sub_node;
+
+		if( libcdata_tree_node_get_first_sub_node(
+		     safe_leaf_node,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first sub node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*leaf_node = safe_leaf_node;
+
+	return( 1 );
+}
+
+/* Retrieves the next sibling node of the node or of one of its parent nodes
+ * The search does not go beyond the root node
+ * Returns 1 if successful, 0 if no such node or -1 on error
+ */
+int libcdata_internal_tree_node_get_next_node_in_sub_tree(
+     libcdata_tree_node_t *root_node,
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **next_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *parent_node    = NULL;
+	libcdata_tree_node_t *previous_node  = NULL;
+	libcdata_tree_node_t *safe_next_node = NULL;
+	static char *function                = "libcdata_internal_tree_node_get_next_node_in_sub_tree";
+
+	if( root_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root node.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next node.",
+		 function );
+
+		return( -1 );
+	}
+	while( node != root_node )
+	{
+		if( libcdata_tree_node_get_nodes(
+		     node,
+		     &parent_node,
+		     &previous_node,
+		     &safe_next_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve nodes of node.",
+			 function );
+
+			return( -1 );
+		}
+		if( safe_next_node != NULL )
+		{
+			*next_node = safe_next_node;
+
+			return( 1 );
+		}
+		if( parent_node == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid node - not part of the sub tree of the root node.",
+			 function );
+
+			return( -1 );
+		}
+		node = parent_node;
+	}
+	return( 0 );
+}
+
+/* Retrieves the next leaf node of the (sub) tree
+ * The traversal is depth-first and requires no additional memory,
+ * the current leaf node is the only state needed to continue it
+ * Set leaf_node to NULL to retrieve the first leaf node
+ * Returns 1 if successful, 0 if no more leaf nodes or -1 on error
+ */
+int libcdata_tree_node_get_next_leaf_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *leaf_node,
+     libcdata_tree_node_t **next_leaf_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *next_node = NULL;
+	static char *function           = "libcdata_tree_node_get_next_leaf_node";
+	int result                      = 0;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_leaf_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_node == NULL )
+	{
+		next_node = node;
+	}
+	else
+	{
+		result = libcdata_internal_tree_node_get_next_node_in_sub_tree(
+		          node,
+		          leaf_node,
+		          &next_node,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next node in sub tree.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( libcdata_internal_tree_node_get_first_leaf_node(
+	     next_node,
+	     next_leaf_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next node of the (sub) tree in pre-order
+ * The node is visited before its sub nodes
+ * The traversal requires no additional memory, the current node is the
+ * only state needed to continue it
+ * Set current_node to NULL to retrieve the first node, which is the node itself
+ * Returns 1 if successful, 0 if no more nodes or -1 on error
+ */
+int libcdata_tree_node_get_next_pre_order_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *current_node,
+     libcdata_tree_node_t **next_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *sub_node = NULL;
+	static char *function          = "libcdata_tree_node_get_next_pre_order_node";
+	int result                     = 0;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next node.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_node == NULL )
+	{
+		*next_node = node;
+
+		return( 1 );
+	}
+	if( libcdata_tree_node_get_first_sub_node(
+	     current_node,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first sub node of current node.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node != NULL )
+	{
+		*next_node = sub_node;
+
+		return( 1 );
+	}
+	result = libcdata_internal_tree_node_get_next_node_in_sub_tree(
+	          node,
+	          current_node,
+	          next_node,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next node in sub tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the next node of the (sub) tree in post-order
+ * The node is visited after its sub nodes
+ * The traversal requires no additional memory, the current node is the
+ * only state needed to continue it
+ * Set current_node to NULL to retrieve the first node, which is the first leaf node
+ * Returns 1 if successful, 0 if no more nodes or -1 on error
+ */
+int libcdata_tree_node_get_next_post_order_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *current_node,
+     libcdata_tree_node_t **next_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *parent_node    = NULL;
+	libcdata_tree_node_t *previous_node  = NULL;
+	libcdata_tree_node_t *safe_next_node = NULL;
+	static char *function                = "libcdata_tree_node_get_next_post_order_node";
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next node.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_node == NULL )
+	{
+		safe_next_node = node;
+	}
+	else
+	{
+		if( current_node == node )
+		{
+			return( 0 );
+		}
+		if( libcdata_tree_node_get_nodes(
+		     current_node,
+		     &parent_node,
+		     &previous_node,
+		     &safe_next_node,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - missing first sub node.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve nodes of current node.",
 			 function );
 
 			return( -1 );
 		}
-		if( internal_node->last_sub_node == NULL )
+		if( safe_next_node == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected - missing last sub node.",
-			 function );
+			if( parent_node == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid current node - not part of the sub tree of the node.",
+				 function );
 
-			return( -1 );
+				return( -1 );
+			}
+			*next_node = parent_node;
+
+			return( 1 );
 		}
 	}
-	if( sub_node_to_remove == NULL )
+	if( libcdata_internal_tree_node_get_first_leaf_node(
+	     safe_next_node,
+	     next_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Visits the node and its sub nodes using multiple threads
+ * The callback_function is called for every node with its value and the user_data,
+ * it can be called concurrently and should not change the tree
+ * The sub trees are distributed as tasks over per thread queues, idle threads steal
+ * tasks from the queues of the other threads. A task visits at most serial_cutoff nodes
+ * before the remainder is split into new tasks, a serial_cutoff of 0 represents the default
+ * of LIBCDATA_TREE_NODE_VISITOR_SERIAL_CUTOFF
+ * Without multi-threading support the nodes are visited by the calling thread
+ * If the callback_function fails the visit is aborted and the error of the first
+ * callback that failed is returned in error
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_parallel_visit(
+     libcdata_tree_node_t *node,
+     int (*callback_function)(
+            libcdata_tree_node_t *node,
+            intptr_t *value,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     int number_of_threads,
+     int serial_cutoff,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_visitor_t *visitor = NULL;
+	static char *function                 = "libcdata_tree_node_parallel_visit";
+
+	if( node == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub node to remove.",
+		 "%s: invalid node.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_node->number_of_sub_nodes == 0 )
+	if( callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid node - missing number of sub nodes.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_node->first_sub_node == NULL )
+	if( number_of_threads <= 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid node - missing first sub node.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_node->last_sub_node == NULL )
+	if( serial_cutoff < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid node - missing last sub node.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid serial cutoff value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_tree_node_get_nodes(
-	     sub_node_to_remove,
-	     &parent_node,
-	     &previous_node,
-	     &next_node,
+	if( serial_cutoff == 0 )
+	{
+		serial_cutoff = LIBCDATA_TREE_NODE_VISITOR_SERIAL_CUTOFF;
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT ) || defined( HAVE_LOCAL_LIBCDATA )
+	number_of_threads = 1;
+#endif
+	if( libcdata_tree_node_visitor_initialize(
+	     &visitor,
+	     callback_function,
+	     user_data,
+	     number_of_threads,
+	     serial_cutoff,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve nodes of node to remove.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create visitor.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( parent_node != node )
+	if( libcdata_tree_node_visitor_run(
+	     visitor,
+	     node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid node to remove - parent node mismatch.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit node and sub nodes.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_node->read_write_lock,
+	if( libcdata_tree_node_visitor_free(
+	     &visitor,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free visitor.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	backup_first_sub_node = internal_node->first_sub_node;
-	backup_last_sub_node  = internal_node->last_sub_node;
-#endif
-	result = libcdata_tree_node_set_nodes(
-	          sub_node_to_remove,
-	          NULL,
-	          NULL,
-	          NULL,
-	          error );
+	return( 1 );
 
-	if( result != 1 )
+on_error:
+	if( visitor != NULL )
+	{
+		libcdata_tree_node_visitor_free(
+		 &visitor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a list of all the leaf nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_get_leaf_node_list(
+     libcdata_tree_node_t *node,
+     libcdata_list_t **leaf_node_list,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *leaf_node    = NULL;
+	intptr_t *value                    = NULL;
+	static char *function              = "libcdata_tree_node_get_leaf_node_list";
+	int leaf_node_list_created_in_node = 0;
+	int result                         = 0;
+
+	if( node == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set nodes of node to remove.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( result == 1 )
+	if( leaf_node_list == NULL )
 	{
-		if( next_node != NULL )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf node list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *leaf_node_list == NULL )
+	{
+		if( libcdata_list_initialize(
+		     leaf_node_list,
+		     error ) != 1 )
 		{
-			if( libcdata_tree_node_set_previous_node(
-			     next_node,
-			     previous_node,
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create leaf node list.",
+			 function );
+
+			goto on_error;
+		}
+		leaf_node_list_created_in_node = 1;
+	}
+	/* Traverse the leaf nodes
+	 */
+	do
+	{
+		result = libcdata_tree_node_get_next_leaf_node(
+		          node,
+		          leaf_node,
+		          &leaf_node,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next leaf node.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libcdata_tree_node_get_value(
+			     leaf_node,
+			     &value,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set previous node of next node.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value of leaf node.",
 				 function );
 
-				libcdata_tree_node_set_nodes(
-				 sub_node_to_remove,
-				 parent_node,
-				 previous_node,
-				 next_node,
-				 NULL );
+				goto on_error;
+			}
+			if( value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid leaf node - missing value.",
+				 function );
 
-				result = -1;
+				goto on_error;
 			}
-		}
-	}
-	if( result == 1 )
-	{
-		if( previous_node != NULL )
-		{
-			if( libcdata_tree_node_set_next_node(
-			     previous_node,
-			     next_node,
+			if( libcdata_list_append_value(
+			     *leaf_node_list,
+			     value,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set next node of previous node.",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append tree node to leaf node list.",
 				 function );
 
-				libcdata_tree_node_set_nodes(
-				 sub_node_to_remove,
-				 parent_node,
-				 previous_node,
-				 next_node,
-				 NULL );
-
-				if( next_node != NULL )
-				{
-					libcdata_tree_node_set_previous_node(
-					 next_node,
-					 sub_node_to_remove,
-					 NULL );
-				}
-				result = -1;
+				goto on_error;
 			}
 		}
 	}
-	if( result == 1 )
-	{
-		if( internal_node->first_sub_node == sub_node_to_remove )
-		{
-			internal_node->first_sub_node = next_node;
-		}
-		if( internal_node->last_sub_node == sub_node_to_remove )
-		{
-			internal_node->last_sub_node = previous_node;
-		}
-		internal_node->number_of_sub_nodes -= 1;
-	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_node->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
+	while( result != 0 );
 
-		goto on_error;
-	}
-#endif
 	return( 1 );
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 on_error:
-	if( result == 1 )
+	if( leaf_node_list_created_in_node != 0 )
 	{
-		libcdata_tree_node_set_nodes(
-		 sub_node_to_remove,
-		 parent_node,
-		 previous_node,
-		 next_node,
-		 NULL );
-
-		if( next_node != NULL )
-		{
-			libcdata_tree_node_set_previous_node(
-			 next_node,
-			 sub_node_to_remove,
-			 NULL );
-		}
-		if( previous_node != NULL )
+		if( *leaf_node_list != NULL )
 		{
-			libcdata_tree_node_set_next_node(
-			 previous_node,
-			 sub_node_to_remove,
+			libcdata_list_free(
+			 leaf_node_list,
+			 NULL,
 			 NULL );
 		}
-		internal_node->first_sub_node = backup_first_sub_node;
-		internal_node->last_sub_node  = backup_last_sub_node;
-
-		internal_node->number_of_sub_nodes += 1;
 	}
 	return( -1 );
-#endif
 }
 
-/* Retrieves the number of sub nodes in the tree node
+/* Serializes the tree node and its sub nodes
+ * The nodes are stored in pre-order, refer to cdata_serialized_tree.h for the format
+ * If data is NULL only the serialized data size is determined
  * Returns 1 if successful or -1 on error
  */
-int libcdata_tree_node_get_number_of_sub_nodes(
+int libcdata_internal_tree_node_serialize(
      libcdata_tree_node_t *node,
-     int *number_of_sub_nodes,
+     int (*value_serialize_function)(
+            intptr_t *value,
+            uint8_t *data,
+            size_t data_size,
+            size_t *value_data_size,
+            libcerror_error_t **error ),
+     uint8_t *data,
+     size_t data_size,
+     size_t *serialized_data_size,
      libcerror_error_t **error )
 {
-	libcdata_internal_tree_node_t *internal_node = NULL;
-	static char *function                        = "libcdata_tree_node_get_number_of_sub_nodes";
+	cdata_serialized_tree_header_t *serialized_header = NULL;
+	cdata_serialized_tree_node_t *serialized_node     = NULL;
+	libcdata_tree_node_t *next_node                   = NULL;
+	libcdata_tree_node_t *parent_node                 = NULL;
+	libcdata_tree_node_t *previous_node               = NULL;
+	libcdata_tree_node_t *sub_node                    = NULL;
+	intptr_t *value                                   = NULL;
+	static char *function                             = "libcdata_internal_tree_node_serialize";
+	size_t data_offset                                = 0;
+	size_t entry_offset                               = 0;
+	size_t value_data_size                            = 0;
+	uint64_t parent_entry_offset                      = 0;
+	uint32_t flags                                    = 0;
+	int number_of_nodes                               = 0;
+	int number_of_sub_nodes                           = 0;
 
 	if( node == NULL )
 	{
@@ -3875,226 +8249,463 @@ int libcdata_tree_node_get_number_of_sub_nodes(
 
 		return( -1 );
 	}
-	internal_node = (libcdata_internal_tree_node_t *) node;
-
-	if( number_of_sub_nodes == NULL )
+	if( value_serialize_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of sub nodes.",
+		 "%s: invalid value serialize function.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_node->read_write_lock,
-	     error ) != 1 )
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*number_of_sub_nodes = internal_node->number_of_sub_nodes;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_node->read_write_lock,
-	     error ) != 1 )
+	if( serialized_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid serialized data size.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( 1 );
-}
-
-/* Retrieves a specific sub node from the tree node
- * Returns 1 if successful or -1 on error
- */
-int libcdata_tree_node_get_sub_node_by_index(
-     libcdata_tree_node_t *node,
-     int sub_node_index,
-     libcdata_tree_node_t **sub_node,
-     libcerror_error_t **error )
-{
-	libcdata_internal_tree_node_t *internal_node = NULL;
-	libcdata_tree_node_t *safe_sub_node          = NULL;
-	static char *function                        = "libcdata_tree_node_get_sub_node_by_index";
-	int result                                   = -1;
-	int sub_node_iterator                        = 0;
+	data_offset = sizeof( cdata_serialized_tree_header_t );
 
-	if( node == NULL )
+	if( ( data != NULL )
+	 && ( data_size < data_offset ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	internal_node = (libcdata_internal_tree_node_t *) node;
+	/* The tree is serialized in pre-order without recursion. The offset of
+	 * the entry of the parent node is read back from the serialized parent
+	 * node entries when ascending, hence no additional memory is needed.
+	 */
+	sub_node = node;
 
-	if( ( sub_node_index < 0 )
-	 || ( sub_node_index >= internal_node->number_of_sub_nodes ) )
+	while( sub_node != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sub node index value out of bounds.",
-		 function );
+		if( libcdata_tree_node_get_value(
+		     sub_node,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from sub node.",
+			 function );
 
-		return( -1 );
-	}
-	if( sub_node == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub node.",
-		 function );
+			return( -1 );
+		}
+		if( libcdata_tree_node_get_number_of_sub_nodes(
+		     sub_node,
+		     &number_of_sub_nodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sub nodes of sub node.",
+			 function );
 
-		return( -1 );
-	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_node->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+			return( -1 );
+		}
+		if( number_of_nodes == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of nodes value exceeds maximum.",
+			 function );
 
-		return( -1 );
-	}
-#endif
-	/* Check if the sub nodes should be searched front to back
-	 * or back to front
-	 */
-	if( sub_node_index < ( internal_node->number_of_sub_nodes / 2 ) )
-	{
-		safe_sub_node = internal_node->first_sub_node;
+			return( -1 );
+		}
+		if( data_offset > ( (size_t) SSIZE_MAX - sizeof( cdata_serialized_tree_node_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid serialized data size value exceeds maximum.",
+			 function );
 
-		for( sub_node_iterator = 0;
-		     sub_node_iterator < internal_node->number_of_sub_nodes;
-		     sub_node_iterator++ )
+			return( -1 );
+		}
+		if( ( data != NULL )
+		 && ( ( data_size - data_offset ) < sizeof( cdata_serialized_tree_node_t ) ) )
 		{
-			if( sub_node_iterator == sub_node_index )
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		entry_offset    = data_offset;
+		data_offset    += sizeof( cdata_serialized_tree_node_t );
+		value_data_size = 0;
+		flags           = 0;
+
+		if( value != NULL )
+		{
+			if( data == NULL )
 			{
-				result = 1;
+				if( value_serialize_function(
+				     value,
+				     NULL,
+				     0,
+				     &value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine value data size.",
+					 function );
 
-				break;
+					return( -1 );
+				}
+				if( value_data_size > ( (size_t) SSIZE_MAX - data_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid value data size value exceeds maximum.",
+					 function );
+
+					return( -1 );
+				}
 			}
-			if( libcdata_tree_node_get_next_node(
-			     safe_sub_node,
-			     &safe_sub_node,
+			else
+			{
+				if( value_serialize_function(
+				     value,
+				     &( data[ data_offset ] ),
+				     data_size - data_offset,
+				     &value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to serialize value.",
+					 function );
+
+					return( -1 );
+				}
+				if( value_data_size > ( data_size - data_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid value data size value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			flags = LIBCDATA_SERIALIZED_TREE_NODE_FLAG_HAS_VALUE;
+		}
+		if( data != NULL )
+		{
+			serialized_node = (cdata_serialized_tree_node_t *) &( data[ entry_offset ] );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 serialized_node->parent_node_offset,
+			 parent_entry_offset );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 serialized_node->next_node_offset,
+			 (uint64_t) 0 );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 serialized_node->number_of_sub_nodes,
+			 number_of_sub_nodes );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 serialized_node->flags,
+			 flags );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 serialized_node->value_data_size,
+			 value_data_size );
+		}
+		data_offset     += value_data_size;
+		number_of_nodes += 1;
+
+		if( libcdata_tree_node_get_first_sub_node(
+		     sub_node,
+		     &next_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first sub node of sub node.",
+			 function );
+
+			return( -1 );
+		}
+		if( next_node != NULL )
+		{
+			parent_entry_offset = (uint64_t) entry_offset;
+
+			sub_node = next_node;
+
+			continue;
+		}
+		/* Ascend until a sub node with a next node is found
+		 */
+		while( sub_node != node )
+		{
+			if( libcdata_tree_node_get_nodes(
+			     sub_node,
+			     &parent_node,
+			     &previous_node,
+			     &next_node,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve next node of sub node: %d.",
-				 function,
-				 sub_node_iterator );
+				 "%s: unable to retrieve nodes of sub node.",
+				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-		}
-	}
-	else
-	{
-		safe_sub_node = internal_node->last_sub_node;
-
-		for( sub_node_iterator = ( internal_node->number_of_sub_nodes - 1 );
-		     sub_node_iterator >= 0;
-		     sub_node_iterator-- )
-		{
-			if( sub_node_iterator == sub_node_index )
+			if( next_node != NULL )
 			{
-				result = 1;
-
 				break;
 			}
-			if( libcdata_tree_node_get_previous_node(
-			     safe_sub_node,
-			     &safe_sub_node,
-			     error ) != 1 )
+			if( parent_node == NULL )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve previous node of sub node: %d.",
-				 function,
-				 sub_node_iterator );
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: corruption detected in sub node - missing parent node.",
+				 function );
 
-				goto on_error;
+				return( -1 );
+			}
+			sub_node     = parent_node;
+			entry_offset = (size_t) parent_entry_offset;
+
+			if( data != NULL )
+			{
+				serialized_node = (cdata_serialized_tree_node_t *) &( data[ entry_offset ] );
+
+				byte_stream_copy_to_uint64_little_endian(
+				 serialized_node->parent_node_offset,
+				 parent_entry_offset );
 			}
 		}
+		if( ( next_node != NULL )
+		 && ( data != NULL ) )
+		{
+			serialized_node = (cdata_serialized_tree_node_t *) &( data[ entry_offset ] );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 serialized_node->next_node_offset,
+			 (uint64_t) data_offset );
+		}
+		sub_node = next_node;
+	}
+	if( data != NULL )
+	{
+		serialized_header = (cdata_serialized_tree_header_t *) data;
+
+		if( memory_copy(
+		     serialized_header->signature,
+		     cdata_serialized_tree_signature,
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy signature.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 serialized_header->format_version,
+		 LIBCDATA_SERIALIZED_TREE_FORMAT_VERSION );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 serialized_header->number_of_nodes,
+		 number_of_nodes );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 serialized_header->data_size,
+		 (uint64_t) data_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 serialized_header->reserved,
+		 (uint64_t) 0 );
 	}
-	*sub_node = safe_sub_node;
+	*serialized_data_size = data_offset;
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_node->read_write_lock,
+	return( 1 );
+}
+
+/* Retrieves the size of the data needed to serialize the tree node and its sub nodes
+ * The value_serialize_function is called with data set to NULL to determine
+ * the size of the value data
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_get_serialized_data_size(
+     libcdata_tree_node_t *node,
+     int (*value_serialize_function)(
+            intptr_t *value,
+            uint8_t *data,
+            size_t data_size,
+            size_t *value_data_size,
+            libcerror_error_t **error ),
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_get_serialized_data_size";
+
+	if( libcdata_internal_tree_node_serialize(
+	     node,
+	     value_serialize_function,
+	     NULL,
+	     0,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine serialized data size.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
-
-on_error:
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_node->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves a list of all the leaf nodes
+/* Serializes the tree node and its sub nodes into a flat buffer
+ * The value_serialize_function should copy the value data into data and set
+ * value_data_size to the number of bytes used
  * Returns 1 if successful or -1 on error
  */
-int libcdata_tree_node_get_leaf_node_list(
+int libcdata_tree_node_serialize(
      libcdata_tree_node_t *node,
-     libcdata_list_t **leaf_node_list,
+     int (*value_serialize_function)(
+            intptr_t *value,
+            uint8_t *data,
+            size_t data_size,
+            size_t *value_data_size,
+            libcerror_error_t **error ),
+     uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
-	libcdata_internal_tree_node_t *internal_node = NULL;
-	libcdata_tree_node_t *sub_node               = NULL;
-	static char *function                        = "libcdata_tree_node_get_leaf_node_list";
-	int leaf_node_list_created_in_node           = 0;
-	int sub_node_index                           = 0;
+	static char *function       = "libcdata_tree_node_serialize";
+	size_t serialized_data_size = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_internal_tree_node_serialize(
+	     node,
+	     value_serialize_function,
+	     data,
+	     data_size,
+	     &serialized_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to serialize node.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Deserializes a tree node and its sub nodes from a flat buffer
+ * The nodes are allocated from an arena owned by the deserialized node
+ * On error the values are freed using the value_free_function
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_deserialize(
+     libcdata_tree_node_t **node,
+     const uint8_t *data,
+     size_t data_size,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     int (*value_deserialize_function)(
+            intptr_t **value,
+            const uint8_t *data,
+            size_t data_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_node_t *internal_parent_node = NULL;
+	libcdata_internal_tree_node_t *internal_sub_node    = NULL;
+	libcdata_internal_tree_view_t *internal_tree_view   = NULL;
+	libcdata_tree_node_t *safe_node                     = NULL;
+	libcdata_tree_view_t *tree_view                     = NULL;
+	static char *function                               = "libcdata_tree_node_deserialize";
+	size_t next_node_offset                             = 0;
+	size_t node_offset                                  = 0;
+	size_t parent_entry_offset                          = 0;
+	size_t parent_node_offset                           = 0;
+	size_t value_data_size                              = 0;
+	uint32_t flags                                      = 0;
+	int node_index                                      = 0;
+	int number_of_nodes                                 = 0;
+	int number_of_nodes_per_chunk                       = 0;
+	int number_of_sub_nodes                             = 0;
+	int parent_number_of_sub_nodes                      = 0;
 
 	if( node == NULL )
 	{
@@ -4107,165 +8718,313 @@ int libcdata_tree_node_get_leaf_node_list(
 
 		return( -1 );
 	}
-	internal_node = (libcdata_internal_tree_node_t *) node;
+	if( *node != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node value already set.",
+		 function );
 
-	if( leaf_node_list == NULL )
+		return( -1 );
+	}
+	if( value_free_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid leaf node list.",
+		 "%s: invalid value free function.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_node->read_write_lock,
+	if( value_deserialize_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value deserialize function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_view_initialize(
+	     &tree_view,
+	     data,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create tree view.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( *leaf_node_list == NULL )
+	internal_tree_view = (libcdata_internal_tree_view_t *) tree_view;
+
+	number_of_nodes = internal_tree_view->number_of_nodes;
+
+	if( number_of_nodes > LIBCDATA_TREE_NODE_DESERIALIZE_MAXIMUM_NUMBER_OF_NODES_PER_CHUNK )
 	{
-		if( libcdata_list_initialize(
-		     leaf_node_list,
+		number_of_nodes_per_chunk = LIBCDATA_TREE_NODE_DESERIALIZE_MAXIMUM_NUMBER_OF_NODES_PER_CHUNK;
+	}
+	else
+	{
+		number_of_nodes_per_chunk = number_of_nodes;
+	}
+	/* The entries are read sequentially, the parent node is tracked using
+	 * the number of sub nodes stored in the entry of the parent node
+	 */
+	node_offset = sizeof( cdata_serialized_tree_header_t );
+
+	for( node_index = 0;
+	     node_index < number_of_nodes;
+	     node_index++ )
+	{
+		if( libcdata_internal_tree_view_read_node(
+		     internal_tree_view,
+		     node_offset,
+		     &parent_node_offset,
+		     &next_node_offset,
+		     &number_of_sub_nodes,
+		     &flags,
+		     &value_data_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create leaf node list.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read node: %d.",
+			 function,
+			 node_index );
 
 			goto on_error;
 		}
-		leaf_node_list_created_in_node = 1;
-	}
-	/* Traverse the sub nodes
-	 */
-	if( internal_node->number_of_sub_nodes == 0 )
-	{
-		if( internal_node->value == NULL )
+		if( node_index == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid node - missing value.",
-			 function );
+			if( libcdata_tree_node_initialize_with_arena(
+			     &safe_node,
+			     number_of_nodes_per_chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create node.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			internal_sub_node = (libcdata_internal_tree_node_t *) safe_node;
 		}
-		if( libcdata_list_append_value(
-		     *leaf_node_list,
-		     internal_node->value,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append tree node to leaf node list.",
-			 function );
+			/* Ascend until a parent node is found that is missing sub nodes
+			 */
+			while( internal_parent_node != NULL )
+			{
+				if( libcdata_tree_view_get_number_of_sub_nodes(
+				     tree_view,
+				     parent_entry_offset,
+				     &parent_number_of_sub_nodes,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve number of sub nodes of parent node.",
+					 function );
 
-			goto on_error;
-		}
-	}
-	else
-	{
-		sub_node = internal_node->first_sub_node;
+					goto on_error;
+				}
+				if( internal_parent_node->number_of_sub_nodes < parent_number_of_sub_nodes )
+				{
+					break;
+				}
+				internal_parent_node = (libcdata_internal_tree_node_t *) internal_parent_node->parent_node;
 
-		for( sub_node_index = 0;
-		     sub_node_index < internal_node->number_of_sub_nodes;
-		     sub_node_index++ )
-		{
-			if( sub_node == NULL )
+				if( internal_parent_node != NULL )
+				{
+					if( libcdata_tree_view_get_parent_node_offset(
+					     tree_view,
+					     parent_entry_offset,
+					     &parent_entry_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve parent node offset.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+			if( ( internal_parent_node == NULL )
+			 || ( parent_node_offset != parent_entry_offset ) )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: corruption detected for sub node: %d.",
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid node: %d - parent node offset value out of bounds.",
 				 function,
-				 sub_node_index );
+				 node_index );
 
 				goto on_error;
 			}
-			if( libcdata_tree_node_get_leaf_node_list(
-			     sub_node,
-			     leaf_node_list,
+			if( libcdata_tree_node_initialize_in_arena(
+			     (libcdata_tree_node_t **) &internal_sub_node,
+			     safe_node,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: unable to traverse sub node: %d.",
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create sub node.",
+				 function );
+
+				goto on_error;
+			}
+			/* The sub node is freed with the arena on error
+			 */
+			if( libcdata_internal_tree_node_append_node(
+			     internal_parent_node,
+			     (libcdata_tree_node_t *) internal_sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sub node.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( flags & LIBCDATA_SERIALIZED_TREE_NODE_FLAG_HAS_VALUE ) != 0 )
+		{
+			if( value_deserialize_function(
+			     &( internal_sub_node->value ),
+			     &( data[ node_offset + sizeof( cdata_serialized_tree_node_t ) ] ),
+			     value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to deserialize value of node: %d.",
 				 function,
-				 sub_node_index );
+				 node_index );
 
 				goto on_error;
 			}
-			if( libcdata_tree_node_get_next_node(
-			     sub_node,
-			     &sub_node,
+		}
+		if( number_of_sub_nodes > 0 )
+		{
+			internal_parent_node = internal_sub_node;
+			parent_entry_offset  = node_offset;
+		}
+		internal_sub_node = NULL;
+
+		node_offset += sizeof( cdata_serialized_tree_node_t ) + value_data_size;
+	}
+	/* Check that no sub nodes are missing
+	 */
+	while( internal_parent_node != NULL )
+	{
+		if( libcdata_tree_view_get_number_of_sub_nodes(
+		     tree_view,
+		     parent_entry_offset,
+		     &parent_number_of_sub_nodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sub nodes of parent node.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_parent_node->number_of_sub_nodes != parent_number_of_sub_nodes )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub nodes.",
+			 function );
+
+			goto on_error;
+		}
+		internal_parent_node = (libcdata_internal_tree_node_t *) internal_parent_node->parent_node;
+
+		if( internal_parent_node != NULL )
+		{
+			if( libcdata_tree_view_get_parent_node_offset(
+			     tree_view,
+			     parent_entry_offset,
+			     &parent_entry_offset,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve next node of sub node: %d.",
-				 function,
-				 sub_node_index );
+				 "%s: unable to retrieve parent node offset.",
+				 function );
 
 				goto on_error;
 			}
 		}
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_node->read_write_lock,
+	if( libcdata_tree_view_free(
+	     &tree_view,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free tree view.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
+	*node = safe_node;
+
 	return( 1 );
 
 on_error:
-	if( leaf_node_list_created_in_node != 0 )
+	if( safe_node != NULL )
 	{
-		if( *leaf_node_list == NULL )
-		{
-			libcdata_list_initialize(
-			 leaf_node_list,
-			 NULL );
-		}
+		libcdata_tree_node_free(
+		 &safe_node,
+		 value_free_function,
+		 NULL );
+	}
+	if( tree_view != NULL )
+	{
+		libcdata_tree_view_free(
+		 &tree_view,
+		 NULL );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_node->read_write_lock,
-	 NULL );
-#endif
 	return( -1 );
 }
 
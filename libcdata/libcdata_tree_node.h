@@ -28,12 +28,34 @@
 #include "libcdata_extern.h"
 #include "libcdata_libcerror.h"
 #include "libcdata_libcthreads.h"
+#include "libcdata_tree_node_arena.h"
 #include "libcdata_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The number of sub nodes at which the sub nodes array is maintained
+ */
+#define LIBCDATA_TREE_NODE_SUB_NODES_ARRAY_THRESHOLD	16
+
+/* The maximum number of nodes per arena chunk used when deserializing a tree
+ */
+#define LIBCDATA_TREE_NODE_DESERIALIZE_MAXIMUM_NUMBER_OF_NODES_PER_CHUNK	65536
+
+typedef struct libcdata_tree_node_hash_table_entry libcdata_tree_node_hash_table_entry_t;
+
+struct libcdata_tree_node_hash_table_entry
+{
+	/* The hash of the sub node value
+	 */
+	uint64_t hash;
+
+	/* The sub node, NULL if the entry is unused
+	 */
+	libcdata_tree_node_t *sub_node;
+};
+
 typedef struct libcdata_internal_tree_node libcdata_internal_tree_node_t;
 
 struct libcdata_internal_tree_node
@@ -62,10 +84,69 @@ struct libcdata_internal_tree_node
 	 */
 	int number_of_sub_nodes;
 
+	/* The sub nodes array
+	 * Provides indexed access to the sub nodes, only maintained for nodes
+	 * with LIBCDATA_TREE_NODE_SUB_NODES_ARRAY_THRESHOLD or more sub nodes
+	 */
+	libcdata_tree_node_t **sub_nodes_array;
+
+	/* The number of allocated entries in the sub nodes array
+	 */
+	int number_of_allocated_sub_nodes_array_entries;
+
+	/* The sub nodes cumulative sizes
+	 * Entry N contains the number of nodes in the sub trees of the sub nodes 0 to N,
+	 * set together with the number of descendants for nodes with a sub nodes array
+	 */
+	int *sub_nodes_cumulative_sizes;
+
+	/* The number of entries in the sub nodes cumulative sizes
+	 */
+	int number_of_sub_nodes_cumulative_sizes;
+
+	/* The number of descendant nodes, which are all the nodes in the sub tree
+	 * except the node itself
+	 */
+	int number_of_descendants;
+
+	/* Value to indicate the number of descendant nodes is stale
+	 * The number is marked stale when the sub tree changes and recalculated
+	 * on demand, if a node is stale its parent nodes are stale as well
+	 */
+	uint8_t number_of_descendants_is_stale;
+
+	/* The sub nodes hash table
+	 * Provides lookup of the sub nodes by value, built on demand by
+	 * libcdata_tree_node_get_node_by_path for nodes with
+	 * LIBCDATA_TREE_NODE_SUB_NODES_ARRAY_THRESHOLD or more sub nodes
+	 */
+	libcdata_tree_node_hash_table_entry_t *sub_nodes_hash_table;
+
+	/* The number of entries in the sub nodes hash table, which is a power of 2
+	 */
+	int number_of_sub_nodes_hash_table_entries;
+
+	/* The hash function the sub nodes hash table was built with
+	 */
+	int (*sub_nodes_hash_function)(
+	       intptr_t *value,
+	       uint64_t *hash,
+	       libcerror_error_t **error );
+
+	/* Value to indicate the sub nodes hash table is stale
+	 * The hash table is marked stale when the sub nodes or their values change
+	 * and rebuilt on the next lookup
+	 */
+	uint8_t sub_nodes_hash_table_is_stale;
+
 	/* The node value
 	 */
 	intptr_t *value;
 
+	/* The arena the node is allocated from, NULL if allocated on the heap
+	 */
+	libcdata_tree_node_arena_t *arena;
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
 	/* The read/write lock
 	 */
@@ -78,6 +159,18 @@ int libcdata_tree_node_initialize(
      libcdata_tree_node_t **node,
      libcerror_error_t **error );
 
+LIBCDATA_EXTERN \
+int libcdata_tree_node_initialize_with_arena(
+     libcdata_tree_node_t **node,
+     int number_of_nodes_per_chunk,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_node_initialize_in_arena(
+     libcdata_tree_node_t **node,
+     libcdata_tree_node_t *arena_node,
+     libcerror_error_t **error );
+
 LIBCDATA_EXTERN \
 int libcdata_tree_node_free(
      libcdata_tree_node_t **node,
@@ -212,6 +305,49 @@ int libcdata_tree_node_set_sub_nodes(
      libcdata_tree_node_t *last_sub_node,
      libcerror_error_t **error );
 
+int libcdata_internal_tree_node_free_sub_nodes_array(
+     libcdata_internal_tree_node_t *internal_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_resize_sub_nodes_array(
+     libcdata_internal_tree_node_t *internal_node,
+     int number_of_sub_nodes,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_get_sub_nodes_array_entry_index(
+     libcdata_internal_tree_node_t *internal_node,
+     libcdata_tree_node_t *sub_node,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_bisect_sub_nodes_array(
+     libcdata_internal_tree_node_t *internal_node,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     uint8_t skip_equal_entries,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_insert_sub_nodes_array_entry(
+     libcdata_internal_tree_node_t *internal_node,
+     int entry_index,
+     libcdata_tree_node_t *sub_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_remove_sub_nodes_array_entry(
+     libcdata_internal_tree_node_t *internal_node,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_replace_sub_nodes_array_entry(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *sub_node,
+     libcdata_tree_node_t *replacement_sub_node,
+     libcerror_error_t **error );
+
 int libcdata_internal_tree_node_append_node(
      libcdata_internal_tree_node_t *internal_node,
      libcdata_tree_node_t *node_to_append,
@@ -247,6 +383,12 @@ int libcdata_internal_tree_node_insert_node_before_sub_node(
      libcdata_tree_node_t *node_to_insert,
      libcerror_error_t **error );
 
+int libcdata_internal_tree_node_insert_node_before_sub_node_with_lock(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *sub_node,
+     libcdata_tree_node_t *node_to_insert,
+     libcerror_error_t **error );
+
 LIBCDATA_EXTERN \
 int libcdata_tree_node_insert_node(
      libcdata_tree_node_t *node,
@@ -294,12 +436,228 @@ int libcdata_tree_node_get_sub_node_by_index(
      libcdata_tree_node_t **sub_node,
      libcerror_error_t **error );
 
+LIBCDATA_EXTERN \
+int libcdata_tree_node_get_sub_node_by_value(
+     libcdata_tree_node_t *node,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **sub_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_free_sub_nodes_hash_table(
+     libcdata_internal_tree_node_t *internal_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_build_sub_nodes_hash_table(
+     libcdata_internal_tree_node_t *internal_node,
+     int (*hash_function)(
+            intptr_t *value,
+            uint64_t *hash,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_compare_key(
+     libcdata_tree_node_t *node,
+     intptr_t *key,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_find_sub_node_by_key(
+     libcdata_internal_tree_node_t *internal_node,
+     intptr_t *key,
+     int (*hash_function)(
+            intptr_t *value,
+            uint64_t *hash,
+            libcerror_error_t **error ),
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **sub_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_get_sub_node_by_key(
+     libcdata_internal_tree_node_t *internal_node,
+     intptr_t *key,
+     int (*hash_function)(
+            intptr_t *value,
+            uint64_t *hash,
+            libcerror_error_t **error ),
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **sub_node,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_node_get_node_by_path(
+     libcdata_tree_node_t *node,
+     intptr_t **keys,
+     int number_of_keys,
+     int (*hash_function)(
+            intptr_t *value,
+            uint64_t *hash,
+            libcerror_error_t **error ),
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     libcdata_tree_node_t **path_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_invalidate_number_of_descendants(
+     libcdata_internal_tree_node_t *internal_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_get_number_of_descendants_values(
+     libcdata_internal_tree_node_t *internal_node,
+     libcdata_tree_node_t **first_sub_node,
+     libcdata_tree_node_t **next_node,
+     int *number_of_descendants,
+     uint8_t *number_of_descendants_is_stale,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_set_number_of_descendants(
+     libcdata_internal_tree_node_t *internal_node,
+     libcdata_tree_node_t **stale_sub_node,
+     libcdata_tree_node_t **parent_node,
+     libcdata_tree_node_t **next_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_calculate_number_of_descendants(
+     libcdata_internal_tree_node_t *internal_node,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_node_get_number_of_descendants(
+     libcdata_tree_node_t *node,
+     int *number_of_descendants,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_get_sub_node_by_preorder_index(
+     libcdata_internal_tree_node_t *internal_node,
+     int *preorder_index,
+     libcdata_tree_node_t **sub_node,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_node_get_node_by_preorder_index(
+     libcdata_tree_node_t *node,
+     int preorder_index,
+     libcdata_tree_node_t **preorder_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_get_first_leaf_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **leaf_node,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_node_get_next_node_in_sub_tree(
+     libcdata_tree_node_t *root_node,
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t **next_node,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_node_get_next_leaf_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *leaf_node,
+     libcdata_tree_node_t **next_leaf_node,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_node_get_next_pre_order_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *current_node,
+     libcdata_tree_node_t **next_node,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_node_get_next_post_order_node(
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *current_node,
+     libcdata_tree_node_t **next_node,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_node_parallel_visit(
+     libcdata_tree_node_t *node,
+     int (*callback_function)(
+            libcdata_tree_node_t *node,
+            intptr_t *value,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     int number_of_threads,
+     int serial_cutoff,
+     libcerror_error_t **error );
+
 LIBCDATA_EXTERN \
 int libcdata_tree_node_get_leaf_node_list(
      libcdata_tree_node_t *node,
      libcdata_list_t **leaf_node_list,
      libcerror_error_t **error );
 
+int libcdata_internal_tree_node_serialize(
+     libcdata_tree_node_t *node,
+     int (*value_serialize_function)(
+            intptr_t *value,
+            uint8_t *data,
+            size_t data_size,
+            size_t *value_data_size,
+            libcerror_error_t **error ),
+     uint8_t *data,
+     size_t data_size,
+     size_t *serialized_data_size,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_node_get_serialized_data_size(
+     libcdata_tree_node_t *node,
+     int (*value_serialize_function)(
+            intptr_t *value,
+            uint8_t *data,
+            size_t data_size,
+            size_t *value_data_size,
+            libcerror_error_t **error ),
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_node_serialize(
+     libcdata_tree_node_t *node,
+     int (*value_serialize_function)(
+            intptr_t *value,
+            uint8_t *data,
+            size_t data_size,
+            size_t *value_data_size,
+            libcerror_error_t **error ),
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_node_deserialize(
+     libcdata_tree_node_t **node,
+     const uint8_t *data,
+     size_t data_size,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     int (*value_deserialize_function)(
+            intptr_t **value,
+            const uint8_t *data,
+            size_t data_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
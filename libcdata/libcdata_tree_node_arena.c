@@ -0,0 +1,493 @@
+/*
+ * Tree node arena functions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdata_libcerror.h"
+#include "libcdata_libcthreads.h"
+#include "libcdata_tree_node.h"
+#include "libcdata_tree_node_arena.h"
+#include "libcdata_types.h"
+
+/* Creates a tree node arena
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_arena_initialize(
+     libcdata_tree_node_arena_t **arena,
+     int number_of_nodes_per_chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nodes_per_chunk <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of nodes per chunk value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+	if( (size_t) number_of_nodes_per_chunk > (size_t) ( SSIZE_MAX / sizeof( libcdata_internal_tree_node_t ) ) )
+#else
+	if( number_of_nodes_per_chunk > (int) ( SSIZE_MAX / sizeof( libcdata_internal_tree_node_t ) ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of nodes per chunk value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libcdata_tree_node_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libcdata_tree_node_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+
+		return( -1 );
+	}
+	( *arena )->number_of_nodes_per_chunk = number_of_nodes_per_chunk;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *arena )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a tree node arena and all the nodes allocated from it
+ * Uses the value_free_function to free the values of the nodes
+ * The nodes are released per chunk, only the resources the individual nodes
+ * reference, such as values and sub nodes arrays, are released per node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_arena_free(
+     libcdata_tree_node_arena_t **arena,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_node_t *internal_node = NULL;
+	static char *function                        = "libcdata_tree_node_arena_free";
+	int chunk_index                              = 0;
+	int node_index                               = 0;
+	int number_of_nodes                          = 0;
+	int result                                   = 1;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		for( chunk_index = 0;
+		     chunk_index < ( *arena )->number_of_chunks;
+		     chunk_index++ )
+		{
+			if( chunk_index == ( ( *arena )->number_of_chunks - 1 ) )
+			{
+				number_of_nodes = ( *arena )->number_of_used_nodes;
+			}
+			else
+			{
+				number_of_nodes = ( *arena )->number_of_nodes_per_chunk;
+			}
+			for( node_index = 0;
+			     node_index < number_of_nodes;
+			     node_index++ )
+			{
+				internal_node = &( ( ( *arena )->chunks[ chunk_index ] )[ node_index ] );
+
+				if( libcdata_internal_tree_node_free_sub_nodes_array(
+				     internal_node,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free sub nodes array.",
+					 function );
+
+					result = -1;
+				}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+				if( internal_node->read_write_lock != NULL )
+				{
+					if( libcthreads_read_write_lock_free(
+					     &( internal_node->read_write_lock ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free read/write lock.",
+						 function );
+
+						result = -1;
+					}
+				}
+#endif
+				if( ( internal_node->value != NULL )
+				 && ( value_free_function != NULL ) )
+				{
+					if( value_free_function(
+					     &( internal_node->value ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free value.",
+						 function );
+
+						result = -1;
+					}
+					internal_node->value = NULL;
+				}
+			}
+			memory_free(
+			 ( *arena )->chunks[ chunk_index ] );
+		}
+		if( ( *arena )->chunks != NULL )
+		{
+			memory_free(
+			 ( *arena )->chunks );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *arena )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( result );
+}
+
+/* Allocates a tree node from the arena
+ * The node is released when the arena is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_arena_allocate_node(
+     libcdata_tree_node_arena_t *arena,
+     libcdata_tree_node_t **node,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_node_t **reallocation = NULL;
+	libcdata_internal_tree_node_t *chunk         = NULL;
+	libcdata_internal_tree_node_t *internal_node = NULL;
+	static char *function                        = "libcdata_tree_node_arena_allocate_node";
+	size_t chunk_size                            = 0;
+	size_t chunks_size                           = 0;
+	int number_of_allocated_chunks               = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     arena->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( arena->number_of_chunks == 0 )
+	 || ( arena->number_of_used_nodes >= arena->number_of_nodes_per_chunk ) )
+	{
+		if( arena->number_of_chunks >= arena->number_of_allocated_chunks )
+		{
+			/* Pre-allocate in blocks of 16 chunks
+			 */
+			if( arena->number_of_allocated_chunks >= (int) ( INT_MAX - 16 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of allocated chunks value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			number_of_allocated_chunks = arena->number_of_allocated_chunks + 16;
+
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+			if( (size_t) number_of_allocated_chunks > (size_t) ( SSIZE_MAX / sizeof( libcdata_internal_tree_node_t * ) ) )
+#else
+			if( number_of_allocated_chunks > (int) ( SSIZE_MAX / sizeof( libcdata_internal_tree_node_t * ) ) )
+#endif
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of allocated chunks value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			chunks_size = sizeof( libcdata_internal_tree_node_t * ) * number_of_allocated_chunks;
+
+			reallocation = (libcdata_internal_tree_node_t **) memory_reallocate(
+			                                                   arena->chunks,
+			                                                   chunks_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize chunks.",
+				 function );
+
+				goto on_error;
+			}
+			arena->chunks                     = reallocation;
+			arena->number_of_allocated_chunks = number_of_allocated_chunks;
+		}
+		chunk_size = sizeof( libcdata_internal_tree_node_t ) * arena->number_of_nodes_per_chunk;
+
+		chunk = (libcdata_internal_tree_node_t *) memory_allocate(
+		                                           chunk_size );
+
+		if( chunk == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk.",
+			 function );
+
+			goto on_error;
+		}
+		arena->chunks[ arena->number_of_chunks ] = chunk;
+
+		arena->number_of_chunks    += 1;
+		arena->number_of_used_nodes = 0;
+	}
+	internal_node = &( ( arena->chunks[ arena->number_of_chunks - 1 ] )[ arena->number_of_used_nodes ] );
+
+	arena->number_of_used_nodes += 1;
+
+	/* The node is cleared while the lock is held so that a concurrent
+	 * arena free never sees an uninitialized node
+	 */
+	if( memory_set(
+	     internal_node,
+	     0,
+	     sizeof( libcdata_internal_tree_node_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear node.",
+		 function );
+
+		goto on_error;
+	}
+	internal_node->arena = arena;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_read_write_lock_release_for_write(
+	     arena->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	/* The read/write lock of a node allocated from an arena is freed
+	 * when the arena is freed
+	 */
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_node->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*node = (libcdata_tree_node_t *) internal_node;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	libcthreads_read_write_lock_release_for_write(
+	 arena->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
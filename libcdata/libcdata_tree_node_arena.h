@@ -0,0 +1,93 @@
+/*
+ * Tree node arena functions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATA_TREE_NODE_ARENA_H )
+#define _LIBCDATA_TREE_NODE_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdata_libcerror.h"
+#include "libcdata_libcthreads.h"
+#include "libcdata_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcdata_tree_node_arena libcdata_tree_node_arena_t;
+
+struct libcdata_tree_node_arena
+{
+	/* The node that owns the arena
+	 */
+	libcdata_tree_node_t *root_node;
+
+	/* The chunks, each chunk contains number_of_nodes_per_chunk nodes
+	 */
+	struct libcdata_internal_tree_node **chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The number of allocated entries in the chunks array
+	 */
+	int number_of_allocated_chunks;
+
+	/* The number of nodes per chunk
+	 */
+	int number_of_nodes_per_chunk;
+
+	/* The number of nodes that are used in the last chunk
+	 */
+	int number_of_used_nodes;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libcdata_tree_node_arena_initialize(
+     libcdata_tree_node_arena_t **arena,
+     int number_of_nodes_per_chunk,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_arena_free(
+     libcdata_tree_node_arena_t **arena,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libcdata_tree_node_arena_allocate_node(
+     libcdata_tree_node_arena_t *arena,
+     libcdata_tree_node_t **node,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATA_TREE_NODE_ARENA_H ) */
+
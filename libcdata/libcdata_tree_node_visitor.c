@@ -0,0 +1,1891 @@
+/*
+ * Tree node visitor functions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdata_libcerror.h"
+#include "libcdata_libcthreads.h"
+#include "libcdata_tree_node.h"
+#include "libcdata_tree_node_visitor.h"
+#include "libcdata_types.h"
+
+/* Creates a visitor queue
+ * Make sure the value queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_queue_initialize(
+     libcdata_tree_node_visitor_queue_t **queue,
+     libcdata_tree_node_visitor_t *visitor,
+     int queue_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_visitor_queue_initialize";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid queue index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*queue = memory_allocate_structure(
+	          libcdata_tree_node_visitor_queue_t );
+
+	if( *queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *queue,
+	     0,
+	     sizeof( libcdata_tree_node_visitor_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear queue.",
+		 function );
+
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_initialize(
+	     &( ( *queue )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *queue )->visitor     = visitor;
+	( *queue )->queue_index = queue_index;
+	( *queue )->result      = 1;
+
+	return( 1 );
+
+on_error:
+	if( *queue != NULL )
+	{
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a visitor queue
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_queue_free(
+     libcdata_tree_node_visitor_queue_t **queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_visitor_queue_free";
+	int result            = 1;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *queue != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+		if( libcthreads_mutex_free(
+		     &( ( *queue )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *queue )->tasks != NULL )
+		{
+			memory_free(
+			 ( *queue )->tasks );
+		}
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+	}
+	return( result );
+}
+
+/* Pushes a task onto the back of the queue
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_queue_push_task(
+     libcdata_tree_node_visitor_queue_t *queue,
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *parent_node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_visitor_task_t *reallocation = NULL;
+	static char *function                           = "libcdata_tree_node_visitor_queue_push_task";
+	size_t tasks_size                               = 0;
+	int number_of_allocated_tasks                   = 0;
+	int number_of_tasks                             = 0;
+	int task_index                                  = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( queue->last_task_index >= queue->number_of_allocated_tasks )
+	{
+		number_of_tasks = queue->last_task_index - queue->first_task_index;
+
+		if( queue->first_task_index > 0 )
+		{
+			/* Reclaim the space of the tasks that were stolen from the front
+			 * the tasks are moved one by one since the ranges can overlap
+			 */
+			for( task_index = 0;
+			     task_index < number_of_tasks;
+			     task_index++ )
+			{
+				queue->tasks[ task_index ] = queue->tasks[ queue->first_task_index + task_index ];
+			}
+			queue->first_task_index = 0;
+			queue->last_task_index  = number_of_tasks;
+		}
+	}
+	if( queue->last_task_index >= queue->number_of_allocated_tasks )
+	{
+		/* Pre-allocate in blocks of 16 tasks
+		 */
+		if( queue->number_of_allocated_tasks >= (int) ( INT_MAX - 16 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated tasks value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_allocated_tasks = queue->number_of_allocated_tasks + 16;
+
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+		if( (size_t) number_of_allocated_tasks > (size_t) ( SSIZE_MAX / sizeof( libcdata_tree_node_visitor_task_t ) ) )
+#else
+		if( number_of_allocated_tasks > (int) ( SSIZE_MAX / sizeof( libcdata_tree_node_visitor_task_t ) ) )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated tasks value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		tasks_size = sizeof( libcdata_tree_node_visitor_task_t ) * number_of_allocated_tasks;
+
+		reallocation = (libcdata_tree_node_visitor_task_t *) memory_reallocate(
+		                                                      queue->tasks,
+		                                                      tasks_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize tasks.",
+			 function );
+
+			goto on_error;
+		}
+		queue->tasks                     = reallocation;
+		queue->number_of_allocated_tasks = number_of_allocated_tasks;
+	}
+	queue->tasks[ queue->last_task_index ].node        = node;
+	queue->tasks[ queue->last_task_index ].parent_node = parent_node;
+
+	queue->last_task_index += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	libcthreads_mutex_release(
+	 queue->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Pops a task from the back of the queue
+ * Returns 1 if successful, 0 if the queue is empty or -1 on error
+ */
+int libcdata_tree_node_visitor_queue_pop_task(
+     libcdata_tree_node_visitor_queue_t *queue,
+     libcdata_tree_node_visitor_task_t *task,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_visitor_queue_pop_task";
+	int result            = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( queue->last_task_index > queue->first_task_index )
+	{
+		queue->last_task_index -= 1;
+
+		task->node        = queue->tasks[ queue->last_task_index ].node;
+		task->parent_node = queue->tasks[ queue->last_task_index ].parent_node;
+
+		if( queue->last_task_index == queue->first_task_index )
+		{
+			queue->first_task_index = 0;
+			queue->last_task_index  = 0;
+		}
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Steals a task from the front of the queue
+ * Returns 1 if successful, 0 if the queue is empty or -1 on error
+ */
+int libcdata_tree_node_visitor_queue_steal_task(
+     libcdata_tree_node_visitor_queue_t *queue,
+     libcdata_tree_node_visitor_task_t *task,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_visitor_queue_steal_task";
+	int result            = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( queue->last_task_index > queue->first_task_index )
+	{
+		task->node        = queue->tasks[ queue->first_task_index ].node;
+		task->parent_node = queue->tasks[ queue->first_task_index ].parent_node;
+
+		queue->first_task_index += 1;
+
+		if( queue->last_task_index == queue->first_task_index )
+		{
+			queue->first_task_index = 0;
+			queue->last_task_index  = 0;
+		}
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Creates a visitor
+ * Make sure the value visitor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_initialize(
+     libcdata_tree_node_visitor_t **visitor,
+     int (*callback_function)(
+            libcdata_tree_node_t *node,
+            intptr_t *value,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     int number_of_queues,
+     int serial_cutoff,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_visitor_initialize";
+	size_t queues_size    = 0;
+	int queue_index       = 0;
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *visitor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid visitor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+	if( ( number_of_queues <= 0 )
+	 || ( (size_t) number_of_queues > (size_t) ( SSIZE_MAX / sizeof( libcdata_tree_node_visitor_queue_t * ) ) ) )
+#else
+	if( ( number_of_queues <= 0 )
+	 || ( number_of_queues > (int) ( SSIZE_MAX / sizeof( libcdata_tree_node_visitor_queue_t * ) ) ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of queues value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( serial_cutoff <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid serial cutoff value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*visitor = memory_allocate_structure(
+	            libcdata_tree_node_visitor_t );
+
+	if( *visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create visitor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *visitor,
+	     0,
+	     sizeof( libcdata_tree_node_visitor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear visitor.",
+		 function );
+
+		memory_free(
+		 *visitor );
+
+		*visitor = NULL;
+
+		return( -1 );
+	}
+	queues_size = sizeof( libcdata_tree_node_visitor_queue_t * ) * number_of_queues;
+
+	( *visitor )->queues = (libcdata_tree_node_visitor_queue_t **) memory_allocate(
+	                                                                queues_size );
+
+	if( ( *visitor )->queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create queues.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *visitor )->queues,
+	     0,
+	     queues_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear queues.",
+		 function );
+
+		goto on_error;
+	}
+	( *visitor )->number_of_queues = number_of_queues;
+
+	for( queue_index = 0;
+	     queue_index < number_of_queues;
+	     queue_index++ )
+	{
+		if( libcdata_tree_node_visitor_queue_initialize(
+		     &( ( *visitor )->queues[ queue_index ] ),
+		     *visitor,
+		     queue_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create queue: %d.",
+			 function,
+			 queue_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_initialize(
+	     &( ( *visitor )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *visitor )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *visitor )->callback_function = callback_function;
+	( *visitor )->user_data         = user_data;
+	( *visitor )->serial_cutoff     = serial_cutoff;
+
+	return( 1 );
+
+on_error:
+	if( *visitor != NULL )
+	{
+		libcdata_tree_node_visitor_free(
+		 visitor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a visitor
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_free(
+     libcdata_tree_node_visitor_t **visitor,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_visitor_free";
+	int queue_index       = 0;
+	int result            = 1;
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *visitor != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+		if( ( *visitor )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *visitor )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *visitor )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *visitor )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *visitor )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *visitor )->error ) );
+		}
+		if( ( *visitor )->queues != NULL )
+		{
+			for( queue_index = 0;
+			     queue_index < ( *visitor )->number_of_queues;
+			     queue_index++ )
+			{
+				if( libcdata_tree_node_visitor_queue_free(
+				     &( ( *visitor )->queues[ queue_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free queue: %d.",
+					 function,
+					 queue_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *visitor )->queues );
+		}
+		memory_free(
+		 *visitor );
+
+		*visitor = NULL;
+	}
+	return( result );
+}
+
+/* Pushes a task onto a queue of the visitor
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_push_task(
+     libcdata_tree_node_visitor_t *visitor,
+     int queue_index,
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *parent_node,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_visitor_push_task";
+	int result            = 1;
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_index < 0 )
+	 || ( queue_index >= visitor->number_of_queues ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The task is accounted for before it is queued so that the number
+	 * of pending tasks cannot drop to zero while it is being visited
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_grab(
+	     visitor->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_tree_node_visitor_queue_push_task(
+	     visitor->queues[ queue_index ],
+	     node,
+	     parent_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push task onto queue: %d.",
+		 function,
+		 queue_index );
+
+		result = -1;
+	}
+	else
+	{
+		visitor->number_of_queued_tasks  += 1;
+		visitor->number_of_pending_tasks += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+		if( libcthreads_condition_broadcast(
+		     visitor->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_release(
+	     visitor->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a task for a worker
+ * The task is popped from the queue of the worker or stolen from the queue of another worker
+ * If no task is available the worker waits until a task is queued or the visit is finished
+ * Returns 1 if successful, 0 if the visit is finished or -1 on error
+ */
+int libcdata_tree_node_visitor_get_task(
+     libcdata_tree_node_visitor_t *visitor,
+     int queue_index,
+     libcdata_tree_node_visitor_task_t *task,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_visitor_get_task";
+	int result            = 0;
+	int steal_index       = 0;
+	int steal_queue_index = 0;
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_index < 0 )
+	 || ( queue_index >= visitor->number_of_queues ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libcdata_tree_node_visitor_queue_pop_task(
+		          visitor->queues[ queue_index ],
+		          task,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop task from queue: %d.",
+			 function,
+			 queue_index );
+
+			return( -1 );
+		}
+		for( steal_index = 1;
+		     ( result == 0 ) && ( steal_index < visitor->number_of_queues );
+		     steal_index++ )
+		{
+			steal_queue_index = ( queue_index + steal_index ) % visitor->number_of_queues;
+
+			result = libcdata_tree_node_visitor_queue_steal_task(
+			          visitor->queues[ steal_queue_index ],
+			          task,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to steal task from queue: %d.",
+				 function,
+				 steal_queue_index );
+
+				return( -1 );
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+		if( libcthreads_mutex_grab(
+		     visitor->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( result != 0 )
+		{
+			visitor->number_of_queued_tasks -= 1;
+		}
+		if( ( visitor->abort != 0 )
+		 || ( ( result == 0 )
+		  &&  ( visitor->number_of_pending_tasks == 0 ) ) )
+		{
+			/* The visit is finished
+			 */
+			result = -2;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+		else if( result == 0 )
+		{
+			/* Wait for a task to be queued by another worker
+			 * or for the visit to be finished
+			 */
+			while( ( visitor->abort == 0 )
+			    && ( visitor->number_of_queued_tasks == 0 )
+			    && ( visitor->number_of_pending_tasks > 0 ) )
+			{
+				if( libcthreads_condition_wait(
+				     visitor->condition,
+				     visitor->mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to wait for condition.",
+					 function );
+
+					libcthreads_mutex_release(
+					 visitor->mutex,
+					 NULL );
+
+					return( -1 );
+				}
+			}
+		}
+		if( libcthreads_mutex_release(
+		     visitor->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#else
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid visitor - pending tasks without queued tasks.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	while( result == 0 );
+
+	if( result == -2 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Marks a task of the visitor as completed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_complete_task(
+     libcdata_tree_node_visitor_t *visitor,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_visitor_complete_task";
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_grab(
+	     visitor->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( visitor->number_of_pending_tasks > 0 )
+	{
+		visitor->number_of_pending_tasks -= 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( visitor->number_of_pending_tasks == 0 )
+	{
+		if( libcthreads_condition_broadcast(
+		     visitor->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 visitor->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     visitor->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Aborts the visit
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_abort(
+     libcdata_tree_node_visitor_t *visitor,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_visitor_abort";
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_grab(
+	     visitor->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	visitor->abort = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_condition_broadcast(
+	     visitor->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		libcthreads_mutex_release(
+		 visitor->mutex,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_release(
+	     visitor->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the error of a worker that failed
+ * Only the error of the first worker that fails is kept, in which case the visitor
+ * takes ownership of the worker error and the worker error is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_set_worker_error(
+     libcdata_tree_node_visitor_t *visitor,
+     libcerror_error_t **worker_error,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_node_visitor_set_worker_error";
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_error == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker error.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_grab(
+	     visitor->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( visitor->error == NULL )
+	{
+		visitor->error = *worker_error;
+		*worker_error  = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( libcthreads_mutex_release(
+	     visitor->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Splits the remainder of a task, starting at node, into new tasks
+ * The remainder consists of the sub trees of node and its next nodes and of
+ * the next nodes of the ancestors of node up to the node or parent node of the task
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_split_task(
+     libcdata_tree_node_visitor_t *visitor,
+     int queue_index,
+     libcdata_tree_node_visitor_task_t *task,
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *ancestor_node = NULL;
+	libcdata_tree_node_t *next_node     = NULL;
+	libcdata_tree_node_t *parent_node   = NULL;
+	libcdata_tree_node_t *previous_node = NULL;
+	libcdata_tree_node_t *stop_node     = NULL;
+	static char *function               = "libcdata_tree_node_visitor_split_task";
+
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == task->node )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node value same as task node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_get_parent_node(
+	     node,
+	     &parent_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent node.",
+		 function );
+
+		return( -1 );
+	}
+	if( task->parent_node != NULL )
+	{
+		stop_node = task->parent_node;
+	}
+	else
+	{
+		stop_node = task->node;
+	}
+	/* The next nodes of the ancestors are pushed first so that the sub tree
+	 * of node, which is pushed last, is popped next by the owner of the queue
+	 */
+	ancestor_node = parent_node;
+
+	while( ancestor_node != stop_node )
+	{
+		if( libcdata_tree_node_get_nodes(
+		     ancestor_node,
+		     &parent_node,
+		     &previous_node,
+		     &next_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve nodes of ancestor node.",
+			 function );
+
+			return( -1 );
+		}
+		if( parent_node == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid ancestor node - missing parent node.",
+			 function );
+
+			return( -1 );
+		}
+		if( next_node != NULL )
+		{
+			if( libcdata_tree_node_visitor_push_task(
+			     visitor,
+			     queue_index,
+			     next_node,
+			     parent_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task of next node of ancestor node.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		ancestor_node = parent_node;
+	}
+	if( libcdata_tree_node_get_parent_node(
+	     node,
+	     &parent_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_visitor_push_task(
+	     visitor,
+	     queue_index,
+	     node,
+	     parent_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push task of node.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Visits the nodes of a task in pre-order
+ * Once the serial cutoff is reached the remainder of the task is split into new tasks
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_visit_task(
+     libcdata_tree_node_visitor_t *visitor,
+     int queue_index,
+     libcdata_tree_node_visitor_task_t *task,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *next_node     = NULL;
+	libcdata_tree_node_t *node          = NULL;
+	libcdata_tree_node_t *parent_node   = NULL;
+	libcdata_tree_node_t *previous_node = NULL;
+	intptr_t *value                     = NULL;
+	static char *function               = "libcdata_tree_node_visitor_visit_task";
+	int number_of_visited_nodes         = 0;
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	node = task->node;
+
+	while( node != NULL )
+	{
+		if( number_of_visited_nodes >= visitor->serial_cutoff )
+		{
+			if( libcdata_tree_node_visitor_split_task(
+			     visitor,
+			     queue_index,
+			     task,
+			     node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to split task.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+		if( libcdata_tree_node_get_value(
+		     node,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value of node.",
+			 function );
+
+			return( -1 );
+		}
+		if( visitor->callback_function(
+		     node,
+		     value,
+		     visitor->user_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to visit node.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_visited_nodes++;
+
+		if( libcdata_tree_node_get_first_sub_node(
+		     node,
+		     &next_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first sub node.",
+			 function );
+
+			return( -1 );
+		}
+		/* If the node has no sub nodes ascend until a node with a next node
+		 * is found, without leaving the bounds of the task
+		 */
+		while( next_node == NULL )
+		{
+			if( ( task->parent_node == NULL )
+			 && ( node == task->node ) )
+			{
+				break;
+			}
+			if( libcdata_tree_node_get_nodes(
+			     node,
+			     &parent_node,
+			     &previous_node,
+			     &next_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve nodes.",
+				 function );
+
+				return( -1 );
+			}
+			if( next_node != NULL )
+			{
+				break;
+			}
+			if( parent_node == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid node - missing parent node.",
+				 function );
+
+				return( -1 );
+			}
+			if( parent_node == task->parent_node )
+			{
+				break;
+			}
+			node = parent_node;
+		}
+		node = next_node;
+	}
+	return( 1 );
+}
+
+/* The worker function, visits tasks until the visit is finished
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_worker_function(
+     libcdata_tree_node_visitor_queue_t *queue )
+{
+	libcdata_tree_node_visitor_task_t task;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	if( queue == NULL )
+	{
+		return( -1 );
+	}
+	do
+	{
+		result = libcdata_tree_node_visitor_get_task(
+		          queue->visitor,
+		          queue->queue_index,
+		          &task,
+		          &error );
+
+		if( result == 1 )
+		{
+			if( libcdata_tree_node_visitor_visit_task(
+			     queue->visitor,
+			     queue->queue_index,
+			     &task,
+			     &error ) != 1 )
+			{
+				result = -1;
+			}
+			if( libcdata_tree_node_visitor_complete_task(
+			     queue->visitor,
+			     &error ) != 1 )
+			{
+				result = -1;
+			}
+		}
+	}
+	while( result == 1 );
+
+	if( result == -1 )
+	{
+		libcdata_tree_node_visitor_abort(
+		 queue->visitor,
+		 NULL );
+
+		libcdata_tree_node_visitor_set_worker_error(
+		 queue->visitor,
+		 &error,
+		 NULL );
+
+		if( error != NULL )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	else
+	{
+		result = 1;
+	}
+	queue->result = result;
+
+	return( result );
+}
+
+/* Visits the node and its sub nodes
+ * The calling thread acts as the worker of the first queue, when multi-threading
+ * is supported a thread is created for every other queue
+ * If a worker fails, the error of the first worker that failed is chained into error
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_node_visitor_run(
+     libcdata_tree_node_visitor_t *visitor,
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	libcthreads_thread_t **threads = NULL;
+	size_t threads_size            = 0;
+#endif
+	static char *function          = "libcdata_tree_node_visitor_run";
+	int queue_index                = 0;
+	int result                     = 1;
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_tree_node_visitor_push_task(
+	     visitor,
+	     0,
+	     node,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push task of node.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( visitor->number_of_queues > 1 )
+	{
+		threads_size = sizeof( libcthreads_thread_t * ) * visitor->number_of_queues;
+
+		threads = (libcthreads_thread_t **) memory_allocate(
+		                                     threads_size );
+
+		if( threads == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create threads.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     threads,
+		     0,
+		     threads_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear threads.",
+			 function );
+
+			memory_free(
+			 threads );
+
+			return( -1 );
+		}
+		for( queue_index = 1;
+		     queue_index < visitor->number_of_queues;
+		     queue_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( threads[ queue_index ] ),
+			     NULL,
+			     (int (*)(void *)) &libcdata_tree_node_visitor_worker_function,
+			     (void *) visitor->queues[ queue_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 queue_index );
+
+				libcdata_tree_node_visitor_abort(
+				 visitor,
+				 NULL );
+
+				result = -1;
+
+				break;
+			}
+		}
+	}
+#endif
+	if( result == 1 )
+	{
+		if( libcdata_tree_node_visitor_worker_function(
+		     visitor->queues[ 0 ] ) != 1 )
+		{
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	if( threads != NULL )
+	{
+		for( queue_index = 1;
+		     queue_index < visitor->number_of_queues;
+		     queue_index++ )
+		{
+			if( threads[ queue_index ] == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_join(
+			     &( threads[ queue_index ] ),
+			     NULL ) != 1 )
+			{
+				result = -1;
+			}
+		}
+		memory_free(
+		 threads );
+	}
+#endif
+	for( queue_index = 0;
+	     queue_index < visitor->number_of_queues;
+	     queue_index++ )
+	{
+		if( visitor->queues[ queue_index ]->result != 1 )
+		{
+			result = -1;
+		}
+	}
+	/* The workers have finished, hence the error can be accessed without the mutex
+	 */
+	if( visitor->error != NULL )
+	{
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error         = visitor->error;
+			visitor->error = NULL;
+		}
+		else
+		{
+			libcerror_error_free(
+			 &( visitor->error ) );
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit node and sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,246 @@
+/*
+ * Tree node visitor functions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATA_TREE_NODE_VISITOR_H )
+#define _LIBCDATA_TREE_NODE_VISITOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdata_libcerror.h"
+#include "libcdata_libcthreads.h"
+#include "libcdata_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default maximum number of nodes a task visits before the remainder of the task
+ * is split into new tasks that can be stolen by other threads
+ */
+#if !defined( LIBCDATA_TREE_NODE_VISITOR_SERIAL_CUTOFF )
+#define LIBCDATA_TREE_NODE_VISITOR_SERIAL_CUTOFF	256
+#endif
+
+typedef struct libcdata_tree_node_visitor_task libcdata_tree_node_visitor_task_t;
+
+struct libcdata_tree_node_visitor_task
+{
+	/* The node to start visiting from
+	 */
+	libcdata_tree_node_t *node;
+
+	/* The parent node that bounds the task
+	 * If set the sub trees of the node and its next nodes are visited
+	 * otherwise only the sub tree of the node is visited
+	 */
+	libcdata_tree_node_t *parent_node;
+};
+
+typedef struct libcdata_tree_node_visitor libcdata_tree_node_visitor_t;
+
+typedef struct libcdata_tree_node_visitor_queue libcdata_tree_node_visitor_queue_t;
+
+struct libcdata_tree_node_visitor_queue
+{
+	/* The visitor
+	 */
+	libcdata_tree_node_visitor_t *visitor;
+
+	/* The queue index
+	 */
+	int queue_index;
+
+	/* The tasks
+	 */
+	libcdata_tree_node_visitor_task_t *tasks;
+
+	/* The index of the first task, tasks are stolen from the front
+	 */
+	int first_task_index;
+
+	/* The index of the last task, tasks are pushed and popped at the back
+	 */
+	int last_task_index;
+
+	/* The number of allocated tasks
+	 */
+	int number_of_allocated_tasks;
+
+	/* The result of the worker that owns the queue
+	 */
+	int result;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+struct libcdata_tree_node_visitor
+{
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       libcdata_tree_node_t *node,
+	       intptr_t *value,
+	       void *user_data,
+	       libcerror_error_t **error );
+
+	/* The user data
+	 */
+	void *user_data;
+
+	/* The maximum number of nodes a task visits before it is split
+	 */
+	int serial_cutoff;
+
+	/* The queues, one per worker
+	 */
+	libcdata_tree_node_visitor_queue_t **queues;
+
+	/* The number of queues
+	 */
+	int number_of_queues;
+
+	/* The number of tasks that are queued
+	 */
+	int number_of_queued_tasks;
+
+	/* The number of tasks that are queued or being visited
+	 */
+	int number_of_pending_tasks;
+
+	/* Value to indicate the visit should be aborted
+	 */
+	uint8_t abort;
+
+	/* The error of the first worker that failed
+	 */
+	libcerror_error_t *error;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBCDATA )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition, signalled when tasks are queued or when the visit is finished
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+int libcdata_tree_node_visitor_queue_initialize(
+     libcdata_tree_node_visitor_queue_t **queue,
+     libcdata_tree_node_visitor_t *visitor,
+     int queue_index,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_queue_free(
+     libcdata_tree_node_visitor_queue_t **queue,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_queue_push_task(
+     libcdata_tree_node_visitor_queue_t *queue,
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *parent_node,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_queue_pop_task(
+     libcdata_tree_node_visitor_queue_t *queue,
+     libcdata_tree_node_visitor_task_t *task,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_queue_steal_task(
+     libcdata_tree_node_visitor_queue_t *queue,
+     libcdata_tree_node_visitor_task_t *task,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_initialize(
+     libcdata_tree_node_visitor_t **visitor,
+     int (*callback_function)(
+            libcdata_tree_node_t *node,
+            intptr_t *value,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     int number_of_queues,
+     int serial_cutoff,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_free(
+     libcdata_tree_node_visitor_t **visitor,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_push_task(
+     libcdata_tree_node_visitor_t *visitor,
+     int queue_index,
+     libcdata_tree_node_t *node,
+     libcdata_tree_node_t *parent_node,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_get_task(
+     libcdata_tree_node_visitor_t *visitor,
+     int queue_index,
+     libcdata_tree_node_visitor_task_t *task,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_complete_task(
+     libcdata_tree_node_visitor_t *visitor,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_abort(
+     libcdata_tree_node_visitor_t *visitor,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_set_worker_error(
+     libcdata_tree_node_visitor_t *visitor,
+     libcerror_error_t **worker_error,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_split_task(
+     libcdata_tree_node_visitor_t *visitor,
+     int queue_index,
+     libcdata_tree_node_visitor_task_t *task,
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_visit_task(
+     libcdata_tree_node_visitor_t *visitor,
+     int queue_index,
+     libcdata_tree_node_visitor_task_t *task,
+     libcerror_error_t **error );
+
+int libcdata_tree_node_visitor_worker_function(
+     libcdata_tree_node_visitor_queue_t *queue );
+
+int libcdata_tree_node_visitor_run(
+     libcdata_tree_node_visitor_t *visitor,
+     libcdata_tree_node_t *node,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATA_TREE_NODE_VISITOR_H ) */
+
@@ -0,0 +1,867 @@
+/*
+ * Tree view functions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdata_definitions.h"
+#include "libcdata_libcerror.h"
+#include "libcdata_tree_view.h"
+#include "libcdata_types.h"
+
+#include "cdata_serialized_tree.h"
+
+const uint8_t cdata_serialized_tree_signature[ 8 ] = {
+	'c', 'd', 't', 'r', 'e', 'e', 0x00, 0x00 };
+
+/* Creates a tree view
+ * The tree view provides read-only access to a serialized tree without
+ * creating the nodes, the data is referenced and must remain available
+ * until the tree view is freed
+ * Make sure the value tree_view is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_view_initialize(
+     libcdata_tree_view_t **tree_view,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_view_t *internal_tree_view = NULL;
+	static char *function                             = "libcdata_tree_view_initialize";
+	uint64_t reserved                                 = 0;
+	uint64_t serialized_data_size                     = 0;
+	uint32_t format_version                           = 0;
+	uint32_t number_of_nodes                          = 0;
+
+	if( tree_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tree_view != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid tree view value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( cdata_serialized_tree_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (cdata_serialized_tree_header_t *) data )->signature,
+	     cdata_serialized_tree_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (cdata_serialized_tree_header_t *) data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (cdata_serialized_tree_header_t *) data )->number_of_nodes,
+	 number_of_nodes );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (cdata_serialized_tree_header_t *) data )->data_size,
+	 serialized_data_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (cdata_serialized_tree_header_t *) data )->reserved,
+	 reserved );
+
+	if( format_version != LIBCDATA_SERIALIZED_TREE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( reserved != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported reserved value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( serialized_data_size < sizeof( cdata_serialized_tree_header_t ) )
+	 || ( serialized_data_size > (uint64_t) data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid serialized data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_nodes == 0 )
+	 || ( number_of_nodes > (uint32_t) INT_MAX )
+	 || ( (uint64_t) number_of_nodes > ( ( serialized_data_size - sizeof( cdata_serialized_tree_header_t ) ) / sizeof( cdata_serialized_tree_node_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of nodes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_view = memory_allocate_structure(
+	                      libcdata_internal_tree_view_t );
+
+	if( internal_tree_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tree view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_view->data            = data;
+	internal_tree_view->data_size       = (size_t) serialized_data_size;
+	internal_tree_view->number_of_nodes = (int) number_of_nodes;
+
+	*tree_view = (libcdata_tree_view_t *) internal_tree_view;
+
+	return( 1 );
+}
+
+/* Frees a tree view
+ * The referenced data is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_view_free(
+     libcdata_tree_view_t **tree_view,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_view_t *internal_tree_view = NULL;
+	static char *function                             = "libcdata_tree_view_free";
+
+	if( tree_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tree_view != NULL )
+	{
+		internal_tree_view = (libcdata_internal_tree_view_t *) *tree_view;
+		*tree_view         = NULL;
+
+		memory_free(
+		 internal_tree_view );
+	}
+	return( 1 );
+}
+
+/* Reads a node entry of the serialized tree
+ * The offsets are checked to be within the data and the parent node offset
+ * to be before and the next node offset to be after the node offset, hence
+ * following the offsets cannot loop
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_internal_tree_view_read_node(
+     libcdata_internal_tree_view_t *internal_tree_view,
+     size_t node_offset,
+     size_t *parent_node_offset,
+     size_t *next_node_offset,
+     int *number_of_sub_nodes,
+     uint32_t *flags,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	cdata_serialized_tree_node_t *serialized_node = NULL;
+	static char *function                         = "libcdata_internal_tree_view_read_node";
+	uint64_t safe_next_node_offset                = 0;
+	uint64_t safe_parent_node_offset              = 0;
+	uint64_t safe_value_data_size                 = 0;
+	uint32_t safe_number_of_sub_nodes             = 0;
+
+	if( internal_tree_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_offset < sizeof( cdata_serialized_tree_header_t ) )
+	 || ( node_offset > ( internal_tree_view->data_size - sizeof( cdata_serialized_tree_node_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_node_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent node offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_node_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next node offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	serialized_node = (cdata_serialized_tree_node_t *) &( internal_tree_view->data[ node_offset ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 serialized_node->parent_node_offset,
+	 safe_parent_node_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 serialized_node->next_node_offset,
+	 safe_next_node_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 serialized_node->number_of_sub_nodes,
+	 safe_number_of_sub_nodes );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 serialized_node->flags,
+	 *flags );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 serialized_node->value_data_size,
+	 safe_value_data_size );
+
+	if( ( safe_parent_node_offset != 0 )
+	 && ( ( safe_parent_node_offset < sizeof( cdata_serialized_tree_header_t ) )
+	  || ( safe_parent_node_offset >= (uint64_t) node_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parent node offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( safe_next_node_offset != 0 )
+	 && ( ( safe_next_node_offset <= (uint64_t) node_offset )
+	  || ( safe_next_node_offset > (uint64_t) ( internal_tree_view->data_size - sizeof( cdata_serialized_tree_node_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid next node offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_number_of_sub_nodes > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sub nodes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_value_data_size > (uint64_t) ( internal_tree_view->data_size - node_offset - sizeof( cdata_serialized_tree_node_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*parent_node_offset  = (size_t) safe_parent_node_offset;
+	*next_node_offset    = (size_t) safe_next_node_offset;
+	*number_of_sub_nodes = (int) safe_number_of_sub_nodes;
+	*value_data_size     = (size_t) safe_value_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_view_get_number_of_nodes(
+     libcdata_tree_view_t *tree_view,
+     int *number_of_nodes,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_view_t *internal_tree_view = NULL;
+	static char *function                             = "libcdata_tree_view_get_number_of_nodes";
+
+	if( tree_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_view = (libcdata_internal_tree_view_t *) tree_view;
+
+	if( number_of_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nodes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_nodes = internal_tree_view->number_of_nodes;
+
+	return( 1 );
+}
+
+/* Retrieves the offset of the root node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_view_get_root_node_offset(
+     libcdata_tree_view_t *tree_view,
+     size_t *node_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdata_tree_view_get_root_node_offset";
+
+	if( tree_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree view.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node offset.",
+		 function );
+
+		return( -1 );
+	}
+	*node_offset = sizeof( cdata_serialized_tree_header_t );
+
+	return( 1 );
+}
+
+/* Retrieves the offset of the parent node of a specific node
+ * Returns 1 if successful, 0 if the node has no parent node or -1 on error
+ */
+int libcdata_tree_view_get_parent_node_offset(
+     libcdata_tree_view_t *tree_view,
+     size_t node_offset,
+     size_t *parent_node_offset,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_view_t *internal_tree_view = NULL;
+	static char *function                             = "libcdata_tree_view_get_parent_node_offset";
+	size_t safe_next_node_offset                      = 0;
+	size_t safe_parent_node_offset                    = 0;
+	size_t safe_value_data_size                       = 0;
+	uint32_t flags                                    = 0;
+	int safe_number_of_sub_nodes                      = 0;
+
+	if( tree_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_view = (libcdata_internal_tree_view_t *) tree_view;
+
+	if( parent_node_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent node offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_internal_tree_view_read_node(
+	     internal_tree_view,
+	     node_offset,
+	     &safe_parent_node_offset,
+	     &safe_next_node_offset,
+	     &safe_number_of_sub_nodes,
+	     &flags,
+	     &safe_value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read node at offset: %" PRIzu ".",
+		 function,
+		 node_offset );
+
+		return( -1 );
+	}
+	if( safe_parent_node_offset == 0 )
+	{
+		return( 0 );
+	}
+	*parent_node_offset = safe_parent_node_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the offset of the next node of a specific node
+ * Returns 1 if successful, 0 if the node has no next node or -1 on error
+ */
+int libcdata_tree_view_get_next_node_offset(
+     libcdata_tree_view_t *tree_view,
+     size_t node_offset,
+     size_t *next_node_offset,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_view_t *internal_tree_view = NULL;
+	static char *function                             = "libcdata_tree_view_get_next_node_offset";
+	size_t safe_next_node_offset                      = 0;
+	size_t safe_parent_node_offset                    = 0;
+	size_t safe_value_data_size                       = 0;
+	uint32_t flags                                    = 0;
+	int safe_number_of_sub_nodes                      = 0;
+
+	if( tree_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_view = (libcdata_internal_tree_view_t *) tree_view;
+
+	if( next_node_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next node offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_internal_tree_view_read_node(
+	     internal_tree_view,
+	     node_offset,
+	     &safe_parent_node_offset,
+	     &safe_next_node_offset,
+	     &safe_number_of_sub_nodes,
+	     &flags,
+	     &safe_value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read node at offset: %" PRIzu ".",
+		 function,
+		 node_offset );
+
+		return( -1 );
+	}
+	if( safe_next_node_offset == 0 )
+	{
+		return( 0 );
+	}
+	*next_node_offset = safe_next_node_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the offset of the first sub node of a specific node
+ * The first sub node directly follows the value data of the node
+ * Returns 1 if successful, 0 if the node has no sub nodes or -1 on error
+ */
+int libcdata_tree_view_get_first_sub_node_offset(
+     libcdata_tree_view_t *tree_view,
+     size_t node_offset,
+     size_t *sub_node_offset,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_view_t *internal_tree_view = NULL;
+	static char *function                             = "libcdata_tree_view_get_first_sub_node_offset";
+	size_t safe_next_node_offset                      = 0;
+	size_t safe_parent_node_offset                    = 0;
+	size_t safe_sub_node_offset                       = 0;
+	size_t safe_value_data_size                       = 0;
+	uint32_t flags                                    = 0;
+	int safe_number_of_sub_nodes                      = 0;
+
+	if( tree_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_view = (libcdata_internal_tree_view_t *) tree_view;
+
+	if( sub_node_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_internal_tree_view_read_node(
+	     internal_tree_view,
+	     node_offset,
+	     &safe_parent_node_offset,
+	     &safe_next_node_offset,
+	     &safe_number_of_sub_nodes,
+	     &flags,
+	     &safe_value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read node at offset: %" PRIzu ".",
+		 function,
+		 node_offset );
+
+		return( -1 );
+	}
+	if( safe_number_of_sub_nodes == 0 )
+	{
+		return( 0 );
+	}
+	safe_sub_node_offset = node_offset + sizeof( cdata_serialized_tree_node_t ) + safe_value_data_size;
+
+	if( safe_sub_node_offset > ( internal_tree_view->data_size - sizeof( cdata_serialized_tree_node_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub node offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*sub_node_offset = safe_sub_node_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the number of sub nodes of a specific node
+ * Returns 1 if successful or -1 on error
+ */
+int libcdata_tree_view_get_number_of_sub_nodes(
+     libcdata_tree_view_t *tree_view,
+     size_t node_offset,
+     int *number_of_sub_nodes,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_view_t *internal_tree_view = NULL;
+	static char *function                             = "libcdata_tree_view_get_number_of_sub_nodes";
+	size_t safe_next_node_offset                      = 0;
+	size_t safe_parent_node_offset                    = 0;
+	size_t safe_value_data_size                       = 0;
+	uint32_t flags                                    = 0;
+
+	if( tree_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_view = (libcdata_internal_tree_view_t *) tree_view;
+
+	if( number_of_sub_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_internal_tree_view_read_node(
+	     internal_tree_view,
+	     node_offset,
+	     &safe_parent_node_offset,
+	     &safe_next_node_offset,
+	     number_of_sub_nodes,
+	     &flags,
+	     &safe_value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read node at offset: %" PRIzu ".",
+		 function,
+		 node_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value data of a specific node
+ * The value data references the serialized tree data and is not copied
+ * Returns 1 if successful, 0 if the node has no value or -1 on error
+ */
+int libcdata_tree_view_get_value_data(
+     libcdata_tree_view_t *tree_view,
+     size_t node_offset,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libcdata_internal_tree_view_t *internal_tree_view = NULL;
+	static char *function                             = "libcdata_tree_view_get_value_data";
+	size_t safe_next_node_offset                      = 0;
+	size_t safe_parent_node_offset                    = 0;
+	size_t safe_value_data_size                       = 0;
+	uint32_t flags                                    = 0;
+	int safe_number_of_sub_nodes                      = 0;
+
+	if( tree_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_tree_view = (libcdata_internal_tree_view_t *) tree_view;
+
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_internal_tree_view_read_node(
+	     internal_tree_view,
+	     node_offset,
+	     &safe_parent_node_offset,
+	     &safe_next_node_offset,
+	     &safe_number_of_sub_nodes,
+	     &flags,
+	     &safe_value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read node at offset: %" PRIzu ".",
+		 function,
+		 node_offset );
+
+		return( -1 );
+	}
+	if( ( flags & LIBCDATA_SERIALIZED_TREE_NODE_FLAG_HAS_VALUE ) == 0 )
+	{
+		*value_data      = NULL;
+		*value_data_size = 0;
+
+		return( 0 );
+	}
+	*value_data      = &( internal_tree_view->data[ node_offset + sizeof( cdata_serialized_tree_node_t ) ] );
+	*value_data_size = safe_value_data_size;
+
+	return( 1 );
+}
+
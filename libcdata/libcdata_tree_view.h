@@ -0,0 +1,132 @@
+/*
+ * Tree view functions
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBCDATA_TREE_VIEW_H )
+#define _LIBCDATA_TREE_VIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdata_extern.h"
+#include "libcdata_libcerror.h"
+#include "libcdata_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint8_t cdata_serialized_tree_signature[ 8 ];
+
+typedef struct libcdata_internal_tree_view libcdata_internal_tree_view_t;
+
+struct libcdata_internal_tree_view
+{
+	/* The serialized tree data
+	 * The data is referenced and not copied
+	 */
+	const uint8_t *data;
+
+	/* The serialized tree data size
+	 */
+	size_t data_size;
+
+	/* The number of nodes
+	 */
+	int number_of_nodes;
+};
+
+LIBCDATA_EXTERN \
+int libcdata_tree_view_initialize(
+     libcdata_tree_view_t **tree_view,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_view_free(
+     libcdata_tree_view_t **tree_view,
+     libcerror_error_t **error );
+
+int libcdata_internal_tree_view_read_node(
+     libcdata_internal_tree_view_t *internal_tree_view,
+     size_t node_offset,
+     size_t *parent_node_offset,
+     size_t *next_node_offset,
+     int *number_of_sub_nodes,
+     uint32_t *flags,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_view_get_number_of_nodes(
+     libcdata_tree_view_t *tree_view,
+     int *number_of_nodes,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_view_get_root_node_offset(
+     libcdata_tree_view_t *tree_view,
+     size_t *node_offset,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_view_get_parent_node_offset(
+     libcdata_tree_view_t *tree_view,
+     size_t node_offset,
+     size_t *parent_node_offset,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_view_get_next_node_offset(
+     libcdata_tree_view_t *tree_view,
+     size_t node_offset,
+     size_t *next_node_offset,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_view_get_first_sub_node_offset(
+     libcdata_tree_view_t *tree_view,
+     size_t node_offset,
+     size_t *sub_node_offset,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_view_get_number_of_sub_nodes(
+     libcdata_tree_view_t *tree_view,
+     size_t node_offset,
+     int *number_of_sub_nodes,
+     libcerror_error_t **error );
+
+LIBCDATA_EXTERN \
+int libcdata_tree_view_get_value_data(
+     libcdata_tree_view_t *tree_view,
+     size_t node_offset,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATA_TREE_VIEW_H ) */
+
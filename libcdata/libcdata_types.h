@@ -36,18 +36,22 @@
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libcdata_array {}	libcdata_array_t;
 typedef struct libcdata_btree {}	libcdata_btree_t;
+typedef struct libcdata_btree_cursor {}	libcdata_btree_cursor_t;
 typedef struct libcdata_list {}		libcdata_list_t;
 typedef struct libcdata_list_element {}	libcdata_list_element_t;
 typedef struct libcdata_range_list {}	libcdata_range_list_t;
 typedef struct libcdata_tree_node {}	libcdata_tree_node_t;
+typedef struct libcdata_tree_view {}	libcdata_tree_view_t;
 
 #else
 typedef intptr_t libcdata_array_t;
 typedef intptr_t libcdata_btree_t;
+typedef intptr_t libcdata_btree_cursor_t;
 typedef intptr_t libcdata_list_t;
 typedef intptr_t libcdata_list_element_t;
 typedef intptr_t libcdata_range_list_t;
 typedef intptr_t libcdata_tree_node_t;
+typedef intptr_t libcdata_tree_view_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
@@ -0,0 +1,1083 @@
+/*
+ * Library Bloom filter type test program
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdata_test_libcdata.h"
+#include "cdata_test_libcerror.h"
+#include "cdata_test_macros.h"
+#include "cdata_test_memory.h"
+#include "cdata_test_unused.h"
+
+#include "../libcdata/libcdata_bloom_filter.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+/* Tests the libcdata_bloom_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_bloom_filter_initialize(
+     void )
+{
+	libcdata_bloom_filter_t *bloom_filter = NULL;
+	libcerror_error_t *error              = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_CDATA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdata_bloom_filter_initialize(
+	          &bloom_filter,
+	          100,
+	          100,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A false positive rate of 1 in 100 requires 10 bits per value and 7 hashes
+	 */
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "bloom_filter->number_of_bits",
+	 (int) bloom_filter->number_of_bits,
+	 1000 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "bloom_filter->bits_size",
+	 (int) bloom_filter->bits_size,
+	 125 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "bloom_filter->number_of_hashes",
+	 bloom_filter->number_of_hashes,
+	 7 );
+
+	result = libcdata_bloom_filter_free(
+	          &bloom_filter,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The number of bits is at least 64
+	 */
+	result = libcdata_bloom_filter_initialize(
+	          &bloom_filter,
+	          1,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "bloom_filter->number_of_bits",
+	 (int) bloom_filter->number_of_bits,
+	 64 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "bloom_filter->number_of_hashes",
+	 bloom_filter->number_of_hashes,
+	 1 );
+
+	result = libcdata_bloom_filter_free(
+	          &bloom_filter,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_bloom_filter_initialize(
+	          NULL,
+	          100,
+	          100,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bloom_filter = (libcdata_bloom_filter_t *) 0x12345678UL;
+
+	result = libcdata_bloom_filter_initialize(
+	          &bloom_filter,
+	          100,
+	          100,
+	          &error );
+
+	bloom_filter = NULL;
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_bloom_filter_initialize(
+	          &bloom_filter,
+	          0,
+	          100,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_bloom_filter_initialize(
+	          &bloom_filter,
+	          100,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdata_bloom_filter_initialize with malloc failing
+		 */
+		cdata_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdata_bloom_filter_initialize(
+		          &bloom_filter,
+		          100,
+		          100,
+		          &error );
+
+		if( cdata_test_malloc_attempts_before_fail != -1 )
+		{
+			cdata_test_malloc_attempts_before_fail = -1;
+
+			if( bloom_filter != NULL )
+			{
+				libcdata_bloom_filter_free(
+				 &bloom_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "bloom_filter",
+			 bloom_filter );
+
+			CDATA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdata_bloom_filter_initialize with memset failing
+		 */
+		cdata_test_memset_attempts_before_fail = test_number;
+
+		result = libcdata_bloom_filter_initialize(
+		          &bloom_filter,
+		          100,
+		          100,
+		          &error );
+
+		if( cdata_test_memset_attempts_before_fail != -1 )
+		{
+			cdata_test_memset_attempts_before_fail = -1;
+
+			if( bloom_filter != NULL )
+			{
+				libcdata_bloom_filter_free(
+				 &bloom_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "bloom_filter",
+			 bloom_filter );
+
+			CDATA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bloom_filter != NULL )
+	{
+		libcdata_bloom_filter_free(
+		 &bloom_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_bloom_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_bloom_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdata_bloom_filter_free(
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_bloom_filter_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_bloom_filter_clone(
+     void )
+{
+	libcdata_bloom_filter_t *destination_bloom_filter = NULL;
+	libcdata_bloom_filter_t *source_bloom_filter      = NULL;
+	libcerror_error_t *error                          = NULL;
+	int result                                        = 0;
+
+#if defined( HAVE_CDATA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcdata_bloom_filter_initialize(
+	          &source_bloom_filter,
+	          100,
+	          100,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_bloom_filter_add_hash(
+	          source_bloom_filter,
+	          0x1234,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_bloom_filter_clone(
+	          &destination_bloom_filter,
+	          source_bloom_filter,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_bloom_filter",
+	 destination_bloom_filter );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "destination_bloom_filter->number_of_bits",
+	 (int) destination_bloom_filter->number_of_bits,
+	 (int) source_bloom_filter->number_of_bits );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "destination_bloom_filter->number_of_hashes",
+	 destination_bloom_filter->number_of_hashes,
+	 source_bloom_filter->number_of_hashes );
+
+	result = libcdata_bloom_filter_contains_hash(
+	          destination_bloom_filter,
+	          0x1234,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_bloom_filter_free(
+	          &destination_bloom_filter,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_bloom_filter_clone(
+	          &destination_bloom_filter,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "destination_bloom_filter",
+	 destination_bloom_filter );
+
+	/* Test error cases
+	 */
+	result = libcdata_bloom_filter_clone(
+	          NULL,
+	          source_bloom_filter,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_bloom_filter = (libcdata_bloom_filter_t *) 0x12345678UL;
+
+	result = libcdata_bloom_filter_clone(
+	          &destination_bloom_filter,
+	          source_bloom_filter,
+	          &error );
+
+	destination_bloom_filter = NULL;
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdata_bloom_filter_clone with malloc failing
+		 */
+		cdata_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdata_bloom_filter_clone(
+		          &destination_bloom_filter,
+		          source_bloom_filter,
+		          &error );
+
+		if( cdata_test_malloc_attempts_before_fail != -1 )
+		{
+			cdata_test_malloc_attempts_before_fail = -1;
+
+			if( destination_bloom_filter != NULL )
+			{
+				libcdata_bloom_filter_free(
+				 &destination_bloom_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "destination_bloom_filter",
+			 destination_bloom_filter );
+
+			CDATA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATA_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libcdata_bloom_filter_free(
+	          &source_bloom_filter,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_bloom_filter != NULL )
+	{
+		libcdata_bloom_filter_free(
+		 &destination_bloom_filter,
+		 NULL );
+	}
+	if( source_bloom_filter != NULL )
+	{
+		libcdata_bloom_filter_free(
+		 &source_bloom_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_bloom_filter_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_bloom_filter_empty(
+     void )
+{
+	libcdata_bloom_filter_t *bloom_filter = NULL;
+	libcerror_error_t *error              = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_bloom_filter_initialize(
+	          &bloom_filter,
+	          100,
+	          100,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_bloom_filter_add_hash(
+	          bloom_filter,
+	          0x1234,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_bloom_filter_empty(
+	          bloom_filter,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_bloom_filter_contains_hash(
+	          bloom_filter,
+	          0x1234,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_bloom_filter_empty(
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_bloom_filter_free(
+	          &bloom_filter,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bloom_filter != NULL )
+	{
+		libcdata_bloom_filter_free(
+		 &bloom_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_bloom_filter_add_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_bloom_filter_add_hash(
+     void )
+{
+	libcdata_bloom_filter_t *bloom_filter = NULL;
+	libcerror_error_t *error              = NULL;
+	uint64_t hash                         = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_bloom_filter_initialize(
+	          &bloom_filter,
+	          100,
+	          100,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( hash = 0;
+	     hash < 100;
+	     hash++ )
+	{
+		result = libcdata_bloom_filter_add_hash(
+		          bloom_filter,
+		          hash,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* A Bloom filter has no false negatives
+	 */
+	for( hash = 0;
+	     hash < 100;
+	     hash++ )
+	{
+		result = libcdata_bloom_filter_contains_hash(
+		          bloom_filter,
+		          hash,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcdata_bloom_filter_add_hash(
+	          NULL,
+	          0x1234,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_bloom_filter_free(
+	          &bloom_filter,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bloom_filter != NULL )
+	{
+		libcdata_bloom_filter_free(
+		 &bloom_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_bloom_filter_contains_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_bloom_filter_contains_hash(
+     void )
+{
+	libcdata_bloom_filter_t *bloom_filter = NULL;
+	libcerror_error_t *error              = NULL;
+	uint64_t hash                         = 0;
+	int number_of_false_positives         = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_bloom_filter_initialize(
+	          &bloom_filter,
+	          100,
+	          100,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_bloom_filter_contains_hash(
+	          bloom_filter,
+	          0x1234,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_bloom_filter_add_hash(
+	          bloom_filter,
+	          0x1234,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_bloom_filter_contains_hash(
+	          bloom_filter,
+	          0x1234,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* With a false positive rate of 1 in 100 most hashes that were not added are not contained
+	 */
+	for( hash = 0;
+	     hash < 100;
+	     hash++ )
+	{
+		result = libcdata_bloom_filter_add_hash(
+		          bloom_filter,
+		          hash,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( hash = 100;
+	     hash < 10100;
+	     hash++ )
+	{
+		result = libcdata_bloom_filter_contains_hash(
+		          bloom_filter,
+		          hash,
+		          &error );
+
+		CDATA_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		if( result != 0 )
+		{
+			number_of_false_positives++;
+		}
+	}
+	/* The expected number of false positives is 100 hence allow for some variance
+	 */
+	CDATA_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_false_positives",
+	 number_of_false_positives,
+	 200 );
+
+	/* Test error cases
+	 */
+	result = libcdata_bloom_filter_contains_hash(
+	          NULL,
+	          0x1234,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_bloom_filter_free(
+	          &bloom_filter,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bloom_filter != NULL )
+	{
+		libcdata_bloom_filter_free(
+		 &bloom_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATA_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+	CDATA_TEST_RUN(
+	 "libcdata_bloom_filter_initialize",
+	 cdata_test_bloom_filter_initialize );
+
+	CDATA_TEST_RUN(
+	 "libcdata_bloom_filter_free",
+	 cdata_test_bloom_filter_free );
+
+	CDATA_TEST_RUN(
+	 "libcdata_bloom_filter_clone",
+	 cdata_test_bloom_filter_clone );
+
+	CDATA_TEST_RUN(
+	 "libcdata_bloom_filter_empty",
+	 cdata_test_bloom_filter_empty );
+
+	CDATA_TEST_RUN(
+	 "libcdata_bloom_filter_add_hash",
+	 cdata_test_bloom_filter_add_hash );
+
+	CDATA_TEST_RUN(
+	 "libcdata_bloom_filter_contains_hash",
+	 cdata_test_bloom_filter_contains_hash );
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+}
+
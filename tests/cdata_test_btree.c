@@ -21,19 +21,50 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
 #include "cdata_test_libcdata.h"
 #include "cdata_test_libcerror.h"
 #include "cdata_test_macros.h"
 #include "cdata_test_memory.h"
+#include "cdata_test_rwlock.h"
 #include "cdata_test_unused.h"
 
 #include "../libcdata/libcdata_btree.h"
+#include "../libcdata/libcdata_btree_node.h"
+
+#define CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES	16
+#define CDATA_TEST_BTREE_NUMBER_OF_VALUES		100000
+
+#define CDATA_TEST_BTREE_NUMBER_OF_READER_LOOKUPS	10000
+#define CDATA_TEST_BTREE_NUMBER_OF_READER_THREADS	4
+#define CDATA_TEST_BTREE_NUMBER_OF_READER_VALUES	256
+
+#if defined( LIBCDATA_HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+
+typedef struct cdata_test_btree_reader cdata_test_btree_reader_t;
+
+struct cdata_test_btree_reader
+{
+	/* The tree
+	 */
+	libcdata_btree_t *btree;
+
+	/* The first value that is looked up
+	 */
+	int first_value;
+};
+
+#endif /* defined( LIBCDATA_HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI ) */
 
 /* Test value free function
  * Returns 1 if successful or -1 on error
@@ -48,6 +79,93 @@ int cdata_test_btree_value_free_function(
 	return( 1 );
 }
 
+/* Test cloned value free function
+ * Returns 1 if successful or -1 on error
+ */
+int cdata_test_btree_cloned_value_free_function(
+     int **value,
+     libcerror_error_t **error )
+{
+	static char *function = "cdata_test_btree_cloned_value_free_function";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		memory_free(
+		 *value );
+
+		*value = NULL;
+	}
+	return( 1 );
+}
+
+/* Test value clone function
+ * Returns 1 if successful or -1 on error
+ */
+int cdata_test_btree_value_clone_function(
+     int **destination_value,
+     int *source_value,
+     libcerror_error_t **error )
+{
+	static char *function = "cdata_test_btree_value_clone_function";
+
+	if( destination_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination value value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_value == NULL )
+	{
+		*destination_value = NULL;
+	}
+	else
+	{
+		*destination_value = (int *) memory_allocate(
+		                              sizeof( int ) );
+
+		if( *destination_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination value.",
+			 function );
+
+			return( -1 );
+		}
+		**destination_value = *source_value;
+	}
+	return( 1 );
+}
+
 /* Test value compare function
  * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
  */
@@ -91,6 +209,43 @@ int cdata_test_btree_value_compare_function(
 	return( LIBCDATA_COMPARE_EQUAL );
 }
 
+/* Test value hash function
+ * Returns 1 if successful or -1 on error
+ */
+int cdata_test_btree_value_hash_function(
+     int *value,
+     uint64_t *hash,
+     libcdata_error_t **error )
+{
+	static char *function = "cdata_test_btree_value_hash_function";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	*hash = (uint64_t) *value;
+
+	return( 1 );
+}
+
 /* Tests the libcdata_btree_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -206,6 +361,27 @@ int cdata_test_btree_initialize(
 	libcerror_error_free(
 	 &error );
 
+	result = libcdata_btree_initialize(
+	          &btree,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 #if defined( HAVE_CDATA_TEST_MEMORY )
 
 	/* 1 fail in memory_allocate_structure
@@ -365,22 +541,36 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcdata_btree_get_number_of_values function
+/* Tests the libcdata_btree_clone function
  * Returns 1 if successful or 0 if not
  */
-int cdata_test_btree_get_number_of_values(
+int cdata_test_btree_clone(
      void )
 {
-	libcdata_btree_t *btree  = NULL;
-	libcerror_error_t *error = NULL;
-	int number_of_values     = 0;
-	int result               = 0;
+	intptr_t *value_pointers[ 64 ];
+	int value_indexes[ 64 ];
+	int values[ 64 ];
+
+	libcdata_btree_t *destination_btree = NULL;
+	libcdata_btree_t *source_btree      = NULL;
+	libcdata_tree_node_t *upper_node    = NULL;
+	libcerror_error_t *error            = NULL;
+	intptr_t *cloned_value              = NULL;
+	intptr_t *existing_value            = NULL;
+	int height                          = 0;
+	int number_of_leaf_nodes            = 0;
+	int number_of_nodes                 = 0;
+	int number_of_values                = 0;
+	int result                          = 0;
+	int source_height                   = 0;
+	int source_number_of_nodes          = 0;
+	int value_index                     = 0;
 
 	/* Initialize test
 	 */
 	result = libcdata_btree_initialize(
-	          &btree,
-	          100,
+	          &source_btree,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -388,19 +578,27 @@ int cdata_test_btree_get_number_of_values(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "btree",
-	 btree );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libcdata_btree_get_number_of_values(
-	          btree,
-	          &number_of_values,
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "source_btree",
+	 source_btree );
+
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		values[ value_index ]         = ( value_index * 37 ) % 64;
+		value_pointers[ value_index ] = (intptr_t *) &( values[ value_index ] );
+	}
+	result = libcdata_btree_insert_values(
+	          source_btree,
+	          value_pointers,
+	          64,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          value_indexes,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -412,47 +610,48 @@ int cdata_test_btree_get_number_of_values(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Remove a value so that the values array contains a free entry
 	 */
-	result = libcdata_btree_get_number_of_values(
-	          NULL,
-	          &number_of_values,
+	result = libcdata_btree_get_value_by_value(
+	          source_btree,
+	          value_pointers[ 7 ],
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcdata_btree_get_number_of_values(
-	          btree,
-	          NULL,
+	result = libcdata_btree_remove_value(
+	          source_btree,
+	          upper_node,
+	          &( value_indexes[ 7 ] ),
+	          existing_value,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
+	/* Test regular cases
 	 */
-	result = libcdata_btree_free(
-	          &btree,
-	          &cdata_test_btree_value_free_function,
+	result = libcdata_btree_clone(
+	          &destination_btree,
+	          source_btree,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &cdata_test_btree_cloned_value_free_function,
+	          (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_clone_function,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -460,52 +659,17 @@ int cdata_test_btree_get_number_of_values(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "btree",
-	 btree );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( btree != NULL )
-	{
-		libcdata_btree_free(
-		 &btree,
-		 &cdata_test_btree_value_free_function,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libcdata_btree_get_value_by_index function
- * Returns 1 if successful or 0 if not
- */
-int cdata_test_btree_get_value_by_index(
-     void )
-{
-	libcdata_btree_t *btree          = NULL;
-	libcdata_tree_node_t *upper_node = NULL;
-	libcerror_error_t *error         = NULL;
-	intptr_t *existing_value         = NULL;
-	intptr_t *test_value             = NULL;
-	int result                       = 0;
-	int value1                       = 1;
-	int value_index                  = 0;
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_btree",
+	 destination_btree );
 
-	/* Initialize test
-	 */
-	result = libcdata_btree_initialize(
-	          &btree,
-	          100,
+	result = libcdata_btree_get_number_of_values(
+	          destination_btree,
+	          &number_of_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -513,21 +677,20 @@ int cdata_test_btree_get_value_by_index(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "btree",
-	 btree );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_btree_insert_value(
-	          btree,
-	          &value_index,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &existing_value,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 64 );
+
+	result = libcdata_btree_get_statistics(
+	          source_btree,
+	          &source_height,
+	          &source_number_of_nodes,
+	          &number_of_leaf_nodes,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -539,12 +702,11 @@ int cdata_test_btree_get_value_by_index(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libcdata_btree_get_value_by_index(
-	          btree,
-	          0,
-	          &test_value,
+	result = libcdata_btree_get_statistics(
+	          destination_btree,
+	          &height,
+	          &number_of_nodes,
+	          &number_of_leaf_nodes,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -552,54 +714,4124 @@ int cdata_test_btree_get_value_by_index(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "test_value",
-	 test_value );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "height",
+	 height,
+	 source_height );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_nodes",
+	 number_of_nodes,
+	 source_number_of_nodes );
+
+	/* The cloned values retain their value index and order
 	 */
-	test_value = NULL;
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		if( value_index == 7 )
+		{
+			continue;
+		}
+		result = libcdata_btree_get_value_by_index(
+		          destination_btree,
+		          value_indexes[ value_index ],
+		          &existing_value,
+		          &error );
 
-	result = libcdata_btree_get_value_by_index(
-	          NULL,
-	          0,
-	          &test_value,
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "existing_value",
+		 existing_value );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "*existing_value",
+		 *( (int *) existing_value ),
+		 values[ value_index ] );
+
+		CDATA_TEST_ASSERT_NOT_EQUAL_INTPTR(
+		 "existing_value",
+		 (intptr_t) existing_value,
+		 (intptr_t) &( values[ value_index ] ) );
+
+		result = libcdata_btree_get_value_by_value(
+		          destination_btree,
+		          value_pointers[ value_index ],
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &upper_node,
+		          &cloned_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INTPTR(
+		 "cloned_value",
+		 (intptr_t) cloned_value,
+		 (intptr_t) existing_value );
+	}
+	result = libcdata_btree_get_value_by_rank(
+	          destination_btree,
+	          7,
+	          &existing_value,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
-	 "test_value",
-	 test_value );
-
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "*existing_value",
+	 *( (int *) existing_value ),
+	 8 );
+
+	/* The clone does not share nodes with the source tree
+	 */
+	result = libcdata_btree_get_value_by_value(
+	          destination_btree,
+	          value_pointers[ 0 ],
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_remove_value(
+	          destination_btree,
+	          upper_node,
+	          &( value_indexes[ 0 ] ),
+	          existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 existing_value );
+
+	result = libcdata_btree_get_value_by_value(
+	          source_btree,
+	          value_pointers[ 0 ],
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "existing_value",
+	 (intptr_t) existing_value,
+	 (intptr_t) &( values[ 0 ] ) );
+
+	result = libcdata_btree_free(
+	          &destination_btree,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &cdata_test_btree_cloned_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "destination_btree",
+	 destination_btree );
+
+	result = libcdata_btree_clone(
+	          &destination_btree,
+	          NULL,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &cdata_test_btree_cloned_value_free_function,
+	          (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_clone_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "destination_btree",
+	 destination_btree );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_clone(
+	          NULL,
+	          source_btree,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &cdata_test_btree_cloned_value_free_function,
+	          (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_clone_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_btree = (libcdata_btree_t *) 0x12345678UL;
+
+	result = libcdata_btree_clone(
+	          &destination_btree,
+	          source_btree,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &cdata_test_btree_cloned_value_free_function,
+	          (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_clone_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_btree = NULL;
+
+	result = libcdata_btree_clone(
+	          &destination_btree,
+	          source_btree,
+	          NULL,
+	          (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_clone_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_clone(
+	          &destination_btree,
+	          source_btree,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &cdata_test_btree_cloned_value_free_function,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &source_btree,
+	          &cdata_test_btree_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "source_btree",
+	 source_btree );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_btree != NULL )
+	{
+		libcdata_btree_free(
+		 &destination_btree,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &cdata_test_btree_cloned_value_free_function,
+		 NULL );
+	}
+	if( source_btree != NULL )
+	{
+		libcdata_btree_free(
+		 &source_btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_get_number_of_values function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_get_number_of_values(
+     void )
+{
+	libcdata_btree_t *btree  = NULL;
+	libcerror_error_t *error = NULL;
+	int number_of_values     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_initialize(
+	          &btree,
+	          100,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_get_number_of_values(
+	          btree,
+	          &number_of_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_get_number_of_values(
+	          NULL,
+	          &number_of_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_number_of_values(
+	          btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATA_TEST_RWLOCK )
+
+	/* Test libcdata_btree_get_number_of_values with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	cdata_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libcdata_btree_get_number_of_values(
+	          btree,
+	          &number_of_values,
+	          &error );
+
+	if( cdata_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		cdata_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcdata_btree_get_number_of_values with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	cdata_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libcdata_btree_get_number_of_values(
+	          btree,
+	          &number_of_values,
+	          &error );
+
+	if( cdata_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		cdata_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+
+#endif /* defined( HAVE_CDATA_TEST_RWLOCK ) */
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          &cdata_test_btree_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_get_statistics(
+     void )
+{
+	libcdata_btree_t *btree          = NULL;
+	libcdata_tree_node_t *upper_node = NULL;
+	libcerror_error_t *error         = NULL;
+	intptr_t *existing_value         = NULL;
+	int values[ 5 ]                  = { 1, 2, 3, 4, 5 };
+	int height                       = 0;
+	int insert_value_index           = 0;
+	int number_of_leaf_nodes         = 0;
+	int number_of_nodes              = 0;
+	int result                       = 0;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_initialize(
+	          &btree,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_get_statistics(
+	          btree,
+	          &height,
+	          &number_of_nodes,
+	          &number_of_leaf_nodes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "height",
+	 height,
+	 0 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_nodes",
+	 number_of_nodes,
+	 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_nodes",
+	 number_of_leaf_nodes,
+	 1 );
+
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		result = libcdata_btree_insert_value(
+		          btree,
+		          &insert_value_index,
+		          (intptr_t *) &( values[ value_index ] ),
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcdata_btree_get_statistics(
+	          btree,
+	          &height,
+	          &number_of_nodes,
+	          &number_of_leaf_nodes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "height",
+	 height,
+	 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_nodes",
+	 number_of_nodes,
+	 3 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_nodes",
+	 number_of_leaf_nodes,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_get_statistics(
+	          NULL,
+	          &height,
+	          &number_of_nodes,
+	          &number_of_leaf_nodes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_statistics(
+	          btree,
+	          NULL,
+	          &number_of_nodes,
+	          &number_of_leaf_nodes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_statistics(
+	          btree,
+	          &height,
+	          NULL,
+	          &number_of_leaf_nodes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_statistics(
+	          btree,
+	          &height,
+	          &number_of_nodes,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          &cdata_test_btree_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_get_value_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_get_value_by_index(
+     void )
+{
+	libcdata_btree_t *btree          = NULL;
+	libcdata_tree_node_t *upper_node = NULL;
+	libcerror_error_t *error         = NULL;
+	intptr_t *existing_value         = NULL;
+	intptr_t *test_value             = NULL;
+	int result                       = 0;
+	int value1                       = 1;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_initialize(
+	          &btree,
+	          100,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_get_value_by_index(
+	          btree,
+	          0,
+	          &test_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "test_value",
+	 test_value );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	test_value = NULL;
+
+	result = libcdata_btree_get_value_by_index(
+	          NULL,
+	          0,
+	          &test_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "test_value",
+	 test_value );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_value_by_index(
+	          btree,
+	          -1,
+	          &test_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "test_value",
+	 test_value );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_value_by_index(
+	          btree,
+	          0,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "test_value",
+	 test_value );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          &cdata_test_btree_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+/* Tests the libcdata_internal_btree_get_upper_node_by_value function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_get_upper_node_by_value(
+     void )
+{
+	int values[ 32 ];
+
+	libcdata_btree_t *btree               = NULL;
+	libcdata_tree_node_t *last_upper_node = NULL;
+	libcdata_tree_node_t *upper_node      = NULL;
+	libcerror_error_t *error              = NULL;
+	intptr_t *existing_value              = NULL;
+	int result                            = 0;
+	int test_value                        = 0;
+	int upper_value_index                 = 0;
+	int value_index                       = 0;
+	int values_array_index                = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_initialize(
+	          &btree,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 32;
+	     value_index++ )
+	{
+		values[ value_index ] = value_index * 2;
+
+		result = libcdata_btree_insert_value(
+		          btree,
+		          &values_array_index,
+		          (intptr_t *) &( values[ value_index ] ),
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 32;
+	     value_index++ )
+	{
+		result = libcdata_internal_btree_get_upper_node_by_value(
+		          (libcdata_internal_btree_t *) btree,
+		          (intptr_t *) &( values[ value_index ] ),
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &last_upper_node,
+		          &upper_node,
+		          &upper_value_index,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INTPTR(
+		 "upper_node",
+		 (intptr_t) upper_node,
+		 (intptr_t) last_upper_node );
+
+		result = libcdata_btree_node_get_value_by_index(
+		          upper_node,
+		          upper_value_index,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INTPTR(
+		 "existing_value",
+		 (intptr_t) existing_value,
+		 (intptr_t) &( values[ value_index ] ) );
+
+		/* Test with a value that does not exist within the range of the last upper node
+		 */
+		test_value = ( value_index * 2 ) + 1;
+
+		result = libcdata_internal_btree_get_upper_node_by_value(
+		          (libcdata_internal_btree_t *) btree,
+		          (intptr_t *) &test_value,
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &last_upper_node,
+		          &upper_node,
+		          &upper_value_index,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "upper_value_index",
+		 upper_value_index,
+		 -1 );
+	}
+	/* Test if the last upper node is reset when a value is removed
+	 */
+	result = libcdata_btree_get_value_by_value(
+	          btree,
+	          (intptr_t *) &( values[ 0 ] ),
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	values_array_index = 0;
+
+	result = libcdata_btree_remove_value(
+	          btree,
+	          upper_node,
+	          &values_array_index,
+	          existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "last_upper_node",
+	 ( (libcdata_internal_btree_t *) btree )->last_upper_node );
+
+	/* Test error cases
+	 */
+	result = libcdata_internal_btree_get_upper_node_by_value(
+	          NULL,
+	          (intptr_t *) &( values[ 1 ] ),
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &last_upper_node,
+	          &upper_node,
+	          &upper_value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_internal_btree_get_upper_node_by_value(
+	          (libcdata_internal_btree_t *) btree,
+	          (intptr_t *) &( values[ 1 ] ),
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          NULL,
+	          &upper_node,
+	          &upper_value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_internal_btree_get_upper_node_by_value(
+	          (libcdata_internal_btree_t *) btree,
+	          (intptr_t *) &( values[ 1 ] ),
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &last_upper_node,
+	          NULL,
+	          &upper_value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_internal_btree_get_upper_node_by_value(
+	          (libcdata_internal_btree_t *) btree,
+	          (intptr_t *) &( values[ 1 ] ),
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &last_upper_node,
+	          &upper_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          &cdata_test_btree_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_internal_btree_sort_value_indexes function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_sort_value_indexes(
+     void )
+{
+	intptr_t *value_pointers[ 64 ];
+	int sorted_indexes[ 64 ];
+	int values[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		values[ value_index ]         = ( value_index * 37 ) % 16;
+		value_pointers[ value_index ] = (intptr_t *) &( values[ value_index ] );
+	}
+	result = libcdata_internal_btree_sort_value_indexes(
+	          value_pointers,
+	          64,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          sorted_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 1;
+	     value_index < 64;
+	     value_index++ )
+	{
+		CDATA_TEST_ASSERT_LESS_THAN_INT(
+		 "values[ sorted_indexes[ value_index - 1 ] ]",
+		 values[ sorted_indexes[ value_index - 1 ] ],
+		 values[ sorted_indexes[ value_index ] ] + 1 );
+
+		/* Values that are equal remain in their original order
+		 */
+		if( values[ sorted_indexes[ value_index - 1 ] ] == values[ sorted_indexes[ value_index ] ] )
+		{
+			CDATA_TEST_ASSERT_LESS_THAN_INT(
+			 "sorted_indexes[ value_index - 1 ]",
+			 sorted_indexes[ value_index - 1 ],
+			 sorted_indexes[ value_index ] );
+		}
+	}
+	result = libcdata_internal_btree_sort_value_indexes(
+	          value_pointers,
+	          17,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          sorted_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 1;
+	     value_index < 17;
+	     value_index++ )
+	{
+		CDATA_TEST_ASSERT_LESS_THAN_INT(
+		 "values[ sorted_indexes[ value_index - 1 ] ]",
+		 values[ sorted_indexes[ value_index - 1 ] ],
+		 values[ sorted_indexes[ value_index ] ] + 1 );
+
+		/* Values that are equal remain in their original order
+		 */
+		if( values[ sorted_indexes[ value_index - 1 ] ] == values[ sorted_indexes[ value_index ] ] )
+		{
+			CDATA_TEST_ASSERT_LESS_THAN_INT(
+			 "sorted_indexes[ value_index - 1 ]",
+			 sorted_indexes[ value_index - 1 ],
+			 sorted_indexes[ value_index ] );
+		}
+	}
+	result = libcdata_internal_btree_sort_value_indexes(
+	          value_pointers,
+	          1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          sorted_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sorted_indexes[ 0 ]",
+	 sorted_indexes[ 0 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdata_internal_btree_sort_value_indexes(
+	          NULL,
+	          64,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          sorted_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_internal_btree_sort_value_indexes(
+	          value_pointers,
+	          -1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          sorted_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_internal_btree_sort_value_indexes(
+	          value_pointers,
+	          64,
+	          NULL,
+	          sorted_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_internal_btree_sort_value_indexes(
+	          value_pointers,
+	          64,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+
+/* Tests the libcdata_btree_get_value_by_value function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_get_value_by_value(
+     void )
+{
+	libcdata_btree_t *btree          = NULL;
+	libcdata_tree_node_t *upper_node = NULL;
+	libcerror_error_t *error         = NULL;
+	intptr_t *existing_value         = NULL;
+	intptr_t *test_value             = NULL;
+	int result                       = 0;
+	int value1                       = 1;
+	int value2                       = 2;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_initialize(
+	          &btree,
+	          100,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	upper_node     = NULL;
+	existing_value = NULL;
+
+	result = libcdata_btree_get_value_by_value(
+	          btree,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "upper_node",
+	 upper_node );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "existing_value",
+	 existing_value );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	upper_node     = NULL;
+	existing_value = NULL;
+
+	result = libcdata_btree_get_value_by_value(
+	          btree,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "upper_node",
+	 upper_node );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "existing_value",
+	 existing_value );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_get_value_by_value(
+	          NULL,
+	          (intptr_t *) &test_value,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_value_by_value(
+	          btree,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_value_by_value(
+	          btree,
+	          (intptr_t *) &test_value,
+	          NULL,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_value_by_value(
+	          btree,
+	          (intptr_t *) &test_value,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          NULL,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_value_by_value(
+	          btree,
+	          (intptr_t *) &test_value,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          &cdata_test_btree_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_get_values_by_values function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_get_values_by_values(
+     void )
+{
+	intptr_t *existing_values[ 64 ];
+	intptr_t *value_pointers[ 64 ];
+	int value_indexes[ 64 ];
+	int values[ 64 ];
+
+	libcdata_btree_t *btree  = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_initialize(
+	          &btree,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		values[ value_index ]         = ( value_index * 37 ) % 64;
+		value_pointers[ value_index ] = (intptr_t *) &( values[ value_index ] );
+	}
+	result = libcdata_btree_insert_values(
+	          btree,
+	          value_pointers,
+	          32,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          value_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_get_values_by_values(
+	          btree,
+	          value_pointers,
+	          64,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          existing_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		if( value_index < 32 )
+		{
+			CDATA_TEST_ASSERT_EQUAL_INTPTR(
+			 "existing_values[ value_index ]",
+			 (intptr_t) existing_values[ value_index ],
+			 (intptr_t) &( values[ value_index ] ) );
+		}
+		else
+		{
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "existing_values[ value_index ]",
+			 existing_values[ value_index ] );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libcdata_btree_get_values_by_values(
+	          NULL,
+	          value_pointers,
+	          64,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          existing_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_values_by_values(
+	          btree,
+	          NULL,
+	          64,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          existing_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_values_by_values(
+	          btree,
+	          value_pointers,
+	          -1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          existing_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_values_by_values(
+	          btree,
+	          value_pointers,
+	          64,
+	          NULL,
+	          existing_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_values_by_values(
+	          btree,
+	          value_pointers,
+	          64,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          &cdata_test_btree_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( LIBCDATA_HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+
+/* Test reader thread function, which looks up values in the tree
+ * Returns NULL if successful or the reader on error
+ */
+void *cdata_test_btree_reader_thread_function(
+       void *arguments )
+{
+	cdata_test_btree_reader_t *reader = NULL;
+	libcdata_tree_node_t *upper_node  = NULL;
+	intptr_t *existing_value          = NULL;
+	int lookup_index                  = 0;
+	int result                        = 0;
+	int test_value                    = 0;
+
+	reader = (cdata_test_btree_reader_t *) arguments;
+
+	for( lookup_index = 0;
+	     lookup_index < CDATA_TEST_BTREE_NUMBER_OF_READER_LOOKUPS;
+	     lookup_index++ )
+	{
+		/* Alternate between nearby and distant values so that the lookups
+		 * both hit and miss the last upper node
+		 */
+		if( ( lookup_index % 2 ) == 0 )
+		{
+			test_value = ( reader->first_value + lookup_index ) % CDATA_TEST_BTREE_NUMBER_OF_READER_VALUES;
+		}
+		else
+		{
+			test_value = ( reader->first_value + ( lookup_index * 97 ) ) % CDATA_TEST_BTREE_NUMBER_OF_READER_VALUES;
+		}
+		result = libcdata_btree_get_value_by_value(
+		          reader->btree,
+		          (intptr_t *) &test_value,
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          NULL );
+
+		if( ( result != 1 )
+		 || ( existing_value == NULL )
+		 || ( *( (int *) existing_value ) != test_value ) )
+		{
+			return( (void *) reader );
+		}
+	}
+	return( NULL );
+}
+
+/* Tests concurrent lookups of values in the tree
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_concurrent_lookups(
+     void )
+{
+	cdata_test_btree_reader_t readers[ CDATA_TEST_BTREE_NUMBER_OF_READER_THREADS ];
+	pthread_t threads[ CDATA_TEST_BTREE_NUMBER_OF_READER_THREADS ];
+	int values[ CDATA_TEST_BTREE_NUMBER_OF_READER_VALUES ];
+
+	libcdata_btree_t *btree          = NULL;
+	libcdata_tree_node_t *upper_node = NULL;
+	libcerror_error_t *error         = NULL;
+	intptr_t *existing_value         = NULL;
+	void *thread_result              = NULL;
+	int number_of_joined_threads     = 0;
+	int number_of_threads            = 0;
+	int result                       = 0;
+	int thread_index                 = 0;
+	int value_index                  = 0;
+	int values_array_index           = 0;
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+	libcdata_tree_node_t *last_upper_node = NULL;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_initialize(
+	          &btree,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < CDATA_TEST_BTREE_NUMBER_OF_READER_VALUES;
+	     value_index++ )
+	{
+		values[ value_index ] = value_index;
+
+		result = libcdata_btree_insert_value(
+		          btree,
+		          &values_array_index,
+		          (intptr_t *) &( values[ value_index ] ),
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+	last_upper_node = ( (libcdata_internal_btree_t *) btree )->last_upper_node;
+#endif
+
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < CDATA_TEST_BTREE_NUMBER_OF_READER_THREADS;
+	     thread_index++ )
+	{
+		readers[ thread_index ].btree       = btree;
+		readers[ thread_index ].first_value = thread_index * ( CDATA_TEST_BTREE_NUMBER_OF_READER_VALUES / CDATA_TEST_BTREE_NUMBER_OF_READER_THREADS );
+
+		result = pthread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          &cdata_test_btree_reader_thread_function,
+		          (void *) &( readers[ thread_index ] ) );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		number_of_threads++;
+	}
+	for( thread_index = 0;
+	     thread_index < CDATA_TEST_BTREE_NUMBER_OF_READER_THREADS;
+	     thread_index++ )
+	{
+		result = pthread_join(
+		          threads[ thread_index ],
+		          &thread_result );
+
+		number_of_joined_threads++;
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "thread_result",
+		 thread_result );
+	}
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+	/* Test if the lookups did not change the last upper node of the tree
+	 */
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "last_upper_node",
+	 (intptr_t) ( (libcdata_internal_btree_t *) btree )->last_upper_node,
+	 (intptr_t) last_upper_node );
+#endif
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          &cdata_test_btree_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	while( number_of_joined_threads < number_of_threads )
+	{
+		pthread_join(
+		 threads[ number_of_joined_threads ],
+		 NULL );
+
+		number_of_joined_threads++;
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBCDATA_HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI ) */
+
+/* Tests the libcdata_btree_get_value_by_rank function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_get_value_by_rank(
+     void )
+{
+	libcdata_btree_t *btree          = NULL;
+	libcdata_tree_node_t *upper_node = NULL;
+	libcerror_error_t *error         = NULL;
+	intptr_t *existing_value         = NULL;
+	intptr_t *value                  = NULL;
+	int *values                      = NULL;
+	int insert_value_index           = 0;
+	int rank                         = 0;
+	int result                       = 0;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	result = libcdata_btree_initialize(
+	          &btree,
+	          CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	/* The tree contains the even values, which are inserted in a different order than they are sorted
+	 */
+	for( value_index = 0;
+	     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		values[ value_index ] = ( ( value_index * 7919 ) % CDATA_TEST_BTREE_NUMBER_OF_VALUES ) * 2;
+
+		result = libcdata_btree_insert_value(
+		          btree,
+		          &insert_value_index,
+		          (intptr_t *) &( values[ value_index ] ),
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	for( rank = 0;
+	     rank < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     rank++ )
+	{
+		result = libcdata_btree_get_value_by_rank(
+		          btree,
+		          rank,
+		          &value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "value",
+		 *( (int *) value ),
+		 rank * 2 );
+	}
+	/* Remove the values with an odd index in the values array
+	 */
+	for( value_index = 1;
+	     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     value_index += 2 )
+	{
+		result = libcdata_btree_get_value_by_value(
+		          btree,
+		          (intptr_t *) &( values[ value_index ] ),
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		insert_value_index = value_index;
+
+		result = libcdata_btree_remove_value(
+		          btree,
+		          upper_node,
+		          &insert_value_index,
+		          existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The values with an odd index in the values array are the values ( ( odd index * 7919 ) % number of values ) * 2,
+	 * hence the remaining values are the multiples of 4
+	 */
+	for( rank = 0;
+	     rank < ( CDATA_TEST_BTREE_NUMBER_OF_VALUES / 2 );
+	     rank++ )
+	{
+		result = libcdata_btree_get_value_by_rank(
+		          btree,
+		          rank,
+		          &value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "value",
+		 *( (int *) value ),
+		 rank * 4 );
+	}
+	/* Test error cases
+	 */
+	result = libcdata_btree_get_value_by_rank(
+	          NULL,
+	          0,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_value_by_rank(
+	          btree,
+	          -1,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_value_by_rank(
+	          btree,
+	          CDATA_TEST_BTREE_NUMBER_OF_VALUES / 2,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_value_by_rank(
+	          btree,
+	          0,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	memory_free(
+	 values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 NULL,
+		 NULL );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_get_rank_of_value function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_get_rank_of_value(
+     void )
+{
+	libcdata_btree_t *btree          = NULL;
+	libcdata_tree_node_t *upper_node = NULL;
+	libcerror_error_t *error         = NULL;
+	intptr_t *existing_value         = NULL;
+	int *values                      = NULL;
+	int insert_value_index           = 0;
+	int rank                         = 0;
+	int result                       = 0;
+	int test_value                   = 0;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	result = libcdata_btree_initialize(
+	          &btree,
+	          CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	/* The tree contains the even values, which are inserted in a different order than they are sorted
+	 */
+	for( value_index = 0;
+	     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		values[ value_index ] = ( ( value_index * 7919 ) % CDATA_TEST_BTREE_NUMBER_OF_VALUES ) * 2;
+
+		result = libcdata_btree_insert_value(
+		          btree,
+		          &insert_value_index,
+		          (intptr_t *) &( values[ value_index ] ),
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 * The rank of an odd value, which is not in the tree, is the rank of the next even value
+	 */
+	for( test_value = 0;
+	     test_value < ( CDATA_TEST_BTREE_NUMBER_OF_VALUES * 2 );
+	     test_value++ )
+	{
+		result = libcdata_btree_get_rank_of_value(
+		          btree,
+		          (intptr_t *) &test_value,
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &rank,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 ( test_value + 1 ) % 2 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "rank",
+		 rank,
+		 ( test_value + 1 ) / 2 );
+	}
+	/* Remove the values with an odd index in the values array
+	 */
+	for( value_index = 1;
+	     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     value_index += 2 )
+	{
+		result = libcdata_btree_get_value_by_value(
+		          btree,
+		          (intptr_t *) &( values[ value_index ] ),
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		insert_value_index = value_index;
+
+		result = libcdata_btree_remove_value(
+		          btree,
+		          upper_node,
+		          &insert_value_index,
+		          existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The remaining values are the multiples of 4
+	 */
+	for( test_value = 0;
+	     test_value < ( CDATA_TEST_BTREE_NUMBER_OF_VALUES * 2 );
+	     test_value++ )
+	{
+		result = libcdata_btree_get_rank_of_value(
+		          btree,
+		          (intptr_t *) &test_value,
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &rank,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 ( test_value % 4 ) == 0 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "rank",
+		 rank,
+		 ( test_value + 3 ) / 4 );
+	}
+	/* Test error cases
+	 */
+	result = libcdata_btree_get_rank_of_value(
+	          NULL,
+	          (intptr_t *) &test_value,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &rank,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_rank_of_value(
+	          btree,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &rank,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_rank_of_value(
+	          btree,
+	          (intptr_t *) &test_value,
+	          NULL,
+	          &rank,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_rank_of_value(
+	          btree,
+	          (intptr_t *) &test_value,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	memory_free(
+	 values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 NULL,
+		 NULL );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_insert_value function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_insert_value(
+     void )
+{
+	libcdata_btree_t *btree          = NULL;
+	libcdata_tree_node_t *upper_node = NULL;
+	libcerror_error_t *error         = NULL;
+	intptr_t *existing_value         = NULL;
+	int result                       = 0;
+	int value1                       = 1;
+	int value2                       = 2;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_initialize(
+	          &btree,
+	          100,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_insert_value(
+	          NULL,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          NULL,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          NULL,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          NULL,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATA_TEST_RWLOCK )
+
+	/* Test libcdata_btree_insert_value with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	cdata_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	if( cdata_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		cdata_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcdata_btree_insert_value with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	cdata_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	if( cdata_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		cdata_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+
+#endif /* defined( HAVE_CDATA_TEST_RWLOCK ) */
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          &cdata_test_btree_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the height of the tree after inserting sequential and random values
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_insert_value_height(
+     void )
+{
+	libcdata_btree_t *btree          = NULL;
+	libcdata_tree_node_t *upper_node = NULL;
+	libcerror_error_t *error         = NULL;
+	intptr_t *existing_value         = NULL;
+	int *values                      = NULL;
+	int height                       = 0;
+	int insert_value_index           = 0;
+	int maximum_height               = 0;
+	int number_of_leaf_nodes         = 0;
+	int number_of_nodes              = 0;
+	int number_of_values             = 0;
+	int result                       = 0;
+	int test_number                  = 0;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	/* Every node, except the root node, is at least half full, hence the height
+	 * of the tree should not exceed log( number of values ) / log( maximum / 2 )
+	 */
+	for( number_of_values = 1;
+	     number_of_values < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     number_of_values *= CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES / 2 )
+	{
+		maximum_height++;
+	}
+	/* Test regular cases
+	 */
+	for( test_number = 0;
+	     test_number < 2;
+	     test_number++ )
+	{
+		/* The first test inserts sequential values, the second test inserts
+		 * the same values in a pseudo random order
+		 */
+		for( value_index = 0;
+		     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+		     value_index++ )
+		{
+			if( test_number == 0 )
+			{
+				values[ value_index ] = value_index;
+			}
+			else
+			{
+				values[ value_index ] = (int) ( ( (int64_t) value_index * 7919 ) % CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+			}
+		}
+		result = libcdata_btree_initialize(
+		          &btree,
+		          CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "btree",
+		 btree );
+
+		for( value_index = 0;
+		     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+		     value_index++ )
+		{
+			result = libcdata_btree_insert_value(
+			          btree,
+			          &insert_value_index,
+			          (intptr_t *) &( values[ value_index ] ),
+			          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+			          &upper_node,
+			          &existing_value,
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libcdata_btree_get_number_of_values(
+		          btree,
+		          &number_of_values,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "number_of_values",
+		 number_of_values,
+		 CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+
+		result = libcdata_btree_get_statistics(
+		          btree,
+		          &height,
+		          &number_of_nodes,
+		          &number_of_leaf_nodes,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_LESS_THAN_INT(
+		 "height",
+		 height,
+		 maximum_height + 1 );
+
+		for( value_index = 0;
+		     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+		     value_index++ )
+		{
+			result = libcdata_btree_get_value_by_value(
+			          btree,
+			          (intptr_t *) &( values[ value_index ] ),
+			          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+			          &upper_node,
+			          &existing_value,
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libcdata_btree_free(
+		          &btree,
+		          &cdata_test_btree_value_free_function,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "btree",
+		 btree );
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_insert_values function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_insert_values(
+     void )
+{
+	intptr_t *value_pointers[ 64 ];
+	int value_indexes[ 64 ];
+	int values[ 64 ];
+
+	libcdata_btree_t *btree  = NULL;
+	libcerror_error_t *error = NULL;
+	intptr_t *existing_value = NULL;
+	int number_of_values     = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_initialize(
+	          &btree,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	/* The values are inserted in a pseudo random order
+	 */
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		values[ value_index ]         = ( value_index * 37 ) % 64;
+		value_pointers[ value_index ] = (intptr_t *) &( values[ value_index ] );
+	}
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_insert_values(
+	          btree,
+	          value_pointers,
+	          64,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          value_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_get_number_of_values(
+	          btree,
+	          &number_of_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 64 );
+
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		result = libcdata_btree_get_value_by_index(
+		          btree,
+		          value_indexes[ value_index ],
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INTPTR(
+		 "existing_value",
+		 (intptr_t) existing_value,
+		 (intptr_t) &( values[ value_index ] ) );
+
+		result = libcdata_btree_get_value_by_rank(
+		          btree,
+		          value_index,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "*existing_value",
+		 *( (int *) existing_value ),
+		 value_index );
+	}
+	/* Test with values that already exist
+	 */
+	result = libcdata_btree_insert_values(
+	          btree,
+	          value_pointers,
+	          2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          value_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_indexes[ 0 ]",
+	 value_indexes[ 0 ],
+	 -1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_indexes[ 1 ]",
+	 value_indexes[ 1 ],
+	 -1 );
+
+	/* Test with an empty batch
+	 */
+	result = libcdata_btree_insert_values(
+	          btree,
+	          value_pointers,
+	          0,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          value_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_insert_values(
+	          NULL,
+	          value_pointers,
+	          64,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          value_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_values(
+	          btree,
+	          NULL,
+	          64,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          value_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_values(
+	          btree,
+	          value_pointers,
+	          -1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          value_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_values(
+	          btree,
+	          value_pointers,
+	          64,
+	          NULL,
+	          value_indexes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_values(
+	          btree,
+	          value_pointers,
+	          64,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          &cdata_test_btree_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_insert_value_by_key and libcdata_btree_get_value_by_key functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_insert_value_by_key(
+     void )
+{
+	libcdata_btree_t *btree          = NULL;
+	libcdata_tree_node_t *upper_node = NULL;
+	libcerror_error_t *error         = NULL;
+	intptr_t *existing_value         = NULL;
+	int *value_indexes               = NULL;
+	int *values                      = NULL;
+	int number_of_values             = 0;
+	int result                       = 0;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	value_indexes = (int *) memory_allocate(
+	                         sizeof( int ) * CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "value_indexes",
+	 value_indexes );
+
+	/* The values are inserted in a pseudo random order and are used as their own key
+	 */
+	for( value_index = 0;
+	     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		values[ value_index ] = (int) ( ( (int64_t) value_index * 7919 ) % CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+	}
+	result = libcdata_btree_initialize(
+	          &btree,
+	          CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		result = libcdata_btree_insert_value_by_key(
+		          btree,
+		          (uint64_t) values[ value_index ],
+		          &( value_indexes[ value_index ] ),
+		          (intptr_t *) &( values[ value_index ] ),
+		          &upper_node,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcdata_btree_get_number_of_values(
+	          btree,
+	          &number_of_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+
+	for( value_index = 0;
+	     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		result = libcdata_btree_get_value_by_key(
+		          btree,
+		          (uint64_t) values[ value_index ],
+		          &upper_node,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INTPTR(
+		 "existing_value",
+		 (intptr_t) existing_value,
+		 (intptr_t) &( values[ value_index ] ) );
+	}
+	/* The values are ordered by key
+	 */
+	for( value_index = 0;
+	     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		result = libcdata_btree_get_value_by_rank(
+		          btree,
+		          value_index,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "*existing_value",
+		 *( (int *) existing_value ),
+		 value_index );
+	}
+	/* Test with an existing key
+	 */
+	result = libcdata_btree_insert_value_by_key(
+	          btree,
+	          (uint64_t) values[ 1 ],
+	          &value_index,
+	          (intptr_t *) &( values[ 2 ] ),
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "existing_value",
+	 (intptr_t) existing_value,
+	 (intptr_t) &( values[ 1 ] ) );
+
+	/* Test with a key that does not exist
+	 */
+	result = libcdata_btree_get_value_by_key(
+	          btree,
+	          (uint64_t) CDATA_TEST_BTREE_NUMBER_OF_VALUES,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "existing_value",
+	 existing_value );
+
+	/* Test removing values from a tree indexed by key
+	 */
+	for( value_index = 0;
+	     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     value_index += 2 )
+	{
+		result = libcdata_btree_get_value_by_key(
+		          btree,
+		          (uint64_t) values[ value_index ],
+		          &upper_node,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_btree_remove_value(
+		          btree,
+		          upper_node,
+		          &( value_indexes[ value_index ] ),
+		          existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( value_index = 0;
+	     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		result = libcdata_btree_get_value_by_key(
+		          btree,
+		          (uint64_t) values[ value_index ],
+		          &upper_node,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 value_index % 2 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcdata_btree_insert_value_by_key(
+	          NULL,
+	          0,
+	          &value_index,
+	          (intptr_t *) &( values[ 0 ] ),
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_value_by_key(
+	          btree,
+	          0,
+	          NULL,
+	          (intptr_t *) &( values[ 0 ] ),
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_value_by_key(
+	          btree,
+	          0,
+	          &value_index,
+	          NULL,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_value_by_key(
+	          btree,
+	          0,
+	          &value_index,
+	          (intptr_t *) &( values[ 0 ] ),
+	          NULL,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_insert_value_by_key(
+	          btree,
+	          0,
+	          &value_index,
+	          (intptr_t *) &( values[ 0 ] ),
+	          &upper_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_value_by_key(
+	          NULL,
+	          0,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_value_by_key(
+	          btree,
+	          0,
+	          NULL,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_get_value_by_key(
+	          btree,
+	          0,
+	          &upper_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          &cdata_test_btree_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 value_indexes );
+
+	memory_free(
+	 values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	if( value_indexes != NULL )
+	{
+		memory_free(
+		 value_indexes );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	return( 0 );
+}
 
-	result = libcdata_btree_get_value_by_index(
+/* Tests the libcdata_btree_replace_value function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_replace_value(
+     void )
+{
+	libcdata_btree_t *btree          = NULL;
+	libcdata_tree_node_t *upper_node = NULL;
+	libcerror_error_t *error         = NULL;
+	intptr_t *existing_value         = NULL;
+	int replacement_value            = 2;
+	int replacement_value_index      = 0;
+	int result                       = 0;
+	int value_index                  = 0;
+	int value1                       = 1;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_initialize(
+	          &btree,
+	          100,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_insert_value(
 	          btree,
-	          -1,
-	          &test_value,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
-	 "test_value",
-	 test_value );
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_replace_value(
+	          NULL,
+	          upper_node,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          &replacement_value_index,
+	          (intptr_t *) &replacement_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -608,10 +4840,13 @@ int cdata_test_btree_get_value_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_get_value_by_index(
+	result = libcdata_btree_replace_value(
 	          btree,
-	          0,
 	          NULL,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          &replacement_value_index,
+	          (intptr_t *) &replacement_value,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -619,9 +4854,89 @@ int cdata_test_btree_get_value_by_index(
 	 result,
 	 -1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "test_value",
-	 test_value );
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_replace_value(
+	          btree,
+	          upper_node,
+	          NULL,
+	          (intptr_t *) &value1,
+	          &replacement_value_index,
+	          (intptr_t *) &replacement_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_replace_value(
+	          btree,
+	          upper_node,
+	          &value_index,
+	          NULL,
+	          &replacement_value_index,
+	          (intptr_t *) &replacement_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_replace_value(
+	          btree,
+	          upper_node,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          NULL,
+	          (intptr_t *) &replacement_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_replace_value(
+	          btree,
+	          upper_node,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          &replacement_value_index,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -668,21 +4983,25 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcdata_btree_get_value_by_value function
+/* Tests the libcdata_btree_remove_value function
  * Returns 1 if successful or 0 if not
  */
-int cdata_test_btree_get_value_by_value(
+int cdata_test_btree_remove_value(
      void )
 {
 	libcdata_btree_t *btree          = NULL;
 	libcdata_tree_node_t *upper_node = NULL;
 	libcerror_error_t *error         = NULL;
 	intptr_t *existing_value         = NULL;
-	intptr_t *test_value             = NULL;
+	int number_of_values             = 0;
 	int result                       = 0;
+	int value_index                  = 0;
+	int value_index2                 = 0;
+	int value_index3                 = 0;
 	int value1                       = 1;
 	int value2                       = 2;
-	int value_index                  = 0;
+	int value3                       = 3;
+	int value4                       = 4;
 
 	/* Initialize test
 	 */
@@ -696,21 +5015,113 @@ int cdata_test_btree_get_value_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "btree",
-	 btree );
-
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index2,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_insert_value(
+	          btree,
+	          &value_index3,
+	          (intptr_t *) &value3,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Remove a value that is not stored in the last entry of the values array
+	 */
+	result = libcdata_btree_get_value_by_value(
+	          btree,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_remove_value(
+	          btree,
+	          upper_node,
+	          &value_index2,
+	          (intptr_t *) &value2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_btree_insert_value(
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index2",
+	 value_index2,
+	 -1 );
+
+	result = libcdata_btree_get_number_of_values(
 	          btree,
-	          &value_index,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &existing_value,
+	          &number_of_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -722,14 +5133,16 @@ int cdata_test_btree_get_value_by_value(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	upper_node     = NULL;
-	existing_value = NULL;
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 3 );
 
+	/* Remove a value that is stored in the last entry of the values array
+	 */
 	result = libcdata_btree_get_value_by_value(
 	          btree,
-	          (intptr_t *) &value1,
+	          (intptr_t *) &value3,
 	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
 	          &upper_node,
 	          &existing_value,
@@ -740,24 +5153,51 @@ int cdata_test_btree_get_value_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "upper_node",
-	 upper_node );
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "existing_value",
-	 existing_value );
+	result = libcdata_btree_remove_value(
+	          btree,
+	          upper_node,
+	          &value_index3,
+	          (intptr_t *) &value3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	upper_node     = NULL;
-	existing_value = NULL;
+	result = libcdata_btree_get_number_of_values(
+	          btree,
+	          &number_of_values,
+	          &error );
 
-	result = libcdata_btree_get_value_by_value(
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 2 );
+
+	/* Insert a value that reuses the entry of the removed value
+	 */
+	result = libcdata_btree_insert_value(
 	          btree,
-	          (intptr_t *) &value2,
+	          &value_index2,
+	          (intptr_t *) &value4,
 	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
 	          &upper_node,
 	          &existing_value,
@@ -766,25 +5206,39 @@ int cdata_test_btree_get_value_by_value(
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "upper_node",
-	 upper_node );
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
-	 "existing_value",
-	 existing_value );
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index2",
+	 value_index2,
+	 1 );
+
+	result = libcdata_btree_get_number_of_values(
+	          btree,
+	          &number_of_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 2 );
+
 	result = libcdata_btree_get_value_by_value(
-	          NULL,
-	          (intptr_t *) &test_value,
+	          btree,
+	          (intptr_t *) &value1,
 	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
 	          &upper_node,
 	          &existing_value,
@@ -793,21 +5247,19 @@ int cdata_test_btree_get_value_by_value(
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcdata_btree_get_value_by_value(
-	          btree,
+	/* Test error cases
+	 */
+	result = libcdata_btree_remove_value(
 	          NULL,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &existing_value,
+	          upper_node,
+	          &value_index,
+	          (intptr_t *) &value1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -822,12 +5274,11 @@ int cdata_test_btree_get_value_by_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_get_value_by_value(
+	result = libcdata_btree_remove_value(
 	          btree,
-	          (intptr_t *) &test_value,
 	          NULL,
-	          &upper_node,
-	          &existing_value,
+	          &value_index,
+	          (intptr_t *) &value1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -842,12 +5293,11 @@ int cdata_test_btree_get_value_by_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_get_value_by_value(
+	result = libcdata_btree_remove_value(
 	          btree,
-	          (intptr_t *) &test_value,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          upper_node,
 	          NULL,
-	          &existing_value,
+	          (intptr_t *) &value1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -862,11 +5312,10 @@ int cdata_test_btree_get_value_by_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_get_value_by_value(
+	result = libcdata_btree_remove_value(
 	          btree,
-	          (intptr_t *) &test_value,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
+	          upper_node,
+	          &value_index,
 	          NULL,
 	          &error );
 
@@ -894,13 +5343,254 @@ int cdata_test_btree_get_value_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "btree",
-	 btree );
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 &cdata_test_btree_value_free_function,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the nodes of the tree after removing most of the values
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_remove_value_rebalance(
+     void )
+{
+	libcdata_btree_t *btree          = NULL;
+	libcdata_tree_node_t *upper_node = NULL;
+	libcerror_error_t *error         = NULL;
+	intptr_t *existing_value         = NULL;
+	int *value_indexes               = NULL;
+	int *values                      = NULL;
+	int height                       = 0;
+	int maximum_height               = 0;
+	int number_of_leaf_nodes         = 0;
+	int number_of_nodes              = 0;
+	int number_of_values             = 0;
+	int result                       = 0;
+	int test_number                  = 0;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	value_indexes = (int *) memory_allocate(
+	                         sizeof( int ) * CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "value_indexes",
+	 value_indexes );
+
+	/* Only 1 in 8 values remains after the removal
+	 */
+	for( number_of_values = 1;
+	     number_of_values < ( CDATA_TEST_BTREE_NUMBER_OF_VALUES / 8 );
+	     number_of_values *= CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES / 2 )
+	{
+		maximum_height++;
+	}
+	/* Test regular cases
+	 */
+	for( test_number = 0;
+	     test_number < 2;
+	     test_number++ )
+	{
+		/* The first test removes sequential values, the second test removes
+		 * the values in a pseudo random order
+		 */
+		for( value_index = 0;
+		     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+		     value_index++ )
+		{
+			if( test_number == 0 )
+			{
+				values[ value_index ] = value_index;
+			}
+			else
+			{
+				values[ value_index ] = (int) ( ( (int64_t) value_index * 7919 ) % CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+			}
+		}
+		result = libcdata_btree_initialize(
+		          &btree,
+		          CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "btree",
+		 btree );
+
+		for( value_index = 0;
+		     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+		     value_index++ )
+		{
+			result = libcdata_btree_insert_value(
+			          btree,
+			          &( value_indexes[ value_index ] ),
+			          (intptr_t *) &( values[ value_index ] ),
+			          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+			          &upper_node,
+			          &existing_value,
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		for( value_index = 0;
+		     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+		     value_index++ )
+		{
+			if( ( values[ value_index ] % 8 ) == 0 )
+			{
+				continue;
+			}
+			result = libcdata_btree_get_value_by_value(
+			          btree,
+			          (intptr_t *) &( values[ value_index ] ),
+			          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+			          &upper_node,
+			          &existing_value,
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libcdata_btree_remove_value(
+			          btree,
+			          upper_node,
+			          &( value_indexes[ value_index ] ),
+			          existing_value,
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libcdata_btree_get_statistics(
+		          btree,
+		          &height,
+		          &number_of_nodes,
+		          &number_of_leaf_nodes,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_LESS_THAN_INT(
+		 "height",
+		 height,
+		 maximum_height + 1 );
+
+		/* Every leaf node, except the root node, contains at least half the maximum number of values
+		 */
+		CDATA_TEST_ASSERT_LESS_THAN_INT(
+		 "number_of_leaf_nodes",
+		 number_of_leaf_nodes,
+		 ( CDATA_TEST_BTREE_NUMBER_OF_VALUES / 8 / ( CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES / 2 ) ) + 1 );
+
+		for( value_index = 0;
+		     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+		     value_index++ )
+		{
+			result = libcdata_btree_get_value_by_value(
+			          btree,
+			          (intptr_t *) &( values[ value_index ] ),
+			          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+			          &upper_node,
+			          &existing_value,
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 ( values[ value_index ] % 8 ) == 0 ? 1 : 0 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libcdata_btree_free(
+		          &btree,
+		          &cdata_test_btree_value_free_function,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "btree",
+		 btree );
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 value_indexes );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	memory_free(
+	 values );
 
 	return( 1 );
 
@@ -917,29 +5607,55 @@ on_error:
 		 &cdata_test_btree_value_free_function,
 		 NULL );
 	}
+	if( value_indexes != NULL )
+	{
+		memory_free(
+		 value_indexes );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
 	return( 0 );
 }
 
-/* Tests the libcdata_btree_insert_value function
+/* Tests the libcdata_btree_build_from_sorted_array function
  * Returns 1 if successful or 0 if not
  */
-int cdata_test_btree_insert_value(
+int cdata_test_btree_build_from_sorted_array(
      void )
 {
+	libcdata_array_t *array          = NULL;
 	libcdata_btree_t *btree          = NULL;
 	libcdata_tree_node_t *upper_node = NULL;
 	libcerror_error_t *error         = NULL;
 	intptr_t *existing_value         = NULL;
+	int *values                      = NULL;
+	int fill_factor                  = 0;
+	int height                       = 0;
+	int insert_value_index           = 0;
+	int maximum_height               = 0;
+	int number_of_leaf_nodes         = 0;
+	int number_of_nodes              = 0;
+	int number_of_values             = 0;
 	int result                       = 0;
-	int value1                       = 1;
-	int value2                       = 2;
+	int test_number                  = 0;
+	int value                        = 0;
 	int value_index                  = 0;
 
 	/* Initialize test
 	 */
-	result = libcdata_btree_initialize(
-	          &btree,
-	          100,
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	result = libcdata_array_initialize(
+	          &array,
+	          0,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -947,59 +5663,255 @@ int cdata_test_btree_insert_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "btree",
-	 btree );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	/* The array contains the even values, the odd values are inserted after the tree was built
+	 */
+	for( value_index = 0;
+	     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		values[ value_index ] = value_index * 2;
+
+		result = libcdata_array_append_entry(
+		          array,
+		          &insert_value_index,
+		          (intptr_t *) &( values[ value_index ] ),
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Every node, except the root node, is at least half full, hence the height
+	 * of the tree should not exceed log( number of values ) / log( maximum / 2 )
+	 */
+	for( number_of_values = 1;
+	     number_of_values < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+	     number_of_values *= CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES / 2 )
+	{
+		maximum_height++;
+	}
 	/* Test regular cases
 	 */
-	result = libcdata_btree_insert_value(
-	          btree,
-	          &value_index,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &existing_value,
-	          &error );
+	for( test_number = 0;
+	     test_number < 3;
+	     test_number++ )
+	{
+		fill_factor = 50 + ( test_number * 25 );
 
-	CDATA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		result = libcdata_btree_initialize(
+		          &btree,
+		          CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES,
+		          &error );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	result = libcdata_btree_insert_value(
-	          btree,
-	          &value_index,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &existing_value,
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "btree",
+		 btree );
+
+		result = libcdata_btree_build_from_sorted_array(
+		          btree,
+		          array,
+		          fill_factor,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_btree_get_number_of_values(
+		          btree,
+		          &number_of_values,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "number_of_values",
+		 number_of_values,
+		 CDATA_TEST_BTREE_NUMBER_OF_VALUES );
+
+		result = libcdata_btree_get_statistics(
+		          btree,
+		          &height,
+		          &number_of_nodes,
+		          &number_of_leaf_nodes,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_LESS_THAN_INT(
+		 "height",
+		 height,
+		 maximum_height + 1 );
+
+		/* The leaf nodes contain the number of values determined by the fill factor
+		 */
+		CDATA_TEST_ASSERT_LESS_THAN_INT(
+		 "number_of_leaf_nodes",
+		 number_of_leaf_nodes,
+		 ( CDATA_TEST_BTREE_NUMBER_OF_VALUES / ( ( CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES * fill_factor ) / 100 ) ) + 2 );
+
+		for( value_index = 0;
+		     value_index < CDATA_TEST_BTREE_NUMBER_OF_VALUES;
+		     value_index++ )
+		{
+			result = libcdata_btree_get_value_by_value(
+			          btree,
+			          (intptr_t *) &( values[ value_index ] ),
+			          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+			          &upper_node,
+			          &existing_value,
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			CDATA_TEST_ASSERT_EQUAL_INTPTR(
+			 "existing_value",
+			 (intptr_t) existing_value,
+			 (intptr_t) &( values[ value_index ] ) );
+		}
+		/* Test if values can be inserted and removed after the tree was built
+		 */
+		for( value_index = 1;
+		     value_index < 64;
+		     value_index += 2 )
+		{
+			value = value_index;
+
+			result = libcdata_btree_insert_value(
+			          btree,
+			          &insert_value_index,
+			          (intptr_t *) &value,
+			          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+			          &upper_node,
+			          &existing_value,
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libcdata_btree_remove_value(
+			          btree,
+			          upper_node,
+			          &insert_value_index,
+			          (intptr_t *) &value,
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Test with a tree that is not empty
+		 */
+		result = libcdata_btree_build_from_sorted_array(
+		          btree,
+		          array,
+		          fill_factor,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcdata_btree_free(
+		          &btree,
+		          &cdata_test_btree_value_free_function,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "btree",
+		 btree );
+	}
+	/* Test with an empty array
+	 */
+	result = libcdata_btree_initialize(
+	          &btree,
+	          CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_btree_insert_value(
-	          btree,
-	          &value_index,
-	          (intptr_t *) &value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &existing_value,
+	result = libcdata_array_empty(
+	          array,
+	          NULL,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1011,57 +5923,46 @@ int cdata_test_btree_insert_value(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcdata_btree_insert_value(
-	          NULL,
-	          &value_index,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &existing_value,
+	result = libcdata_btree_build_from_sorted_array(
+	          btree,
+	          array,
+	          100,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcdata_btree_insert_value(
+	result = libcdata_btree_get_number_of_values(
 	          btree,
-	          NULL,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &existing_value,
+	          &number_of_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 0 );
 
-	result = libcdata_btree_insert_value(
-	          btree,
-	          &value_index,
+	/* Test error cases
+	 */
+	result = libcdata_btree_build_from_sorted_array(
 	          NULL,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &existing_value,
+	          array,
+	          100,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1076,13 +5977,10 @@ int cdata_test_btree_insert_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_insert_value(
+	result = libcdata_btree_build_from_sorted_array(
 	          btree,
-	          &value_index,
-	          (intptr_t *) &value1,
 	          NULL,
-	          &upper_node,
-	          &existing_value,
+	          100,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1097,13 +5995,10 @@ int cdata_test_btree_insert_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_insert_value(
+	result = libcdata_btree_build_from_sorted_array(
 	          btree,
-	          &value_index,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          NULL,
-	          &existing_value,
+	          array,
+	          0,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1118,13 +6013,10 @@ int cdata_test_btree_insert_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_insert_value(
+	result = libcdata_btree_build_from_sorted_array(
 	          btree,
-	          &value_index,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          NULL,
+	          array,
+	          101,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1151,14 +6043,35 @@ int cdata_test_btree_insert_value(
 	 result,
 	 1 );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "btree",
 	 btree );
 
+	result = libcdata_array_free(
+	          &array,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "array",
+	 array );
+
+	memory_free(
+	 values );
+
 	return( 1 );
 
 on_error:
@@ -1174,30 +6087,56 @@ on_error:
 		 &cdata_test_btree_value_free_function,
 		 NULL );
 	}
+	if( array != NULL )
+	{
+		libcdata_array_free(
+		 &array,
+		 NULL,
+		 NULL );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
 	return( 0 );
 }
 
-/* Tests the libcdata_btree_replace_value function
+/* Tests the libcdata_btree_set_bloom_filter and libcdata_btree_rebuild_bloom_filter functions
  * Returns 1 if successful or 0 if not
  */
-int cdata_test_btree_replace_value(
+int cdata_test_btree_set_bloom_filter(
      void )
 {
 	libcdata_btree_t *btree          = NULL;
 	libcdata_tree_node_t *upper_node = NULL;
 	libcerror_error_t *error         = NULL;
 	intptr_t *existing_value         = NULL;
-	int replacement_value            = 2;
-	int replacement_value_index      = 0;
+	int *value_indexes               = NULL;
+	int *values                      = NULL;
+	int number_of_skipped_lookups    = 0;
 	int result                       = 0;
-	int value_index                  = 0;
-	int value1                       = 1;
+	int value                        = 0;
 
 	/* Initialize test
 	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * 200 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	value_indexes = (int *) memory_allocate(
+	                         sizeof( int ) * 200 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "value_indexes",
+	 value_indexes );
+
 	result = libcdata_btree_initialize(
 	          &btree,
-	          100,
+	          CDATA_TEST_BTREE_MAXIMUM_NUMBER_OF_VALUES,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1205,21 +6144,47 @@ int cdata_test_btree_replace_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "btree",
-	 btree );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_btree_insert_value(
-	          btree,
-	          &value_index,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &existing_value,
+	/* The tree contains the even values
+	 */
+	for( value = 0;
+	     value < 200;
+	     value += 1 )
+	{
+		values[ value ] = value;
+	}
+	for( value = 0;
+	     value < 200;
+	     value += 2 )
+	{
+		result = libcdata_btree_insert_value(
+		          btree,
+		          &( value_indexes[ value ] ),
+		          (intptr_t *) &( values[ value ] ),
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libcdata_btree_set_bloom_filter(
+	          btree,
+	          200,
+	          100,
+	          (int (*)(intptr_t *, uint64_t *, libcerror_error_t **)) &cdata_test_btree_value_hash_function,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1231,142 +6196,163 @@ int cdata_test_btree_replace_value(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* The Bloom filter contains the values that were inserted before it was set
 	 */
+	for( value = 0;
+	     value < 200;
+	     value += 2 )
+	{
+		result = libcdata_btree_get_value_by_value(
+		          btree,
+		          (intptr_t *) &( values[ value ] ),
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          &error );
 
-	/* Test error cases
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INTPTR(
+		 "existing_value",
+		 (intptr_t) existing_value,
+		 (intptr_t) &( values[ value ] ) );
+	}
+	/* Most of the values that are not in the tree are not looked up
 	 */
-	result = libcdata_btree_replace_value(
-	          NULL,
-	          upper_node,
-	          &value_index,
-	          (intptr_t *) &value1,
-	          &replacement_value_index,
-	          (intptr_t *) &replacement_value,
-	          &error );
+	for( value = 1;
+	     value < 200;
+	     value += 2 )
+	{
+		result = libcdata_btree_get_value_by_value(
+		          btree,
+		          (intptr_t *) &( values[ value ] ),
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          &error );
 
-	CDATA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	libcerror_error_free(
-	 &error );
+		if( upper_node == NULL )
+		{
+			number_of_skipped_lookups++;
+		}
+	}
+	CDATA_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_skipped_lookups",
+	 number_of_skipped_lookups,
+	 90 );
 
-	result = libcdata_btree_replace_value(
+	/* The Bloom filter contains the values that are inserted after it was set
+	 */
+	result = libcdata_btree_insert_value(
 	          btree,
-	          NULL,
-	          &value_index,
-	          (intptr_t *) &value1,
-	          &replacement_value_index,
-	          (intptr_t *) &replacement_value,
+	          &( value_indexes[ 1 ] ),
+	          (intptr_t *) &( values[ 1 ] ),
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcdata_btree_replace_value(
+	result = libcdata_btree_get_value_by_value(
 	          btree,
-	          upper_node,
-	          NULL,
-	          (intptr_t *) &value1,
-	          &replacement_value_index,
-	          (intptr_t *) &replacement_value,
+	          (intptr_t *) &( values[ 1 ] ),
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "existing_value",
+	 (intptr_t) existing_value,
+	 (intptr_t) &( values[ 1 ] ) );
 
-	result = libcdata_btree_replace_value(
+	/* The Bloom filter no longer contains a removed value after it was rebuilt
+	 */
+	result = libcdata_btree_remove_value(
 	          btree,
 	          upper_node,
-	          &value_index,
-	          NULL,
-	          &replacement_value_index,
-	          (intptr_t *) &replacement_value,
+	          &( value_indexes[ 1 ] ),
+	          (intptr_t *) &( values[ 1 ] ),
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcdata_btree_replace_value(
+	result = libcdata_btree_rebuild_bloom_filter(
 	          btree,
-	          upper_node,
-	          &value_index,
-	          (intptr_t *) &value1,
-	          NULL,
-	          (intptr_t *) &replacement_value,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcdata_btree_replace_value(
+	result = libcdata_btree_get_value_by_value(
 	          btree,
-	          upper_node,
-	          &value_index,
-	          (intptr_t *) &value1,
-	          &replacement_value_index,
-	          NULL,
+	          (intptr_t *) &( values[ 1 ] ),
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
-	 */
-	result = libcdata_btree_free(
-	          &btree,
-	          &cdata_test_btree_value_free_function,
+	result = libcdata_btree_get_value_by_value(
+	          btree,
+	          (intptr_t *) &( values[ 2 ] ),
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &existing_value,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1374,51 +6360,17 @@ int cdata_test_btree_replace_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "btree",
-	 btree );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( btree != NULL )
-	{
-		libcdata_btree_free(
-		 &btree,
-		 &cdata_test_btree_value_free_function,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libcdata_btree_remove_value function
- * Returns 1 if successful or 0 if not
- */
-int cdata_test_btree_remove_value(
-     void )
-{
-	libcdata_btree_t *btree          = NULL;
-	libcdata_tree_node_t *upper_node = NULL;
-	libcerror_error_t *error         = NULL;
-	intptr_t *existing_value         = NULL;
-	int result                       = 0;
-	int value_index                  = 0;
-	int value1                       = 1;
-
-	/* Initialize test
+	/* Setting the Bloom filter without a value hash function removes it
 	 */
-	result = libcdata_btree_initialize(
-	          &btree,
-	          100,
+	result = libcdata_btree_set_bloom_filter(
+	          btree,
+	          0,
+	          0,
+	          NULL,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1426,18 +6378,13 @@ int cdata_test_btree_remove_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "btree",
-	 btree );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_btree_insert_value(
+	result = libcdata_btree_get_value_by_value(
 	          btree,
-	          &value_index,
-	          (intptr_t *) &value1,
+	          (intptr_t *) &( values[ 1 ] ),
 	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
 	          &upper_node,
 	          &existing_value,
@@ -1446,22 +6393,23 @@ int cdata_test_btree_remove_value(
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "upper_node",
+	 upper_node );
 
 	/* Test error cases
 	 */
-	result = libcdata_btree_remove_value(
+	result = libcdata_btree_set_bloom_filter(
 	          NULL,
-	          upper_node,
-	          &value_index,
-	          (intptr_t *) &value1,
+	          200,
+	          100,
+	          (int (*)(intptr_t *, uint64_t *, libcerror_error_t **)) &cdata_test_btree_value_hash_function,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1476,11 +6424,11 @@ int cdata_test_btree_remove_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_remove_value(
+	result = libcdata_btree_set_bloom_filter(
 	          btree,
-	          NULL,
-	          &value_index,
-	          (intptr_t *) &value1,
+	          0,
+	          100,
+	          (int (*)(intptr_t *, uint64_t *, libcerror_error_t **)) &cdata_test_btree_value_hash_function,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1495,11 +6443,27 @@ int cdata_test_btree_remove_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_remove_value(
+	result = libcdata_btree_set_bloom_filter(
 	          btree,
-	          upper_node,
+	          200,
+	          1,
+	          (int (*)(intptr_t *, uint64_t *, libcerror_error_t **)) &cdata_test_btree_value_hash_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_rebuild_bloom_filter(
 	          NULL,
-	          (intptr_t *) &value1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1514,11 +6478,10 @@ int cdata_test_btree_remove_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_remove_value(
+	/* Rebuilding requires a Bloom filter
+	 */
+	result = libcdata_btree_rebuild_bloom_filter(
 	          btree,
-	          upper_node,
-	          &value_index,
-	          NULL,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1545,13 +6508,19 @@ int cdata_test_btree_remove_value(
 	 result,
 	 1 );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "btree",
 	 btree );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	memory_free(
+	 value_indexes );
+
+	memory_free(
+	 values );
 
 	return( 1 );
 
@@ -1568,6 +6537,16 @@ on_error:
 		 &cdata_test_btree_value_free_function,
 		 NULL );
 	}
+	if( value_indexes != NULL )
+	{
+		memory_free(
+		 value_indexes );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
 	return( 0 );
 }
 
@@ -1594,22 +6573,74 @@ int main(
 	 "libcdata_btree_free",
 	 cdata_test_btree_free );
 
+	CDATA_TEST_RUN(
+	 "libcdata_btree_clone",
+	 cdata_test_btree_clone );
+
 	CDATA_TEST_RUN(
 	 "libcdata_btree_get_number_of_values",
 	 cdata_test_btree_get_number_of_values );
 
+	CDATA_TEST_RUN(
+	 "libcdata_btree_get_statistics",
+	 cdata_test_btree_get_statistics );
+
 	CDATA_TEST_RUN(
 	 "libcdata_btree_get_value_by_index",
 	 cdata_test_btree_get_value_by_index );
 
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+	CDATA_TEST_RUN(
+	 "libcdata_internal_btree_get_upper_node_by_value",
+	 cdata_test_btree_get_upper_node_by_value );
+
+	CDATA_TEST_RUN(
+	 "libcdata_internal_btree_sort_value_indexes",
+	 cdata_test_btree_sort_value_indexes );
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+
 	CDATA_TEST_RUN(
 	 "libcdata_btree_get_value_by_value",
 	 cdata_test_btree_get_value_by_value );
 
+	CDATA_TEST_RUN(
+	 "libcdata_btree_get_values_by_values",
+	 cdata_test_btree_get_values_by_values );
+
+#if defined( LIBCDATA_HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_get_value_by_value concurrent lookups",
+	 cdata_test_btree_concurrent_lookups );
+
+#endif /* defined( LIBCDATA_HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI ) */
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_get_value_by_rank",
+	 cdata_test_btree_get_value_by_rank );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_get_rank_of_value",
+	 cdata_test_btree_get_rank_of_value );
+
 	CDATA_TEST_RUN(
 	 "libcdata_btree_insert_value",
 	 cdata_test_btree_insert_value );
 
+	CDATA_TEST_RUN(
+	 "libcdata_btree_insert_value height",
+	 cdata_test_btree_insert_value_height );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_insert_values",
+	 cdata_test_btree_insert_values );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_insert_value_by_key",
+	 cdata_test_btree_insert_value_by_key );
+
 	CDATA_TEST_RUN(
 	 "libcdata_btree_replace_value",
 	 cdata_test_btree_replace_value );
@@ -1618,6 +6649,18 @@ int main(
 	 "libcdata_btree_remove_value",
 	 cdata_test_btree_remove_value );
 
+	CDATA_TEST_RUN(
+	 "libcdata_btree_remove_value rebalance",
+	 cdata_test_btree_remove_value_rebalance );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_build_from_sorted_array",
+	 cdata_test_btree_build_from_sorted_array );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_set_bloom_filter",
+	 cdata_test_btree_set_bloom_filter );
+
 	return( EXIT_SUCCESS );
 
 on_error:
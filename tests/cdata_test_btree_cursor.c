@@ -0,0 +1,2303 @@
+/*
+ * Library balanced tree cursor type test program
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdata_test_libcdata.h"
+#include "cdata_test_libcerror.h"
+#include "cdata_test_macros.h"
+#include "cdata_test_memory.h"
+#include "cdata_test_unused.h"
+
+#include "../libcdata/libcdata_btree.h"
+#include "../libcdata/libcdata_btree_cursor.h"
+
+#define CDATA_TEST_BTREE_CURSOR_MAXIMUM_NUMBER_OF_VALUES	4
+#define CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES		10000
+
+/* Test value compare function
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int cdata_test_btree_cursor_value_compare_function(
+     int *first_value,
+     int *second_value,
+     libcdata_error_t **error )
+{
+	static char *function = "cdata_test_btree_cursor_value_compare_function";
+
+	if( first_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first value.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *first_value < *second_value )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( *first_value > *second_value )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Creates a tree that contains the values
+ * The values are inserted in a different order than they are sorted
+ * Returns 1 if successful or -1 on error
+ */
+int cdata_test_btree_cursor_initialize_tree(
+     libcdata_btree_t **btree,
+     int *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *upper_node = NULL;
+	intptr_t *existing_value         = NULL;
+	static char *function            = "cdata_test_btree_cursor_initialize_tree";
+	int insert_value_index           = 0;
+	int result                       = 0;
+	int value_index                  = 0;
+
+	if( libcdata_btree_initialize(
+	     btree,
+	     CDATA_TEST_BTREE_CURSOR_MAXIMUM_NUMBER_OF_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create tree.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		/* 7919 is a prime hence the values are inserted in a scrambled order
+		 */
+		values[ value_index ] = ( ( value_index * 7919 ) % number_of_values ) * 2;
+
+		result = libcdata_btree_insert_value(
+		          *btree,
+		          &insert_value_index,
+		          (intptr_t *) &( values[ value_index ] ),
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_cursor_value_compare_function,
+		          &upper_node,
+		          &existing_value,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert value: %d.",
+			 function,
+			 value_index );
+
+			libcdata_btree_free(
+			 btree,
+			 NULL,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the libcdata_btree_cursor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_cursor_initialize(
+     void )
+{
+	libcdata_btree_cursor_t *cursor = NULL;
+	libcdata_btree_t *btree         = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_CDATA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_initialize(
+	          &btree,
+	          CDATA_TEST_BTREE_CURSOR_MAXIMUM_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "btree",
+	 btree );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_cursor_initialize(
+	          &cursor,
+	          btree,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor",
+	 cursor );
+
+	result = libcdata_btree_cursor_free(
+	          &cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_cursor_initialize(
+	          NULL,
+	          btree,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cursor = (libcdata_btree_cursor_t *) 0x12345678UL;
+
+	result = libcdata_btree_cursor_initialize(
+	          &cursor,
+	          btree,
+	          &error );
+
+	cursor = NULL;
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_cursor_initialize(
+	          &cursor,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATA_TEST_MEMORY )
+
+	/* 1 fail in memory_allocate_structure
+	 */
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdata_btree_cursor_initialize with malloc failing
+		 */
+		cdata_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdata_btree_cursor_initialize(
+		          &cursor,
+		          btree,
+		          &error );
+
+		if( cdata_test_malloc_attempts_before_fail != -1 )
+		{
+			cdata_test_malloc_attempts_before_fail = -1;
+
+			if( cursor != NULL )
+			{
+				libcdata_btree_cursor_free(
+				 &cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "cursor",
+			 cursor );
+
+			CDATA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* 1 fail in memset after memory_allocate_structure
+	 */
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdata_btree_cursor_initialize with memset failing
+		 */
+		cdata_test_memset_attempts_before_fail = test_number;
+
+		result = libcdata_btree_cursor_initialize(
+		          &cursor,
+		          btree,
+		          &error );
+
+		if( cdata_test_memset_attempts_before_fail != -1 )
+		{
+			cdata_test_memset_attempts_before_fail = -1;
+
+			if( cursor != NULL )
+			{
+				libcdata_btree_cursor_free(
+				 &cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "cursor",
+			 cursor );
+
+			CDATA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATA_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cursor != NULL )
+	{
+		libcdata_btree_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_cursor_free(
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_cursor_seek_first and libcdata_btree_cursor_next functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_cursor_seek_first(
+     void )
+{
+	libcdata_btree_cursor_t *cursor = NULL;
+	libcdata_btree_t *btree         = NULL;
+	libcerror_error_t *error        = NULL;
+	intptr_t *value                 = NULL;
+	int *values                     = NULL;
+	int expected_value              = 0;
+	int number_of_values            = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	result = libcdata_btree_initialize(
+	          &btree,
+	          CDATA_TEST_BTREE_CURSOR_MAXIMUM_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_initialize(
+	          &cursor,
+	          btree,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with an empty tree
+	 */
+	result = libcdata_btree_cursor_seek_first(
+	          cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_get_value(
+	          cursor,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	result = libcdata_btree_cursor_next(
+	          cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_free(
+	          &cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_free(
+	          &btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = cdata_test_btree_cursor_initialize_tree(
+	          &btree,
+	          values,
+	          CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_initialize(
+	          &cursor,
+	          btree,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cursor is not positioned before a seek
+	 */
+	result = libcdata_btree_cursor_next(
+	          cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_seek_first(
+	          cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_value = 0;
+
+	while( result == 1 )
+	{
+		result = libcdata_btree_cursor_get_value(
+		          cursor,
+		          &value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "value",
+		 *( (int *) value ),
+		 expected_value );
+
+		expected_value += 2;
+		number_of_values++;
+
+		result = libcdata_btree_cursor_next(
+		          cursor,
+		          &error );
+
+		CDATA_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES );
+
+	/* The cursor is no longer positioned after the last value
+	 */
+	result = libcdata_btree_cursor_get_value(
+	          cursor,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_next(
+	          cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_cursor_seek_first(
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_cursor_next(
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_cursor_get_value(
+	          NULL,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_cursor_get_value(
+	          cursor,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_cursor_free(
+	          &cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	result = libcdata_btree_free(
+	          &btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	memory_free(
+	 values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cursor != NULL )
+	{
+		libcdata_btree_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 NULL,
+		 NULL );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_cursor_seek_last and libcdata_btree_cursor_previous functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_cursor_seek_last(
+     void )
+{
+	libcdata_btree_cursor_t *cursor = NULL;
+	libcdata_btree_t *btree         = NULL;
+	libcerror_error_t *error        = NULL;
+	intptr_t *value                 = NULL;
+	int *values                     = NULL;
+	int expected_value              = 0;
+	int number_of_values            = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	result = libcdata_btree_initialize(
+	          &btree,
+	          CDATA_TEST_BTREE_CURSOR_MAXIMUM_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_initialize(
+	          &cursor,
+	          btree,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with an empty tree
+	 */
+	result = libcdata_btree_cursor_seek_last(
+	          cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_get_value(
+	          cursor,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	result = libcdata_btree_cursor_previous(
+	          cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_free(
+	          &cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_free(
+	          &btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = cdata_test_btree_cursor_initialize_tree(
+	          &btree,
+	          values,
+	          CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_initialize(
+	          &cursor,
+	          btree,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cursor is not positioned before a seek
+	 */
+	result = libcdata_btree_cursor_previous(
+	          cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_seek_last(
+	          cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_value = ( CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES - 1 ) * 2;
+
+	while( result == 1 )
+	{
+		result = libcdata_btree_cursor_get_value(
+		          cursor,
+		          &value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "value",
+		 *( (int *) value ),
+		 expected_value );
+
+		expected_value -= 2;
+		number_of_values++;
+
+		result = libcdata_btree_cursor_previous(
+		          cursor,
+		          &error );
+
+		CDATA_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES );
+
+	/* The cursor is no longer positioned after the first value
+	 */
+	result = libcdata_btree_cursor_get_value(
+	          cursor,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_previous(
+	          cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_cursor_seek_last(
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_cursor_previous(
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_cursor_get_value(
+	          NULL,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_cursor_get_value(
+	          cursor,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_cursor_free(
+	          &cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	result = libcdata_btree_free(
+	          &btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	memory_free(
+	 values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cursor != NULL )
+	{
+		libcdata_btree_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 NULL,
+		 NULL );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_cursor_seek_lower_bound function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_cursor_seek_lower_bound(
+     void )
+{
+	libcdata_btree_cursor_t *cursor = NULL;
+	libcdata_btree_t *btree         = NULL;
+	libcerror_error_t *error        = NULL;
+	intptr_t *value                 = NULL;
+	int *values                     = NULL;
+	int expected_value              = 0;
+	int high_value                  = 0;
+	int low_value                   = 0;
+	int number_of_values            = 0;
+	int result                      = 0;
+	int test_value                  = 0;
+
+	/* Initialize test
+	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	result = cdata_test_btree_cursor_initialize_tree(
+	          &btree,
+	          values,
+	          CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_initialize(
+	          &cursor,
+	          btree,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The tree contains the even values, hence the lower bound of an odd value is the next even value
+	 */
+	for( test_value = -1;
+	     test_value < ( ( CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES - 1 ) * 2 );
+	     test_value += 7 )
+	{
+		result = libcdata_btree_cursor_seek_lower_bound(
+		          cursor,
+		          (intptr_t *) &test_value,
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_cursor_value_compare_function,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_btree_cursor_get_value(
+		          cursor,
+		          &value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "value",
+		 *( (int *) value ),
+		 ( test_value + 1 ) & ~1 );
+	}
+	/* Test a range scan of the values in [low, high)
+	 */
+	low_value  = 1001;
+	high_value = 2000;
+
+	result = libcdata_btree_cursor_seek_lower_bound(
+	          cursor,
+	          (intptr_t *) &low_value,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_cursor_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_value = 1002;
+
+	while( result == 1 )
+	{
+		result = libcdata_btree_cursor_get_value(
+		          cursor,
+		          &value,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( *( (int *) value ) >= high_value )
+		{
+			break;
+		}
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "value",
+		 *( (int *) value ),
+		 expected_value );
+
+		expected_value += 2;
+		number_of_values++;
+
+		result = libcdata_btree_cursor_next(
+		          cursor,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 499 );
+
+	/* Test a value greater than the last value
+	 */
+	test_value = CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES * 2;
+
+	result = libcdata_btree_cursor_seek_lower_bound(
+	          cursor,
+	          (intptr_t *) &test_value,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_cursor_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_cursor_get_value(
+	          cursor,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_cursor_seek_lower_bound(
+	          NULL,
+	          (intptr_t *) &test_value,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_cursor_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_cursor_seek_lower_bound(
+	          cursor,
+	          (intptr_t *) &test_value,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_cursor_free(
+	          &cursor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	result = libcdata_btree_free(
+	          &btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	memory_free(
+	 values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cursor != NULL )
+	{
+		libcdata_btree_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 NULL,
+		 NULL );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+/* Tests the libcdata_internal_btree_cursor_get_first_leaf_node function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_internal_btree_cursor_get_first_leaf_node(
+     void )
+{
+	libcdata_btree_t *btree         = NULL;
+	libcdata_tree_node_t *leaf_node = NULL;
+	libcdata_tree_node_t *node      = NULL;
+	libcerror_error_t *error        = NULL;
+	int *values                     = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	result = cdata_test_btree_cursor_initialize_tree(
+	          &btree,
+	          values,
+	          CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_internal_btree_cursor_get_first_leaf_node(
+	          ( (libcdata_internal_btree_t *) btree )->root_node,
+	          &leaf_node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "leaf_node",
+	 leaf_node );
+
+	result = libcdata_internal_btree_cursor_get_next_leaf_node(
+	          leaf_node,
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_internal_btree_cursor_get_previous_leaf_node(
+	          leaf_node,
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	/* Test error cases
+	 */
+	result = libcdata_internal_btree_cursor_get_first_leaf_node(
+	          ( (libcdata_internal_btree_t *) btree )->root_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_internal_btree_cursor_get_first_leaf_node(
+	          NULL,
+	          &leaf_node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	memory_free(
+	 values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 NULL,
+		 NULL );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_internal_btree_cursor_get_last_leaf_node function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_internal_btree_cursor_get_last_leaf_node(
+     void )
+{
+	libcdata_btree_t *btree         = NULL;
+	libcdata_tree_node_t *leaf_node = NULL;
+	libcdata_tree_node_t *node      = NULL;
+	libcerror_error_t *error        = NULL;
+	int *values                     = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	result = cdata_test_btree_cursor_initialize_tree(
+	          &btree,
+	          values,
+	          CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_internal_btree_cursor_get_last_leaf_node(
+	          ( (libcdata_internal_btree_t *) btree )->root_node,
+	          &leaf_node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "leaf_node",
+	 leaf_node );
+
+	result = libcdata_internal_btree_cursor_get_previous_leaf_node(
+	          leaf_node,
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_internal_btree_cursor_get_next_leaf_node(
+	          leaf_node,
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	/* Test error cases
+	 */
+	result = libcdata_internal_btree_cursor_get_last_leaf_node(
+	          ( (libcdata_internal_btree_t *) btree )->root_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_internal_btree_cursor_get_last_leaf_node(
+	          NULL,
+	          &leaf_node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	memory_free(
+	 values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 NULL,
+		 NULL );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_internal_btree_cursor_get_next_leaf_node function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_internal_btree_cursor_get_next_leaf_node(
+     void )
+{
+	libcdata_btree_t *btree           = NULL;
+	libcdata_tree_node_t *leaf_node   = NULL;
+	libcdata_tree_node_t *node        = NULL;
+	libcerror_error_t *error          = NULL;
+	int *values                       = NULL;
+	int expected_number_of_leaf_nodes = 0;
+	int height                        = 0;
+	int number_of_leaf_nodes          = 0;
+	int number_of_nodes               = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	result = cdata_test_btree_cursor_initialize_tree(
+	          &btree,
+	          values,
+	          CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_internal_btree_cursor_get_first_leaf_node(
+	          ( (libcdata_internal_btree_t *) btree )->root_node,
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	while( node != NULL )
+	{
+		number_of_leaf_nodes++;
+
+		result = libcdata_internal_btree_cursor_get_next_leaf_node(
+		          node,
+		          &leaf_node,
+		          &error );
+
+		CDATA_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		node = leaf_node;
+	}
+	result = libcdata_btree_get_statistics(
+	          btree,
+	          &height,
+	          &number_of_nodes,
+	          &expected_number_of_leaf_nodes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_nodes",
+	 number_of_leaf_nodes,
+	 expected_number_of_leaf_nodes );
+
+	/* Test error cases
+	 */
+	result = libcdata_internal_btree_cursor_get_next_leaf_node(
+	          ( (libcdata_internal_btree_t *) btree )->root_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	memory_free(
+	 values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 NULL,
+		 NULL );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_internal_btree_cursor_get_previous_leaf_node function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_internal_btree_cursor_get_previous_leaf_node(
+     void )
+{
+	libcdata_btree_t *btree           = NULL;
+	libcdata_tree_node_t *leaf_node   = NULL;
+	libcdata_tree_node_t *node        = NULL;
+	libcerror_error_t *error          = NULL;
+	int *values                       = NULL;
+	int expected_number_of_leaf_nodes = 0;
+	int height                        = 0;
+	int number_of_leaf_nodes          = 0;
+	int number_of_nodes               = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	values = (int *) memory_allocate(
+	                  sizeof( int ) * CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	result = cdata_test_btree_cursor_initialize_tree(
+	          &btree,
+	          values,
+	          CDATA_TEST_BTREE_CURSOR_NUMBER_OF_VALUES,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_internal_btree_cursor_get_last_leaf_node(
+	          ( (libcdata_internal_btree_t *) btree )->root_node,
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	while( node != NULL )
+	{
+		number_of_leaf_nodes++;
+
+		result = libcdata_internal_btree_cursor_get_previous_leaf_node(
+		          node,
+		          &leaf_node,
+		          &error );
+
+		CDATA_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		node = leaf_node;
+	}
+	result = libcdata_btree_get_statistics(
+	          btree,
+	          &height,
+	          &number_of_nodes,
+	          &expected_number_of_leaf_nodes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_nodes",
+	 number_of_leaf_nodes,
+	 expected_number_of_leaf_nodes );
+
+	/* Test error cases
+	 */
+	result = libcdata_internal_btree_cursor_get_previous_leaf_node(
+	          ( (libcdata_internal_btree_t *) btree )->root_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_free(
+	          &btree,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "btree",
+	 btree );
+
+	memory_free(
+	 values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree != NULL )
+	{
+		libcdata_btree_free(
+		 &btree,
+		 NULL,
+		 NULL );
+	}
+	if( values != NULL )
+	{
+		memory_free(
+		 values );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATA_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_cursor_initialize",
+	 cdata_test_btree_cursor_initialize );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_cursor_free",
+	 cdata_test_btree_cursor_free );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_cursor_seek_first",
+	 cdata_test_btree_cursor_seek_first );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_cursor_seek_last",
+	 cdata_test_btree_cursor_seek_last );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_cursor_seek_lower_bound",
+	 cdata_test_btree_cursor_seek_lower_bound );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+	CDATA_TEST_RUN(
+	 "libcdata_internal_btree_cursor_get_first_leaf_node",
+	 cdata_test_internal_btree_cursor_get_first_leaf_node );
+
+	CDATA_TEST_RUN(
+	 "libcdata_internal_btree_cursor_get_last_leaf_node",
+	 cdata_test_internal_btree_cursor_get_last_leaf_node );
+
+	CDATA_TEST_RUN(
+	 "libcdata_internal_btree_cursor_get_next_leaf_node",
+	 cdata_test_internal_btree_cursor_get_next_leaf_node );
+
+	CDATA_TEST_RUN(
+	 "libcdata_internal_btree_cursor_get_previous_leaf_node",
+	 cdata_test_internal_btree_cursor_get_previous_leaf_node );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
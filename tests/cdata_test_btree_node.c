@@ -1,5 +1,5 @@
 /*
- * Library balanced tree type test program
+ * Library balanced tree node type test program
  *
  * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
  *
@@ -33,7 +33,7 @@
 #include "cdata_test_unused.h"
 
 #include "../libcdata/libcdata_btree_node.h"
-#include "../libcdata/libcdata_btree_values_list.h"
+#include "../libcdata/libcdata_btree_node_values.h"
 #include "../libcdata/libcdata_types.h"
 
 /* Test value compare function
@@ -81,28 +81,4088 @@ int cdata_test_btree_value_compare_function(
 
 #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
 
+/* Tests the libcdata_btree_node_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_initialize(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->maximum_number_of_values",
+	 node_values->maximum_number_of_values,
+	 4 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 0 );
+
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	node = (libcdata_tree_node_t *) 0x12345678UL;
+
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	node = NULL;
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_get_value_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_get_value_by_index(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcerror_error_t *error                  = NULL;
+	intptr_t *value                           = NULL;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_get_value_by_index(
+	          node,
+	          1,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) &value2 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_get_value_by_index(
+	          NULL,
+	          0,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_value_by_index(
+	          node,
+	          -1,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_value_by_index(
+	          node,
+	          2,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_value_by_index(
+	          node,
+	          0,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_node_values(
+	          NULL,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libcdata_btree_node_get_sub_node_by_value function
  * Returns 1 if successful or 0 if not
  */
-int cdata_test_btree_node_get_sub_node_by_value(
+int cdata_test_btree_node_get_sub_node_by_value(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+	int value_index                           = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+	int value5                                = 5;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value3,
+	          3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_get_sub_node_by_value(
+	          node,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node",
+	 (intptr_t) sub_node,
+	 (intptr_t) node_values->sub_nodes[ 0 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 0 );
+
+	result = libcdata_btree_node_get_sub_node_by_value(
+	          node,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node",
+	 (intptr_t) sub_node,
+	 (intptr_t) node_values->sub_nodes[ 0 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 0 );
+
+	result = libcdata_btree_node_get_sub_node_by_value(
+	          node,
+	          (intptr_t *) &value3,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node",
+	 (intptr_t) sub_node,
+	 (intptr_t) node_values->sub_nodes[ 1 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 -1 );
+
+	/* Test with the pointer of the value
+	 */
+	result = libcdata_btree_node_get_sub_node_by_value(
+	          node,
+	          (intptr_t *) &value2,
+	          NULL,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node",
+	 (intptr_t) sub_node,
+	 (intptr_t) node_values->sub_nodes[ 0 ] );
+
+	result = libcdata_btree_node_get_sub_node_by_value(
+	          node,
+	          (intptr_t *) &value5,
+	          NULL,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node",
+	 (intptr_t) sub_node,
+	 (intptr_t) node_values->sub_nodes[ 1 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 -1 );
+
+	/* Test with a leaf node
+	 */
+	result = libcdata_btree_node_get_sub_node_by_value(
+	          node_values->sub_nodes[ 1 ],
+	          (intptr_t *) &value4,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "sub_node",
+	 sub_node );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_get_sub_node_by_value(
+	          NULL,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_sub_node_by_value(
+	          node,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_sub_node_by_value(
+	          node,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          NULL,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_sub_node_by_value(
+	          node,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &sub_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_get_upper_node_by_value function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_get_upper_node_by_value(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcdata_tree_node_t *upper_node          = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+	int value_index                           = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+	int value5                                = 5;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value3,
+	          3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_get_upper_node_by_value(
+	          node,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "upper_node",
+	 (intptr_t) upper_node,
+	 (intptr_t) node_values->sub_nodes[ 0 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 1 );
+
+	result = libcdata_btree_node_get_upper_node_by_value(
+	          node,
+	          (intptr_t *) &value3,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "upper_node",
+	 (intptr_t) upper_node,
+	 (intptr_t) node_values->sub_nodes[ 1 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 0 );
+
+	result = libcdata_btree_node_get_upper_node_by_value(
+	          node,
+	          (intptr_t *) &value5,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "upper_node",
+	 (intptr_t) upper_node,
+	 (intptr_t) node_values->sub_nodes[ 1 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 -1 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_get_upper_node_by_value(
+	          NULL,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_upper_node_by_value(
+	          node,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_upper_node_by_value(
+	          node,
+	          (intptr_t *) &value2,
+	          NULL,
+	          &upper_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_upper_node_by_value(
+	          node,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          NULL,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_upper_node_by_value(
+	          node,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &upper_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_get_sub_node_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_get_sub_node_by_key(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+	int value_index                           = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value3,
+	          3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_get_sub_node_by_key(
+	          node,
+	          2,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node",
+	 (intptr_t) sub_node,
+	 (intptr_t) node_values->sub_nodes[ 0 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 0 );
+
+	result = libcdata_btree_node_get_sub_node_by_key(
+	          node,
+	          1,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node",
+	 (intptr_t) sub_node,
+	 (intptr_t) node_values->sub_nodes[ 0 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 0 );
+
+	result = libcdata_btree_node_get_sub_node_by_key(
+	          node,
+	          3,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node",
+	 (intptr_t) sub_node,
+	 (intptr_t) node_values->sub_nodes[ 1 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 -1 );
+
+	/* Test with a leaf node
+	 */
+	result = libcdata_btree_node_get_sub_node_by_key(
+	          node_values->sub_nodes[ 1 ],
+	          4,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "sub_node",
+	 sub_node );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_get_sub_node_by_key(
+	          NULL,
+	          2,
+	          &sub_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_sub_node_by_key(
+	          node,
+	          2,
+	          NULL,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_sub_node_by_key(
+	          node,
+	          2,
+	          &sub_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_get_upper_node_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_get_upper_node_by_key(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcdata_tree_node_t *upper_node          = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+	int value_index                           = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value3,
+	          3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_get_upper_node_by_key(
+	          node,
+	          2,
+	          &upper_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "upper_node",
+	 (intptr_t) upper_node,
+	 (intptr_t) node_values->sub_nodes[ 0 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 1 );
+
+	result = libcdata_btree_node_get_upper_node_by_key(
+	          node,
+	          3,
+	          &upper_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "upper_node",
+	 (intptr_t) upper_node,
+	 (intptr_t) node_values->sub_nodes[ 1 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 0 );
+
+	result = libcdata_btree_node_get_upper_node_by_key(
+	          node,
+	          5,
+	          &upper_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "upper_node",
+	 (intptr_t) upper_node,
+	 (intptr_t) node_values->sub_nodes[ 1 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 -1 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_get_upper_node_by_key(
+	          NULL,
+	          2,
+	          &upper_node,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_upper_node_by_key(
+	          node,
+	          2,
+	          NULL,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_upper_node_by_key(
+	          node,
+	          2,
+	          &upper_node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_get_value_by_rank function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_get_value_by_rank(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcerror_error_t *error                  = NULL;
+	intptr_t *value                           = NULL;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value3,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value4,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_get_value_by_rank(
+	          node,
+	          0,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) &value1 );
+
+	result = libcdata_btree_node_get_value_by_rank(
+	          node,
+	          1,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) &value2 );
+
+	result = libcdata_btree_node_get_value_by_rank(
+	          node,
+	          2,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) &value3 );
+
+	result = libcdata_btree_node_get_value_by_rank(
+	          node,
+	          3,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) &value4 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_get_value_by_rank(
+	          NULL,
+	          0,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_value_by_rank(
+	          node,
+	          -1,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_value_by_rank(
+	          node,
+	          4,
+	          &value,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_value_by_rank(
+	          node,
+	          0,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_get_rank_of_value function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_get_rank_of_value(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcerror_error_t *error                  = NULL;
+	int rank                                  = 0;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+	int value5                                = 5;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value3,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value4,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_get_rank_of_value(
+	          node,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &rank,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "rank",
+	 rank,
+	 0 );
+
+	result = libcdata_btree_node_get_rank_of_value(
+	          node,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &rank,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "rank",
+	 rank,
+	 1 );
+
+	result = libcdata_btree_node_get_rank_of_value(
+	          node,
+	          (intptr_t *) &value3,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &rank,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "rank",
+	 rank,
+	 2 );
+
+	result = libcdata_btree_node_get_rank_of_value(
+	          node,
+	          (intptr_t *) &value4,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &rank,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "rank",
+	 rank,
+	 3 );
+
+	/* Test with a value that does not exist
+	 */
+	result = libcdata_btree_node_get_rank_of_value(
+	          node,
+	          (intptr_t *) &value5,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &rank,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "rank",
+	 rank,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_get_rank_of_value(
+	          NULL,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &rank,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_rank_of_value(
+	          node,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &rank,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_rank_of_value(
+	          node,
+	          (intptr_t *) &value1,
+	          NULL,
+	          &rank,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_get_rank_of_value(
+	          node,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_append_value function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_append_value(
+     void )
+{
+	libcdata_tree_node_t *node = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+	int value1                 = 1;
+	int value2                 = 2;
+	int value3                 = 3;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_append_value(
+	          NULL,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          NULL,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test appending more values than the node can contain
+	 */
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value3,
+	          3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_update_number_of_leaf_values function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_update_number_of_leaf_values(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value3,
+	          3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_update_number_of_leaf_values(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_leaf_values",
+	 node_values->number_of_leaf_values,
+	 3 );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_update_number_of_leaf_values(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_leaf_values",
+	 node_values->number_of_leaf_values,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_update_number_of_leaf_values(
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_adjust_number_of_leaf_values function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_adjust_number_of_leaf_values(
+     void )
+{
+	libcdata_btree_node_values_t *node_values     = NULL;
+	libcdata_btree_node_values_t *sub_node_values = NULL;
+	libcdata_tree_node_t *node                    = NULL;
+	libcerror_error_t *error                      = NULL;
+	int result                                    = 0;
+	int value1                                    = 1;
+	int value2                                    = 2;
+	int value3                                    = 3;
+	int value4                                    = 4;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value3,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value4,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_leaf_values",
+	 node_values->number_of_leaf_values,
+	 4 );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_adjust_number_of_leaf_values(
+	          node_values->sub_nodes[ 0 ],
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node_values->sub_nodes[ 0 ],
+	          &sub_node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_leaf_values",
+	 sub_node_values->number_of_leaf_values,
+	 4 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_leaf_values",
+	 node_values->number_of_leaf_values,
+	 6 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_adjust_number_of_leaf_values(
+	          NULL,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_insert_value function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_insert_value(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+	int value5                                = 5;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value3,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 3 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 1 ]",
+	 (intptr_t) node_values->values[ 1 ],
+	 (intptr_t) &value2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 2 ]",
+	 (intptr_t) node_values->values[ 2 ],
+	 (intptr_t) &value3 );
+
+	/* Test with an existing value
+	 */
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_insert_value(
+	          NULL,
+	          (intptr_t *) &value4,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value4,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a node with sub nodes
+	 */
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value4,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value(
+	          node,
+	          (intptr_t *) &value5,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_insert_value_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_insert_value_by_key(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+	int value5                                = 5;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_insert_value_by_key(
+	          node,
+	          3,
+	          (intptr_t *) &value3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value_by_key(
+	          node,
+	          1,
+	          (intptr_t *) &value1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value_by_key(
+	          node,
+	          2,
+	          (intptr_t *) &value2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 3 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_leaf_values",
+	 node_values->number_of_leaf_values,
+	 3 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->keys[ 0 ]",
+	 (int) node_values->keys[ 0 ],
+	 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 1 ]",
+	 (intptr_t) node_values->values[ 1 ],
+	 (intptr_t) &value2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->keys[ 1 ]",
+	 (int) node_values->keys[ 1 ],
+	 2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 2 ]",
+	 (intptr_t) node_values->values[ 2 ],
+	 (intptr_t) &value3 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->keys[ 2 ]",
+	 (int) node_values->keys[ 2 ],
+	 3 );
+
+	/* Test with an existing key
+	 */
+	result = libcdata_btree_node_insert_value_by_key(
+	          node,
+	          2,
+	          (intptr_t *) &value4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_insert_value_by_key(
+	          NULL,
+	          4,
+	          (intptr_t *) &value4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_insert_value_by_key(
+	          node,
+	          4,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a node with sub nodes
+	 */
+	result = libcdata_btree_node_insert_value_by_key(
+	          node,
+	          4,
+	          (intptr_t *) &value4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_insert_value_by_key(
+	          node,
+	          5,
+	          (intptr_t *) &value5,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_replace_value function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_replace_value(
+     void )
+{
+	libcdata_btree_node_values_t *node_values     = NULL;
+	libcdata_btree_node_values_t *sub_node_values = NULL;
+	libcdata_tree_node_t *node                    = NULL;
+	libcerror_error_t *error                      = NULL;
+	int replacement_value                         = 2;
+	int result                                    = 0;
+	int value1                                    = 1;
+	int value2                                    = 2;
+	int value3                                    = 3;
+	int value4                                    = 4;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value3,
+	          3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_get_node_values(
+	          node_values->sub_nodes[ 0 ],
+	          &sub_node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_replace_value(
+	          node_values->sub_nodes[ 0 ],
+	          (intptr_t *) &value2,
+	          (intptr_t *) &replacement_value,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node_values->values[ 1 ]",
+	 (intptr_t) sub_node_values->values[ 1 ],
+	 (intptr_t) &replacement_value );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &replacement_value );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->keys[ 0 ]",
+	 (int) node_values->keys[ 0 ],
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_replace_value(
+	          NULL,
+	          (intptr_t *) &value1,
+	          (intptr_t *) &replacement_value,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_replace_value(
+	          node,
+	          NULL,
+	          (intptr_t *) &replacement_value,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_replace_value(
+	          node,
+	          (intptr_t *) &value1,
+	          NULL,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_flatten_node function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_flatten_node(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	libcerror_error_t *error                  = NULL;
+	int number_of_sub_nodes                   = 0;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_initialize(
+	          &sub_node,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          sub_node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          sub_node,
+	          (intptr_t *) &value2,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_sub_node(
+	          node,
+	          sub_node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	sub_node = NULL;
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_flatten_node(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_sub_nodes",
+	 node_values->number_of_sub_nodes,
+	 0 );
+
+	result = libcdata_tree_node_get_number_of_sub_nodes(
+	          node,
+	          &number_of_sub_nodes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_nodes",
+	 number_of_sub_nodes,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_flatten_node(
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a node without a single sub node
+	 */
+	result = libcdata_btree_node_flatten_node(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &sub_node,
+		 NULL );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_remove_sub_node function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_remove_sub_node(
      void )
 {
-	libcdata_list_t *values_list1                 = NULL;
-	libcdata_list_element_t *values_list_element  = NULL;
-	libcdata_list_element_t *values_list_element1 = NULL;
-	libcdata_tree_node_t *node                    = NULL;
-	libcdata_tree_node_t *sub_node                = NULL;
-	libcdata_tree_node_t *sub_node1               = NULL;
-	libcdata_tree_node_t *sub_node2               = NULL;
-	libcerror_error_t *error                      = NULL;
-	int result                                    = 0;
-	int value1                                    = 1;
-	int value2                                    = 2;
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcerror_error_t *error                  = NULL;
+	int number_of_sub_nodes                   = 0;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
 
 	/* Initialize test
 	 */
-	result = libcdata_tree_node_initialize(
+	result = libcdata_btree_node_initialize(
 	          &node,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -110,45 +4170,63 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	 result,
 	 1 );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "node",
 	 node );
 
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases - with value compare function on node without value list elements and sub nodes
-	 */
-	result = libcdata_btree_node_get_sub_node_by_value(
+	result = libcdata_btree_node_append_value(
 	          node,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &sub_node,
-	          &values_list_element,
+	          (intptr_t *) &value2,
+	          2,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
-	 "sub_node",
-	 sub_node );
+	 "error",
+	 error );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "values_list_element",
-	 values_list_element );
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value3,
+	          3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libcdata_list_initialize(
-	          &values_list1,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -156,16 +4234,12 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list1",
-	 values_list1 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_initialize(
-	          &values_list_element1,
+	result = libcdata_btree_node_split(
+	          node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -173,17 +4247,13 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list_element1",
-	 values_list_element1 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_set_value(
-	          values_list_element1,
-	          (intptr_t *) &value1,
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -195,9 +4265,11 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	 "error",
 	 error );
 
-	result = libcdata_list_append_element(
-	          values_list1,
-	          values_list_element1,
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_remove_sub_node(
+	          node,
+	          1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -209,11 +4281,14 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	 "error",
 	 error );
 
-	values_list_element1 = NULL;
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_sub_nodes",
+	 node_values->number_of_sub_nodes,
+	 1 );
 
-	result = libcdata_tree_node_set_value(
+	result = libcdata_tree_node_get_number_of_sub_nodes(
 	          node,
-	          (intptr_t *) values_list1,
+	          &number_of_sub_nodes,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -225,49 +4300,50 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	 "error",
 	 error );
 
-	values_list1 = NULL;
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_nodes",
+	 number_of_sub_nodes,
+	 1 );
 
-	result = libcdata_tree_node_initialize(
-	          &sub_node1,
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_remove_sub_node(
+	          NULL,
+	          0,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node1",
-	 sub_node1 );
-
-	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_append_node(
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_remove_sub_node(
 	          node,
-	          sub_node1,
+	          -1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	sub_node1 = NULL;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases - node where number of values list elements does not correspond with the number of sub nodes
-	 */
-	result = libcdata_btree_node_get_sub_node_by_value(
+	result = libcdata_btree_node_remove_sub_node(
 	          node,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &sub_node,
-	          &values_list_element,
+	          1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -275,14 +4351,6 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	 result,
 	 -1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "sub_node",
-	 sub_node );
-
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "values_list_element",
-	 values_list_element );
-
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -290,10 +4358,10 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	libcerror_error_free(
 	 &error );
 
-	/* Initialize test
+	/* Clean up
 	 */
-	result = libcdata_tree_node_initialize(
-	          &sub_node2,
+	result = libcdata_btree_node_free(
+	          &node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -301,17 +4369,52 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node2",
-	 sub_node2 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_append_node(
-	          node,
-	          sub_node2,
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_get_sub_node_index function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_get_sub_node_index(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+	int sub_node_index                        = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -323,16 +4426,14 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	 "error",
 	 error );
 
-	sub_node2 = NULL;
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
 
-	/* Test regular cases - with value compare function
-	 */
-	result = libcdata_btree_node_get_sub_node_by_value(
+	result = libcdata_btree_node_append_value(
 	          node,
 	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &sub_node,
-	          &values_list_element,
+	          1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -340,51 +4441,44 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node",
-	 sub_node );
-
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list_element",
-	 values_list_element );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_btree_node_get_sub_node_by_value(
+	result = libcdata_btree_node_append_value(
 	          node,
 	          (intptr_t *) &value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &sub_node,
-	          &values_list_element,
+	          2,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node",
-	 sub_node );
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
-	 "values_list_element",
-	 values_list_element );
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value3,
+	          3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases - without value compare function
-	 */
-	result = libcdata_btree_node_get_sub_node_by_value(
+	result = libcdata_btree_node_append_value(
 	          node,
-	          (intptr_t *) &value1,
-	          NULL,
-	          &sub_node,
-	          &values_list_element,
+	          (intptr_t *) &value4,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -392,71 +4486,80 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node",
-	 sub_node );
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list_element",
-	 values_list_element );
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_btree_node_get_sub_node_by_value(
+	result = libcdata_btree_node_get_node_values(
 	          node,
-	          (intptr_t *) &value2,
-	          NULL,
-	          &sub_node,
-	          &values_list_element,
+	          &node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node",
-	 sub_node );
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
-	 "values_list_element",
-	 values_list_element );
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_get_sub_node_index(
+	          node,
+	          node_values->sub_nodes[ 1 ],
+	          &sub_node_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcdata_btree_node_get_sub_node_by_value(
-	          NULL,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &sub_node,
-	          &values_list_element,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_index",
+	 sub_node_index,
+	 1 );
+
+	result = libcdata_btree_node_get_sub_node_index(
+	          node,
+	          node,
+	          &sub_node_index,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcdata_btree_node_get_sub_node_by_value(
-	          node,
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_get_sub_node_index(
 	          NULL,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &sub_node,
-	          &values_list_element,
+	          node_values->sub_nodes[ 1 ],
+	          &sub_node_index,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -471,12 +4574,10 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_node_get_sub_node_by_value(
+	result = libcdata_btree_node_get_sub_node_index(
 	          node,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
 	          NULL,
-	          &values_list_element,
+	          &sub_node_index,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -491,11 +4592,9 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_node_get_sub_node_by_value(
+	result = libcdata_btree_node_get_sub_node_index(
 	          node,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &sub_node,
+	          node_values->sub_nodes[ 1 ],
 	          NULL,
 	          &error );
 
@@ -513,9 +4612,8 @@ int cdata_test_btree_node_get_sub_node_by_value(
 
 	/* Clean up
 	 */
-	result = libcdata_tree_node_free(
+	result = libcdata_btree_node_free(
 	          &node,
-	          &libcdata_btree_values_list_free,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -523,14 +4621,14 @@ int cdata_test_btree_node_get_sub_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
 	return( 1 );
 
 on_error:
@@ -539,68 +4637,37 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( sub_node2 != NULL )
-	{
-		libcdata_tree_node_free(
-		 &sub_node2,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
-	if( sub_node1 != NULL )
-	{
-		libcdata_tree_node_free(
-		 &sub_node1,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
-	if( values_list_element1 != NULL )
-	{
-		libcdata_list_element_free(
-		 &values_list_element1,
-		 NULL,
-		 NULL );
-	}
-	if( values_list1 != NULL )
-	{
-		libcdata_list_free(
-		 &values_list1,
-		 NULL,
-		 NULL );
-	}
 	if( node != NULL )
 	{
-		libcdata_tree_node_free(
+		libcdata_btree_node_free(
 		 &node,
-		 &libcdata_btree_values_list_free,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libcdata_btree_node_get_upper_node_by_value function
+/* Tests the libcdata_btree_node_borrow_from_previous_sub_node function
  * Returns 1 if successful or 0 if not
  */
-int cdata_test_btree_node_get_upper_node_by_value(
+int cdata_test_btree_node_borrow_from_previous_sub_node(
      void )
 {
-	libcdata_list_t *values_list1                 = NULL;
-	libcdata_list_t *values_list2                 = NULL;
-	libcdata_list_element_t *values_list_element  = NULL;
-	libcdata_list_element_t *values_list_element1 = NULL;
-	libcdata_list_element_t *values_list_element2 = NULL;
+	libcdata_btree_node_values_t *node_values     = NULL;
+	libcdata_btree_node_values_t *sub_node_values = NULL;
 	libcdata_tree_node_t *node                    = NULL;
-	libcdata_tree_node_t *sub_node1               = NULL;
-	libcdata_tree_node_t *sub_node2               = NULL;
-	libcdata_tree_node_t *upper_node              = NULL;
 	libcerror_error_t *error                      = NULL;
 	int result                                    = 0;
 	int value1                                    = 1;
 	int value2                                    = 2;
+	int value3                                    = 3;
+	int value4                                    = 4;
+	int value5                                    = 5;
 
 	/* Initialize test
 	 */
-	result = libcdata_tree_node_initialize(
+	result = libcdata_btree_node_initialize(
 	          &node,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -608,16 +4675,18 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_initialize(
-	          &values_list1,
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -625,16 +4694,14 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list1",
-	 values_list1 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_initialize(
-	          &values_list_element1,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -642,17 +4709,14 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list_element1",
-	 values_list_element1 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_set_value(
-	          values_list_element1,
-	          (intptr_t *) &value1,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value3,
+	          3,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -664,9 +4728,10 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 "error",
 	 error );
 
-	result = libcdata_list_append_element(
-	          values_list1,
-	          values_list_element1,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -678,11 +4743,10 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 "error",
 	 error );
 
-	values_list_element1 = NULL;
-
-	result = libcdata_tree_node_set_value(
+	result = libcdata_btree_node_append_value(
 	          node,
-	          (intptr_t *) values_list1,
+	          (intptr_t *) &value5,
+	          5,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -694,10 +4758,8 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 "error",
 	 error );
 
-	values_list1 = NULL;
-
-	result = libcdata_tree_node_initialize(
-	          &sub_node1,
+	result = libcdata_btree_node_split(
+	          node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -705,16 +4767,13 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node1",
-	 sub_node1 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_initialize(
-	          &values_list2,
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -722,16 +4781,15 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list2",
-	 values_list2 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_initialize(
-	          &values_list_element2,
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_borrow_from_previous_sub_node(
+	          node,
+	          1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -739,17 +4797,18 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list_element2",
-	 values_list_element2 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_set_value(
-	          values_list_element2,
-	          (intptr_t *) &value1,
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value2 );
+
+	result = libcdata_btree_node_get_node_values(
+	          node_values->sub_nodes[ 0 ],
+	          &sub_node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -761,9 +4820,14 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 "error",
 	 error );
 
-	result = libcdata_list_append_element(
-	          values_list2,
-	          values_list_element2,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_values",
+	 sub_node_values->number_of_values,
+	 2 );
+
+	result = libcdata_btree_node_get_node_values(
+	          node_values->sub_nodes[ 1 ],
+	          &sub_node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -775,48 +4839,55 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 "error",
 	 error );
 
-	values_list_element2 = NULL;
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_values",
+	 sub_node_values->number_of_values,
+	 3 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node_values->values[ 0 ]",
+	 (intptr_t) sub_node_values->values[ 0 ],
+	 (intptr_t) &value3 );
 
-	result = libcdata_tree_node_set_value(
-	          sub_node1,
-	          (intptr_t *) values_list2,
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_borrow_from_previous_sub_node(
+	          NULL,
+	          1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	values_list2 = NULL;
+	libcerror_error_free(
+	 &error );
 
-	result = libcdata_tree_node_append_node(
+	result = libcdata_btree_node_borrow_from_previous_sub_node(
 	          node,
-	          sub_node1,
+	          0,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	sub_node1 = NULL;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases - node where number of values list elements does not correspond with the number of sub nodes
-	 */
-	result = libcdata_btree_node_get_upper_node_by_value(
+	result = libcdata_btree_node_borrow_from_previous_sub_node(
 	          node,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &values_list_element,
+	          2,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -824,14 +4895,6 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 result,
 	 -1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "upper_node",
-	 upper_node );
-
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "values_list_element",
-	 values_list_element );
-
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -839,10 +4902,64 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_borrow_from_next_sub_node function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_borrow_from_next_sub_node(
+     void )
+{
+	libcdata_btree_node_values_t *node_values     = NULL;
+	libcdata_btree_node_values_t *sub_node_values = NULL;
+	libcdata_tree_node_t *node                    = NULL;
+	libcerror_error_t *error                      = NULL;
+	int result                                    = 0;
+	int value1                                    = 1;
+	int value2                                    = 2;
+	int value3                                    = 3;
+	int value4                                    = 4;
+	int value5                                    = 5;
+
 	/* Initialize test
 	 */
-	result = libcdata_tree_node_initialize(
-	          &sub_node2,
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -850,17 +4967,33 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 result,
 	 1 );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node2",
-	 sub_node2 );
+	 "node",
+	 node );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_append_node(
+	result = libcdata_btree_node_append_value(
 	          node,
-	          sub_node2,
+	          (intptr_t *) &value2,
+	          2,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -872,16 +5005,10 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 "error",
 	 error );
 
-	sub_node2 = NULL;
-
-	/* Test regular cases
-	 */
-	result = libcdata_btree_node_get_upper_node_by_value(
+	result = libcdata_btree_node_append_value(
 	          node,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &values_list_element,
+	          (intptr_t *) &value3,
+	          3,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -889,72 +5016,136 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "upper_node",
-	 upper_node );
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list_element",
-	 values_list_element );
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_btree_node_get_upper_node_by_value(
+	result = libcdata_btree_node_append_value(
 	          node,
-	          (intptr_t *) &value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &values_list_element,
+	          (intptr_t *) &value5,
+	          5,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-/* TODO update docstring to indicate upper_node is set when value is not available */
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "upper_node",
-	 upper_node );
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
-	 "values_list_element",
-	 values_list_element );
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libcdata_btree_node_get_upper_node_by_value(
-	          NULL,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &values_list_element,
+	result = libcdata_btree_node_borrow_from_next_sub_node(
+	          node,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value4 );
+
+	result = libcdata_btree_node_get_node_values(
+	          node_values->sub_nodes[ 0 ],
+	          &sub_node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_values",
+	 sub_node_values->number_of_values,
+	 4 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node_values->values[ 3 ]",
+	 (intptr_t) sub_node_values->values[ 3 ],
+	 (intptr_t) &value4 );
+
+	result = libcdata_btree_node_get_node_values(
+	          node_values->sub_nodes[ 1 ],
+	          &sub_node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_values",
+	 sub_node_values->number_of_values,
+	 1 );
 
-	result = libcdata_btree_node_get_upper_node_by_value(
-	          node,
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_borrow_from_next_sub_node(
 	          NULL,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          &values_list_element,
+	          0,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -969,12 +5160,9 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_node_get_upper_node_by_value(
+	result = libcdata_btree_node_borrow_from_next_sub_node(
 	          node,
-	          (intptr_t *) &value1,
-	          NULL,
-	          &upper_node,
-	          &values_list_element,
+	          -1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -989,12 +5177,9 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_node_get_upper_node_by_value(
+	result = libcdata_btree_node_borrow_from_next_sub_node(
 	          node,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          NULL,
-	          &values_list_element,
+	          1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1009,12 +5194,11 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_node_get_upper_node_by_value(
+	/* Test with a next sub node with less than 2 values
+	 */
+	result = libcdata_btree_node_borrow_from_next_sub_node(
 	          node,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
-	          &upper_node,
-	          NULL,
+	          0,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1031,9 +5215,8 @@ int cdata_test_btree_node_get_upper_node_by_value(
 
 	/* Clean up
 	 */
-	result = libcdata_tree_node_free(
+	result = libcdata_btree_node_free(
 	          &node,
-	          &libcdata_btree_values_list_free,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1041,14 +5224,14 @@ int cdata_test_btree_node_get_upper_node_by_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
 	return( 1 );
 
 on_error:
@@ -1057,81 +5240,37 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( sub_node2 != NULL )
-	{
-		libcdata_tree_node_free(
-		 &sub_node2,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
-	if( values_list_element2 != NULL )
-	{
-		libcdata_list_element_free(
-		 &values_list_element2,
-		 NULL,
-		 NULL );
-	}
-	if( values_list2 != NULL )
-	{
-		libcdata_list_free(
-		 &values_list2,
-		 NULL,
-		 NULL );
-	}
-	if( sub_node1 != NULL )
-	{
-		libcdata_tree_node_free(
-		 &sub_node1,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
-	if( values_list_element1 != NULL )
-	{
-		libcdata_list_element_free(
-		 &values_list_element1,
-		 NULL,
-		 NULL );
-	}
-	if( values_list1 != NULL )
-	{
-		libcdata_list_free(
-		 &values_list1,
-		 NULL,
-		 NULL );
-	}
-	if( node != NULL )
-	{
-		libcdata_tree_node_free(
-		 &node,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
 	if( node != NULL )
 	{
-		libcdata_tree_node_free(
+		libcdata_btree_node_free(
 		 &node,
-		 &libcdata_btree_values_list_free,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libcdata_btree_node_append_value function
+/* Tests the libcdata_btree_node_merge_sub_nodes function
  * Returns 1 if successful or 0 if not
  */
-int cdata_test_btree_node_append_value(
+int cdata_test_btree_node_merge_sub_nodes(
      void )
 {
-	libcdata_tree_node_t *node = NULL;
-	libcerror_error_t *error   = NULL;
-	int result                 = 0;
-	int value1                 = 1;
-	int value2                 = 2;
+	libcdata_btree_node_values_t *node_values     = NULL;
+	libcdata_btree_node_values_t *sub_node_values = NULL;
+	libcdata_tree_node_t *node                    = NULL;
+	libcerror_error_t *error                      = NULL;
+	int number_of_sub_nodes                       = 0;
+	int result                                    = 0;
+	int value1                                    = 1;
+	int value2                                    = 2;
+	int value3                                    = 3;
+	int value4                                    = 4;
 
 	/* Initialize test
 	 */
-	result = libcdata_tree_node_initialize(
+	result = libcdata_btree_node_initialize(
 	          &node,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1139,19 +5278,18 @@ int cdata_test_btree_node_append_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
 	result = libcdata_btree_node_append_value(
 	          node,
 	          (intptr_t *) &value1,
+	          1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1163,61 +5301,40 @@ int cdata_test_btree_node_append_value(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
 	result = libcdata_btree_node_append_value(
-	          NULL,
+	          node,
 	          (intptr_t *) &value2,
+	          2,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-#if defined( HAVE_CDATA_TEST_MEMORY )
-
-	/* Test libcdata_btree_node_append_value with malloc failing in libcdata_list_initialize
-	 */
-	cdata_test_malloc_attempts_before_fail = 0;
-
 	result = libcdata_btree_node_append_value(
 	          node,
-	          (intptr_t *) &value2,
+	          (intptr_t *) &value3,
+	          3,
 	          &error );
 
-	if( cdata_test_malloc_attempts_before_fail != -1 )
-	{
-		cdata_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
-		CDATA_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CDATA_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CDATA_TEST_MEMORY ) */
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Clean up
-	 */
-	result = libcdata_tree_node_free(
-	          &node,
-	          &libcdata_btree_values_list_free,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1225,49 +5342,26 @@ int cdata_test_btree_node_append_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	result = libcdata_btree_node_split(
+	          node,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( node != NULL )
-	{
-		libcdata_tree_node_free(
-		 &node,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
-	return( 0 );
-}
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libcdata_btree_node_insert_value function
- * Returns 1 if successful or 0 if not
- */
-int cdata_test_btree_node_insert_value(
-     void )
-{
-	libcdata_tree_node_t *node      = NULL;
-	libcdata_tree_node_t *sub_node1 = NULL;
-	libcerror_error_t *error        = NULL;
-	int result                      = 0;
-	int value1                      = 1;
-	int value2                      = 2;
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
-	result = libcdata_tree_node_initialize(
-	          &node,
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1275,20 +5369,15 @@ int cdata_test_btree_node_insert_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test regular cases
 	 */
-	result = libcdata_btree_node_insert_value(
+	result = libcdata_btree_node_merge_sub_nodes(
 	          node,
-	          (intptr_t *) &value1,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          0,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1300,85 +5389,98 @@ int cdata_test_btree_node_insert_value(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcdata_btree_node_insert_value(
-	          NULL,
-	          (intptr_t *) &value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 0 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_sub_nodes",
+	 node_values->number_of_sub_nodes,
+	 1 );
+
+	result = libcdata_tree_node_get_number_of_sub_nodes(
+	          node,
+	          &number_of_sub_nodes,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_nodes",
+	 number_of_sub_nodes,
+	 1 );
 
-	result = libcdata_btree_node_insert_value(
-	          node,
-	          NULL,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	result = libcdata_btree_node_get_node_values(
+	          node_values->sub_nodes[ 0 ],
+	          &sub_node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_values",
+	 sub_node_values->number_of_values,
+	 4 );
 
-	/* Initialize test
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node_values->values[ 2 ]",
+	 (intptr_t) sub_node_values->values[ 2 ],
+	 (intptr_t) &value3 );
+
+	/* Test error cases
 	 */
-	result = libcdata_tree_node_initialize(
-	          &sub_node1,
+	result = libcdata_btree_node_merge_sub_nodes(
+	          NULL,
+	          0,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node1",
-	 sub_node1 );
-
-	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_append_node(
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_merge_sub_nodes(
 	          node,
-	          sub_node1,
+	          -1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	sub_node1 = NULL;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases - node with sub nodes
-	 */
-	result = libcdata_btree_node_insert_value(
+	result = libcdata_btree_node_merge_sub_nodes(
 	          node,
-	          (intptr_t *) &value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_value_compare_function,
+	          0,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1395,9 +5497,8 @@ int cdata_test_btree_node_insert_value(
 
 	/* Clean up
 	 */
-	result = libcdata_tree_node_free(
+	result = libcdata_btree_node_free(
 	          &node,
-	          &libcdata_btree_values_list_free,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1405,14 +5506,14 @@ int cdata_test_btree_node_insert_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
 	return( 1 );
 
 on_error:
@@ -1421,44 +5522,37 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( sub_node1 != NULL )
-	{
-		libcdata_tree_node_free(
-		 &sub_node1,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
 	if( node != NULL )
 	{
-		libcdata_tree_node_free(
+		libcdata_btree_node_free(
 		 &node,
-		 &libcdata_btree_values_list_free,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libcdata_btree_node_replace_value function
+/* Tests the libcdata_btree_node_rebalance_sub_node function
  * Returns 1 if successful or 0 if not
  */
-int cdata_test_btree_node_replace_value(
+int cdata_test_btree_node_rebalance_sub_node(
      void )
 {
-	libcdata_list_t *values_list1                 = NULL;
-	libcdata_list_element_t *values_list_element1 = NULL;
-	libcdata_tree_node_t *node                    = NULL;
-	libcdata_tree_node_t *sub_node1               = NULL;
-	libcdata_tree_node_t *sub_node2               = NULL;
-	libcerror_error_t *error                      = NULL;
-	int replacement_value                         = 99;
-	int result                                    = 0;
-	int value1                                    = 1;
-	int value2                                    = 2;
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+	int value5                                = 5;
 
 	/* Initialize test
 	 */
-	result = libcdata_tree_node_initialize(
+	result = libcdata_btree_node_initialize(
 	          &node,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1466,33 +5560,48 @@ int cdata_test_btree_node_replace_value(
 	 result,
 	 1 );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "node",
 	 node );
 
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_initialize(
-	          &values_list1,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list1",
-	 values_list1 );
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_initialize(
-	          &values_list_element1,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value3,
+	          3,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1500,17 +5609,14 @@ int cdata_test_btree_node_replace_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list_element1",
-	 values_list_element1 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_set_value(
-	          values_list_element1,
-	          (intptr_t *) &value1,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1522,9 +5628,10 @@ int cdata_test_btree_node_replace_value(
 	 "error",
 	 error );
 
-	result = libcdata_list_append_element(
-	          values_list1,
-	          values_list_element1,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value5,
+	          5,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1536,11 +5643,8 @@ int cdata_test_btree_node_replace_value(
 	 "error",
 	 error );
 
-	values_list_element1 = NULL;
-
-	result = libcdata_tree_node_set_value(
+	result = libcdata_btree_node_split(
 	          node,
-	          (intptr_t *) values_list1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1552,10 +5656,9 @@ int cdata_test_btree_node_replace_value(
 	 "error",
 	 error );
 
-	values_list1 = NULL;
-
-	result = libcdata_tree_node_initialize(
-	          &sub_node1,
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1563,17 +5666,18 @@ int cdata_test_btree_node_replace_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node1",
-	 sub_node1 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_append_node(
+	/* Test regular cases
+	 */
+	/* Rebalance with a previous sub node that contains more than the minimum number of values
+	 */
+	result = libcdata_btree_node_rebalance_sub_node(
 	          node,
-	          sub_node1,
+	          1,
+	          &sub_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1585,32 +5689,48 @@ int cdata_test_btree_node_replace_value(
 	 "error",
 	 error );
 
-	sub_node1 = NULL;
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node",
+	 (intptr_t) sub_node,
+	 (intptr_t) node_values->sub_nodes[ 1 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value2 );
 
-	/* Test error cases - node where number of values list elements does not correspond with the number of sub nodes
+	/* Rebalance with a next sub node that contains more than the minimum number of values
 	 */
-	result = libcdata_btree_node_replace_value(
+	result = libcdata_btree_node_rebalance_sub_node(
 	          node,
-	          (intptr_t *) &value1,
-	          (intptr_t *) &replacement_value,
+	          0,
+	          &sub_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node",
+	 (intptr_t) sub_node,
+	 (intptr_t) node_values->sub_nodes[ 0 ] );
 
-	/* Initialize test
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value3 );
+
+	/* Rebalance with a sibling sub node that contains the minimum number of values
 	 */
-	result = libcdata_tree_node_initialize(
-	          &sub_node2,
+	result = libcdata_btree_node_borrow_from_previous_sub_node(
+	          node,
+	          1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1618,17 +5738,14 @@ int cdata_test_btree_node_replace_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node2",
-	 sub_node2 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_append_node(
+	result = libcdata_btree_node_rebalance_sub_node(
 	          node,
-	          sub_node2,
+	          1,
+	          &sub_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1640,32 +5757,40 @@ int cdata_test_btree_node_replace_value(
 	 "error",
 	 error );
 
-	sub_node2 = NULL;
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node",
+	 (intptr_t) sub_node,
+	 (intptr_t) node_values->sub_nodes[ 0 ] );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_sub_nodes",
+	 node_values->number_of_sub_nodes,
+	 1 );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libcdata_btree_node_replace_value(
-	          node,
-	          (intptr_t *) &value1,
-	          (intptr_t *) &replacement_value,
+	result = libcdata_btree_node_rebalance_sub_node(
+	          NULL,
+	          0,
+	          &sub_node,
 	          &error );
 
-/* TODO determine if function should return 0 for non-existing value instead */
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcdata_btree_node_replace_value(
-	          NULL,
-	          (intptr_t *) &value2,
-	          (intptr_t *) &replacement_value,
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_rebalance_sub_node(
+	          node,
+	          -1,
+	          &sub_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1680,10 +5805,10 @@ int cdata_test_btree_node_replace_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_node_replace_value(
+	result = libcdata_btree_node_rebalance_sub_node(
 	          node,
-	          NULL,
-	          (intptr_t *) &replacement_value,
+	          1,
+	          &sub_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1698,9 +5823,9 @@ int cdata_test_btree_node_replace_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_node_replace_value(
+	result = libcdata_btree_node_rebalance_sub_node(
 	          node,
-	          (intptr_t *) &value1,
+	          0,
 	          NULL,
 	          &error );
 
@@ -1718,9 +5843,8 @@ int cdata_test_btree_node_replace_value(
 
 	/* Clean up
 	 */
-	result = libcdata_tree_node_free(
+	result = libcdata_btree_node_free(
 	          &node,
-	          &libcdata_btree_values_list_free,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1728,14 +5852,14 @@ int cdata_test_btree_node_replace_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
 	return( 1 );
 
 on_error:
@@ -1744,39 +5868,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( sub_node2 != NULL )
-	{
-		libcdata_tree_node_free(
-		 &sub_node2,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
-	if( sub_node1 != NULL )
-	{
-		libcdata_tree_node_free(
-		 &sub_node1,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
-	if( values_list_element1 != NULL )
-	{
-		libcdata_list_element_free(
-		 &values_list_element1,
-		 NULL,
-		 NULL );
-	}
-	if( values_list1 != NULL )
-	{
-		libcdata_list_free(
-		 &values_list1,
-		 NULL,
-		 NULL );
-	}
 	if( node != NULL )
 	{
-		libcdata_tree_node_free(
+		libcdata_btree_node_free(
 		 &node,
-		 &libcdata_btree_values_list_free,
 		 NULL );
 	}
 	return( 0 );
@@ -1788,23 +5883,22 @@ on_error:
 int cdata_test_btree_node_remove_value(
      void )
 {
-	libcdata_list_t *values_list1                 = NULL;
-	libcdata_list_t *values_list2                 = NULL;
-	libcdata_list_element_t *values_list_element1 = NULL;
-	libcdata_list_element_t *values_list_element2 = NULL;
-	libcdata_tree_node_t *node                    = NULL;
-	libcdata_tree_node_t *sub_node1               = NULL;
-	libcdata_tree_node_t *sub_node2               = NULL;
-	libcerror_error_t *error                      = NULL;
-	int replacement_value                         = 99;
-	int result                                    = 0;
-	int value1                                    = 1;
-	int value2                                    = 2;
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcdata_tree_node_t *sub_node            = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+	int value5                                = 5;
 
 	/* Initialize test
 	 */
-	result = libcdata_tree_node_initialize(
+	result = libcdata_btree_node_initialize(
 	          &node,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1812,16 +5906,33 @@ int cdata_test_btree_node_remove_value(
 	 result,
 	 1 );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "node",
 	 node );
 
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_initialize(
-	          &values_list1,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1829,16 +5940,29 @@ int cdata_test_btree_node_remove_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list1",
-	 values_list1 );
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value3,
+	          3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_initialize(
-	          &values_list_element1,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1846,17 +5970,27 @@ int cdata_test_btree_node_remove_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list_element1",
-	 values_list_element1 );
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value5,
+	          5,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_set_value(
-	          values_list_element1,
-	          (intptr_t *) &value1,
+	result = libcdata_btree_node_split(
+	          node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1868,9 +6002,9 @@ int cdata_test_btree_node_remove_value(
 	 "error",
 	 error );
 
-	result = libcdata_list_append_element(
-	          values_list1,
-	          values_list_element1,
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1882,11 +6016,15 @@ int cdata_test_btree_node_remove_value(
 	 "error",
 	 error );
 
-	values_list_element1 = NULL;
+	sub_node = node_values->sub_nodes[ 0 ];
 
-	result = libcdata_tree_node_set_value(
-	          node,
-	          (intptr_t *) values_list1,
+	/* Test regular cases
+	 */
+	/* Remove the last value of the first sub node, which is used as separator value
+	 */
+	result = libcdata_btree_node_remove_value(
+	          sub_node,
+	          (intptr_t *) &value3,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1898,10 +6036,21 @@ int cdata_test_btree_node_remove_value(
 	 "error",
 	 error );
 
-	values_list1 = NULL;
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 1 );
 
-	result = libcdata_tree_node_initialize(
-	          &sub_node1,
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value2 );
+
+	/* Remove a value of the first sub node, which causes the sub nodes to be merged and the node to be flattened
+	 */
+	result = libcdata_btree_node_remove_value(
+	          sub_node,
+	          (intptr_t *) &value1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1909,16 +6058,54 @@ int cdata_test_btree_node_remove_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node1",
-	 sub_node1 );
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_initialize(
-	          &values_list2,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 3 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_sub_nodes",
+	 node_values->number_of_sub_nodes,
+	 0 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 1 ]",
+	 (intptr_t) node_values->values[ 1 ],
+	 (intptr_t) &value4 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 2 ]",
+	 (intptr_t) node_values->values[ 2 ],
+	 (intptr_t) &value5 );
+
+	/* Remove a value from a leaf node
+	 */
+	result = libcdata_btree_node_remove_value(
+	          node,
+	          (intptr_t *) &value5,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1926,34 +6113,71 @@ int cdata_test_btree_node_remove_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list2",
-	 values_list2 );
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 2 );
+
+	/* Remove a value that is not stored in the node
+	 */
+	result = libcdata_btree_node_remove_value(
+	          node,
+	          (intptr_t *) &value5,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_initialize(
-	          &values_list_element2,
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_remove_value(
+	          NULL,
+	          (intptr_t *) &value4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list_element2",
-	 values_list_element2 );
+	 "error",
+	 error );
 
-	CDATA_TEST_ASSERT_IS_NULL(
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_remove_value(
+	          node,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_set_value(
-	          values_list_element2,
-	          (intptr_t *) &value1,
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_free(
+	          &node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1965,9 +6189,49 @@ int cdata_test_btree_node_remove_value(
 	 "error",
 	 error );
 
-	result = libcdata_list_append_element(
-	          values_list2,
-	          values_list_element2,
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_move_values function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_move_values(
+     void )
+{
+	libcdata_btree_node_values_t *destination_node_values = NULL;
+	libcdata_btree_node_values_t *node_values             = NULL;
+	libcdata_tree_node_t *destination_node                = NULL;
+	libcdata_tree_node_t *node                            = NULL;
+	libcerror_error_t *error                              = NULL;
+	int result                                            = 0;
+	int value1                                            = 1;
+	int value2                                            = 2;
+	int value3                                            = 3;
+	int value4                                            = 4;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1979,11 +6243,14 @@ int cdata_test_btree_node_remove_value(
 	 "error",
 	 error );
 
-	values_list_element2 = NULL;
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
 
-	result = libcdata_tree_node_set_value(
-	          sub_node1,
-	          (intptr_t *) values_list2,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -1995,11 +6262,10 @@ int cdata_test_btree_node_remove_value(
 	 "error",
 	 error );
 
-	values_list2 = NULL;
-
-	result = libcdata_tree_node_append_node(
+	result = libcdata_btree_node_append_value(
 	          node,
-	          sub_node1,
+	          (intptr_t *) &value2,
+	          2,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2011,32 +6277,25 @@ int cdata_test_btree_node_remove_value(
 	 "error",
 	 error );
 
-	sub_node1 = NULL;
-
-	/* Test error cases - node where number of values list elements does not correspond with the number of sub nodes
-	 */
-	result = libcdata_btree_node_remove_value(
+	result = libcdata_btree_node_append_value(
 	          node,
-	          (intptr_t *) &value2,
-	          (intptr_t *) &replacement_value,
+	          (intptr_t *) &value3,
+	          3,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Initialize test
-	 */
-	result = libcdata_tree_node_initialize(
-	          &sub_node2,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2044,17 +6303,13 @@ int cdata_test_btree_node_remove_value(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node2",
-	 sub_node2 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_append_node(
-	          node,
-	          sub_node2,
+	result = libcdata_btree_node_initialize(
+	          &destination_node,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2066,54 +6321,45 @@ int cdata_test_btree_node_remove_value(
 	 "error",
 	 error );
 
-	sub_node2 = NULL;
-
-	/* Test error cases - existing value and missing replacement value
+	/* Test regular cases
 	 */
-	result = libcdata_btree_node_remove_value(
+	result = libcdata_btree_node_move_values(
 	          node,
-	          (intptr_t *) &value1,
-	          NULL,
+	          2,
+	          destination_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Test regular cases - non-existing value
-	 */
-#ifdef TODO
-/* TODO fix test */
-	result = libcdata_btree_node_remove_value(
+	result = libcdata_btree_node_get_node_values(
 	          node,
-	          (intptr_t *) &value2,
-	          (intptr_t *) &replacement_value,
+	          &node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
-#endif
 
-	/* Test regular cases - existing value
-	 */
-	result = libcdata_btree_node_remove_value(
-	          node,
-	          (intptr_t *) &value1,
-	          (intptr_t *) &replacement_value,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 2 );
+
+	result = libcdata_btree_node_get_node_values(
+	          destination_node,
+	          &destination_node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2125,12 +6371,27 @@ int cdata_test_btree_node_remove_value(
 	 "error",
 	 error );
 
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "destination_node_values->number_of_values",
+	 destination_node_values->number_of_values,
+	 2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "destination_node_values->values[ 0 ]",
+	 (intptr_t) destination_node_values->values[ 0 ],
+	 (intptr_t) &value3 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "destination_node_values->values[ 1 ]",
+	 (intptr_t) destination_node_values->values[ 1 ],
+	 (intptr_t) &value4 );
+
 	/* Test error cases
 	 */
-	result = libcdata_btree_node_remove_value(
+	result = libcdata_btree_node_move_values(
 	          NULL,
-	          (intptr_t *) &value2,
-	          (intptr_t *) &replacement_value,
+	          0,
+	          destination_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2145,10 +6406,10 @@ int cdata_test_btree_node_remove_value(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdata_btree_node_remove_value(
+	result = libcdata_btree_node_move_values(
 	          node,
-	          NULL,
-	          (intptr_t *) &replacement_value,
+	          -1,
+	          destination_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2163,141 +6424,63 @@ int cdata_test_btree_node_remove_value(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libcdata_tree_node_free(
-	          &node,
-	          &libcdata_btree_values_list_free,
+	result = libcdata_btree_node_move_values(
+	          node,
+	          3,
+	          destination_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "node",
-	 node );
+	 -1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( sub_node2 != NULL )
-	{
-		libcdata_tree_node_free(
-		 &sub_node2,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
-	if( values_list_element2 != NULL )
-	{
-		libcdata_list_element_free(
-		 &values_list_element2,
-		 NULL,
-		 NULL );
-	}
-	if( values_list2 != NULL )
-	{
-		libcdata_list_free(
-		 &values_list2,
-		 NULL,
-		 NULL );
-	}
-	if( sub_node1 != NULL )
-	{
-		libcdata_tree_node_free(
-		 &sub_node1,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
-	if( values_list_element1 != NULL )
-	{
-		libcdata_list_element_free(
-		 &values_list_element1,
-		 NULL,
-		 NULL );
-	}
-	if( values_list1 != NULL )
-	{
-		libcdata_list_free(
-		 &values_list1,
-		 NULL,
-		 NULL );
-	}
-	if( node != NULL )
-	{
-		libcdata_tree_node_free(
-		 &node,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libcdata_btree_node_split function
- * Returns 1 if successful or 0 if not
- */
-int cdata_test_btree_node_split(
-     void )
-{
-	libcdata_tree_node_t *node = NULL;
-	libcerror_error_t *error   = NULL;
-	int result                 = 0;
+	libcerror_error_free(
+	 &error );
 
-	/* Initialize test
-	 */
-	result = libcdata_tree_node_initialize(
-	          &node,
+	result = libcdata_btree_node_move_values(
+	          node,
+	          0,
+	          NULL,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "node",
-	 node );
-
-	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
+	/* Clean up
 	 */
-	result = libcdata_btree_node_split(
-	          NULL,
+	result = libcdata_btree_node_free(
+	          &destination_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "destination_node",
+	 destination_node );
 
-	/* Clean up
-	 */
-	result = libcdata_tree_node_free(
+	result = libcdata_btree_node_free(
 	          &node,
-	          &libcdata_btree_values_list_free,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2305,14 +6488,14 @@ int cdata_test_btree_node_split(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
 	return( 1 );
 
 on_error:
@@ -2321,37 +6504,45 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( destination_node != NULL )
+	{
+		libcdata_btree_node_free(
+		 &destination_node,
+		 NULL );
+	}
 	if( node != NULL )
 	{
-		libcdata_tree_node_free(
+		libcdata_btree_node_free(
 		 &node,
-		 &libcdata_btree_values_list_free,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libcdata_btree_node_flatten_node function
+/* Tests the libcdata_btree_node_split function
  * Returns 1 if successful or 0 if not
  */
-int cdata_test_btree_node_flatten_node(
-    void )
+int cdata_test_btree_node_split(
+     void )
 {
-	libcdata_list_t *values_list1                 = NULL;
-	libcdata_list_t *values_list2                 = NULL;
-	libcdata_list_element_t *values_list_element1 = NULL;
-	libcdata_list_element_t *values_list_element2 = NULL;
+	libcdata_btree_node_values_t *node_values     = NULL;
+	libcdata_btree_node_values_t *sub_node_values = NULL;
 	libcdata_tree_node_t *node                    = NULL;
-	libcdata_tree_node_t *sub_node1               = NULL;
-	libcdata_tree_node_t *sub_node2               = NULL;
+	libcdata_tree_node_t *sub_node                = NULL;
 	libcerror_error_t *error                      = NULL;
+	int number_of_sub_nodes                       = 0;
 	int result                                    = 0;
 	int value1                                    = 1;
+	int value2                                    = 2;
+	int value3                                    = 3;
+	int value4                                    = 4;
+	int value5                                    = 5;
 
 	/* Initialize test
 	 */
-	result = libcdata_list_initialize(
-	          &values_list1,
+	result = libcdata_btree_node_initialize(
+	          &node,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2359,34 +6550,18 @@ int cdata_test_btree_node_flatten_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list1",
-	 values_list1 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_initialize(
-	          &values_list_element1,
-	          &error );
-
-	CDATA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list_element1",
-	 values_list_element1 );
-
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 "node",
+	 node );
 
-	result = libcdata_list_element_set_value(
-	          values_list_element1,
+	result = libcdata_btree_node_append_value(
+	          node,
 	          (intptr_t *) &value1,
+	          1,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2398,24 +6573,10 @@ int cdata_test_btree_node_flatten_node(
 	 "error",
 	 error );
 
-	result = libcdata_list_append_element(
-	          values_list1,
-	          values_list_element1,
-	          &error );
-
-	CDATA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	values_list_element1 = NULL;
-
-	result = libcdata_tree_node_initialize(
-	          &node,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2423,17 +6584,14 @@ int cdata_test_btree_node_flatten_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_set_value(
+	result = libcdata_btree_node_append_value(
 	          node,
-	          (intptr_t *) values_list1,
+	          (intptr_t *) &value3,
+	          3,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2445,10 +6603,10 @@ int cdata_test_btree_node_flatten_node(
 	 "error",
 	 error );
 
-	values_list1 = NULL;
-
-	result = libcdata_tree_node_initialize(
-	          &sub_node1,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value4,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2456,17 +6614,14 @@ int cdata_test_btree_node_flatten_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node1",
-	 sub_node1 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_append_node(
+	result = libcdata_btree_node_append_value(
 	          node,
-	          sub_node1,
+	          (intptr_t *) &value5,
+	          5,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2478,28 +6633,12 @@ int cdata_test_btree_node_flatten_node(
 	 "error",
 	 error );
 
-	sub_node1 = NULL;
-
-	/* Test regular cases - with a single sub node
+	/* Test regular cases
 	 */
-	result = libcdata_btree_node_flatten_node(
-	          &node,
-	          &error );
-
-	CDATA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Clean up
+	/* Split the root node, which causes the tree to grow in height
 	 */
-	result = libcdata_tree_node_free(
-	          &node,
-	          &libcdata_btree_values_list_free,
+	result = libcdata_btree_node_split(
+	          node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2507,18 +6646,13 @@ int cdata_test_btree_node_flatten_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libcdata_tree_node_initialize(
-	          &node,
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2526,50 +6660,47 @@ int cdata_test_btree_node_flatten_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_initialize(
-	          &sub_node1,
-	          &error );
-
 	CDATA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node1",
-	 sub_node1 );
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_sub_nodes",
+	 node_values->number_of_sub_nodes,
+	 2 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value3 );
 
-	result = libcdata_list_initialize(
-	          &values_list1,
+	result = libcdata_btree_node_get_node_values(
+	          node_values->sub_nodes[ 0 ],
+	          &sub_node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list1",
-	 values_list1 );
+	 1 );
 
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_initialize(
-	          &values_list_element1,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_values",
+	 sub_node_values->number_of_values,
+	 3 );
+
+	result = libcdata_btree_node_get_node_values(
+	          node_values->sub_nodes[ 1 ],
+	          &sub_node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2577,17 +6708,24 @@ int cdata_test_btree_node_flatten_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "values_list_element1",
-	 values_list_element1 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_list_element_set_value(
-	          values_list_element1,
-	          (intptr_t *) &value1,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_values",
+	 sub_node_values->number_of_values,
+	 2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node_values->values[ 0 ]",
+	 (intptr_t) sub_node_values->values[ 0 ],
+	 (intptr_t) &value4 );
+
+	/* Split a leaf node, which inserts the upper node in the parent node
+	 */
+	result = libcdata_btree_node_split(
+	          node_values->sub_nodes[ 0 ],
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2599,9 +6737,29 @@ int cdata_test_btree_node_flatten_node(
 	 "error",
 	 error );
 
-	result = libcdata_list_append_element(
-	          values_list1,
-	          values_list_element1,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_sub_nodes",
+	 node_values->number_of_sub_nodes,
+	 3 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 1 ]",
+	 (intptr_t) node_values->values[ 1 ],
+	 (intptr_t) &value3 );
+
+	result = libcdata_tree_node_get_number_of_sub_nodes(
+	          node,
+	          &number_of_sub_nodes,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2613,11 +6771,15 @@ int cdata_test_btree_node_flatten_node(
 	 "error",
 	 error );
 
-	values_list_element1 = NULL;
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_nodes",
+	 number_of_sub_nodes,
+	 3 );
 
-	result = libcdata_tree_node_set_value(
-	          sub_node1,
-	          (intptr_t *) values_list1,
+	result = libcdata_tree_node_get_sub_node_by_index(
+	          node,
+	          1,
+	          &sub_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2629,10 +6791,14 @@ int cdata_test_btree_node_flatten_node(
 	 "error",
 	 error );
 
-	values_list1 = NULL;
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node",
+	 (intptr_t) sub_node,
+	 (intptr_t) node_values->sub_nodes[ 1 ] );
 
-	result = libcdata_tree_node_initialize(
-	          &sub_node2,
+	result = libcdata_btree_node_get_node_values(
+	          sub_node,
+	          &sub_node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2640,17 +6806,24 @@ int cdata_test_btree_node_flatten_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node2",
-	 sub_node2 );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_append_node(
-	          sub_node1,
-	          sub_node2,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_values",
+	 sub_node_values->number_of_values,
+	 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node_values->values[ 0 ]",
+	 (intptr_t) sub_node_values->values[ 0 ],
+	 (intptr_t) &value3 );
+
+	/* Split a branch node, which moves the middle value to the parent node
+	 */
+	result = libcdata_btree_node_split(
+	          node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2662,11 +6835,24 @@ int cdata_test_btree_node_flatten_node(
 	 "error",
 	 error );
 
-	sub_node2 = NULL;
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 1 );
 
-	result = libcdata_tree_node_append_node(
-	          node,
-	          sub_node1,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_sub_nodes",
+	 node_values->number_of_sub_nodes,
+	 2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value3 );
+
+	result = libcdata_btree_node_get_node_values(
+	          node_values->sub_nodes[ 0 ],
+	          &sub_node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2678,12 +6864,24 @@ int cdata_test_btree_node_flatten_node(
 	 "error",
 	 error );
 
-	sub_node1 = NULL;
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_values",
+	 sub_node_values->number_of_values,
+	 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_sub_nodes",
+	 sub_node_values->number_of_sub_nodes,
+	 2 );
 
-	/* Test regular cases - node with multiple sub nodes
-	 */
-	result = libcdata_btree_node_flatten_node(
-	          &node,
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "sub_node_values->values[ 0 ]",
+	 (intptr_t) sub_node_values->values[ 0 ],
+	 (intptr_t) &value2 );
+
+	result = libcdata_btree_node_get_node_values(
+	          node_values->sub_nodes[ 1 ],
+	          &sub_node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2695,30 +6893,39 @@ int cdata_test_btree_node_flatten_node(
 	 "error",
 	 error );
 
-	/* Clean up
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_values",
+	 sub_node_values->number_of_values,
+	 0 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_sub_nodes",
+	 sub_node_values->number_of_sub_nodes,
+	 1 );
+
+	/* Test error cases
 	 */
-	result = libcdata_tree_node_free(
-	          &node,
-	          &libcdata_btree_values_list_free,
+	result = libcdata_btree_node_split(
+	          NULL,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "node",
-	 node );
+	 -1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a leaf node with less than 2 values
 	 */
-	result = libcdata_tree_node_initialize(
-	          &node,
+	result = libcdata_btree_node_get_node_values(
+	          sub_node,
+	          &sub_node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2726,18 +6933,17 @@ int cdata_test_btree_node_flatten_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcdata_btree_node_flatten_node(
-	          NULL,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "sub_node_values->number_of_values",
+	 sub_node_values->number_of_values,
+	 1 );
+
+	result = libcdata_btree_node_split(
+	          sub_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2754,9 +6960,8 @@ int cdata_test_btree_node_flatten_node(
 
 	/* Clean up
 	 */
-	result = libcdata_tree_node_free(
+	result = libcdata_btree_node_free(
 	          &node,
-	          &libcdata_btree_values_list_free,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2764,14 +6969,14 @@ int cdata_test_btree_node_flatten_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
 	return( 1 );
 
 on_error:
@@ -2780,73 +6985,38 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( sub_node2 != NULL )
-	{
-		libcdata_tree_node_free(
-		 &sub_node2,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
-	if( sub_node1 != NULL )
-	{
-		libcdata_tree_node_free(
-		 &sub_node1,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
-	if( values_list_element2 != NULL )
-	{
-		libcdata_list_element_free(
-		 &values_list_element2,
-		 NULL,
-		 NULL );
-	}
-	if( values_list2 != NULL )
-	{
-		libcdata_list_free(
-		 &values_list2,
-		 NULL,
-		 NULL );
-	}
-	if( values_list_element1 != NULL )
-	{
-		libcdata_list_element_free(
-		 &values_list_element1,
-		 NULL,
-		 NULL );
-	}
-	if( values_list1 != NULL )
-	{
-		libcdata_list_free(
-		 &values_list1,
-		 NULL,
-		 NULL );
-	}
 	if( node != NULL )
 	{
-		libcdata_tree_node_free(
+		libcdata_btree_node_free(
 		 &node,
-		 &libcdata_btree_values_list_free,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libcdata_btree_node_remove_sub_node function
+/* Tests the libcdata_btree_node_get_statistics function
  * Returns 1 if successful or 0 if not
  */
-int cdata_test_btree_node_remove_sub_node(
-    void )
+int cdata_test_btree_node_get_statistics(
+     void )
 {
-	libcdata_tree_node_t *node     = NULL;
-	libcdata_tree_node_t *sub_node = NULL;
-	libcerror_error_t *error       = NULL;
-	int result                     = 0;
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *node                = NULL;
+	libcerror_error_t *error                  = NULL;
+	int height                                = 0;
+	int number_of_leaf_nodes                  = 0;
+	int number_of_nodes                       = 0;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
 
 	/* Initialize test
 	 */
-	result = libcdata_tree_node_initialize(
+	result = libcdata_btree_node_initialize(
 	          &node,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2854,16 +7024,33 @@ int cdata_test_btree_node_remove_sub_node(
 	 result,
 	 1 );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "node",
 	 node );
 
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_initialize(
-	          &sub_node,
+	result = libcdata_btree_node_append_value(
+	          node,
+	          (intptr_t *) &value2,
+	          2,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2871,17 +7058,14 @@ int cdata_test_btree_node_remove_sub_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node",
-	 sub_node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_tree_node_append_node(
+	result = libcdata_btree_node_append_value(
 	          node,
-	          sub_node,
+	          (intptr_t *) &value3,
+	          3,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2893,13 +7077,10 @@ int cdata_test_btree_node_remove_sub_node(
 	 "error",
 	 error );
 
-	sub_node = NULL;
-
-	/* Test regular cases
-	 */
-	result = libcdata_tree_node_get_first_sub_node(
+	result = libcdata_btree_node_append_value(
 	          node,
-	          &sub_node,
+	          (intptr_t *) &value4,
+	          4,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2907,17 +7088,12 @@ int cdata_test_btree_node_remove_sub_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node",
-	 sub_node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdata_btree_node_remove_sub_node(
+	result = libcdata_btree_node_split(
 	          node,
-	          &sub_node,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2925,18 +7101,13 @@ int cdata_test_btree_node_remove_sub_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "sub_node",
-	 sub_node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libcdata_tree_node_initialize(
-	          &sub_node,
+	result = libcdata_btree_node_get_node_values(
+	          node,
+	          &node_values,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2944,36 +7115,52 @@ int cdata_test_btree_node_remove_sub_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_node",
-	 sub_node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libcdata_btree_node_remove_sub_node(
-	          NULL,
-	          &sub_node,
+	result = libcdata_btree_node_get_statistics(
+	          node,
+	          0,
+	          &height,
+	          &number_of_nodes,
+	          &number_of_leaf_nodes,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "height",
+	 height,
+	 1 );
 
-	result = libcdata_btree_node_remove_sub_node(
-	          node,
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_nodes",
+	 number_of_nodes,
+	 3 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_nodes",
+	 number_of_leaf_nodes,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_get_statistics(
 	          NULL,
+	          0,
+	          &height,
+	          &number_of_nodes,
+	          &number_of_leaf_nodes,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -2988,33 +7175,32 @@ int cdata_test_btree_node_remove_sub_node(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libcdata_tree_node_free(
-	          &sub_node,
-	          &libcdata_btree_values_list_free,
+	result = libcdata_btree_node_get_statistics(
+	          node,
+	          0,
+	          NULL,
+	          &number_of_nodes,
+	          &number_of_leaf_nodes,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "sub_node",
-	 sub_node );
+	 -1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	sub_node = NULL;
+	libcerror_error_free(
+	 &error );
 
-	result = libcdata_btree_node_remove_sub_node(
+	result = libcdata_btree_node_get_statistics(
 	          node,
-	          &sub_node,
+	          0,
+	          &height,
+	          NULL,
+	          &number_of_leaf_nodes,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -3029,15 +7215,14 @@ int cdata_test_btree_node_remove_sub_node(
 	libcerror_error_free(
 	 &error );
 
-	sub_node = (libcdata_tree_node_t *) 0x12345678UL;
-
-	result = libcdata_btree_node_remove_sub_node(
+	result = libcdata_btree_node_get_statistics(
 	          node,
-	          &sub_node,
+	          0,
+	          &height,
+	          &number_of_nodes,
+	          NULL,
 	          &error );
 
-	sub_node = NULL;
-
 	CDATA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -3052,9 +7237,8 @@ int cdata_test_btree_node_remove_sub_node(
 
 	/* Clean up
 	 */
-	result = libcdata_tree_node_free(
+	result = libcdata_btree_node_free(
 	          &node,
-	          &libcdata_btree_values_list_free,
 	          &error );
 
 	CDATA_TEST_ASSERT_EQUAL_INT(
@@ -3062,14 +7246,14 @@ int cdata_test_btree_node_remove_sub_node(
 	 result,
 	 1 );
 
-	CDATA_TEST_ASSERT_IS_NULL(
-	 "node",
-	 node );
-
 	CDATA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
 	return( 1 );
 
 on_error:
@@ -3078,18 +7262,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( sub_node != NULL )
-	{
-		libcdata_tree_node_free(
-		 &sub_node,
-		 &libcdata_btree_values_list_free,
-		 NULL );
-	}
 	if( node != NULL )
 	{
-		libcdata_tree_node_free(
+		libcdata_btree_node_free(
 		 &node,
-		 &libcdata_btree_values_list_free,
 		 NULL );
 	}
 	return( 0 );
@@ -3114,6 +7290,14 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
 
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_initialize",
+	 cdata_test_btree_node_initialize );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_get_value_by_index",
+	 cdata_test_btree_node_get_value_by_index );
+
 	CDATA_TEST_RUN(
 	 "libcdata_btree_node_get_sub_node_by_value",
 	 cdata_test_btree_node_get_sub_node_by_value );
@@ -3122,14 +7306,42 @@ int main(
 	 "libcdata_btree_node_get_upper_node_by_value",
 	 cdata_test_btree_node_get_upper_node_by_value );
 
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_get_sub_node_by_key",
+	 cdata_test_btree_node_get_sub_node_by_key );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_get_upper_node_by_key",
+	 cdata_test_btree_node_get_upper_node_by_key );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_get_value_by_rank",
+	 cdata_test_btree_node_get_value_by_rank );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_get_rank_of_value",
+	 cdata_test_btree_node_get_rank_of_value );
+
 	CDATA_TEST_RUN(
 	 "libcdata_btree_node_append_value",
 	 cdata_test_btree_node_append_value );
 
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_update_number_of_leaf_values",
+	 cdata_test_btree_node_update_number_of_leaf_values );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_adjust_number_of_leaf_values",
+	 cdata_test_btree_node_adjust_number_of_leaf_values );
+
 	CDATA_TEST_RUN(
 	 "libcdata_btree_node_insert_value",
 	 cdata_test_btree_node_insert_value );
 
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_insert_value_by_key",
+	 cdata_test_btree_node_insert_value_by_key );
+
 	CDATA_TEST_RUN(
 	 "libcdata_btree_node_replace_value",
 	 cdata_test_btree_node_replace_value );
@@ -3142,14 +7354,42 @@ int main(
 	 "libcdata_btree_node_remove_sub_node",
 	 cdata_test_btree_node_remove_sub_node );
 
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_get_sub_node_index",
+	 cdata_test_btree_node_get_sub_node_index );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_borrow_from_previous_sub_node",
+	 cdata_test_btree_node_borrow_from_previous_sub_node );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_borrow_from_next_sub_node",
+	 cdata_test_btree_node_borrow_from_next_sub_node );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_merge_sub_nodes",
+	 cdata_test_btree_node_merge_sub_nodes );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_rebalance_sub_node",
+	 cdata_test_btree_node_rebalance_sub_node );
+
 	CDATA_TEST_RUN(
 	 "libcdata_btree_node_remove_value",
 	 cdata_test_btree_node_remove_value );
 
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_move_values",
+	 cdata_test_btree_node_move_values );
+
 	CDATA_TEST_RUN(
 	 "libcdata_btree_node_split",
 	 cdata_test_btree_node_split );
 
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_get_statistics",
+	 cdata_test_btree_node_get_statistics );
+
 #endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
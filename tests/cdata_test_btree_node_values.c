@@ -0,0 +1,1697 @@
+/*
+ * Library balanced tree node values type test program
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdata_test_libcdata.h"
+#include "cdata_test_libcerror.h"
+#include "cdata_test_macros.h"
+#include "cdata_test_memory.h"
+#include "cdata_test_unused.h"
+
+#include "../libcdata/libcdata_btree_node_values.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+/* Test value compare function
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int cdata_test_btree_node_values_value_compare_function(
+     int *first_value,
+     int *second_value,
+     libcdata_error_t **error )
+{
+	static char *function = "cdata_test_btree_node_values_value_compare_function";
+
+	if( first_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first value.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *first_value < *second_value )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( *first_value > *second_value )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Tests the libcdata_btree_node_values_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_values_initialize(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_CDATA_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 1;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_values_initialize(
+	          &node_values,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node_values",
+	 node_values );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 0 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_sub_nodes",
+	 node_values->number_of_sub_nodes,
+	 0 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->maximum_number_of_values",
+	 node_values->maximum_number_of_values,
+	 4 );
+
+	/* The keys, values and sub nodes arrays are part of the same allocation
+	 */
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->keys",
+	 (int) ( ( (uint8_t *) node_values->keys - (uint8_t *) node_values ) % sizeof( uint64_t ) ),
+	 0 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->values",
+	 (int) ( (uint8_t *) node_values->values - (uint8_t *) node_values->keys ),
+	 (int) ( 5 * sizeof( uint64_t ) ) );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->sub_nodes",
+	 (int) ( (uint8_t *) node_values->sub_nodes - (uint8_t *) node_values->values ),
+	 (int) ( 5 * sizeof( intptr_t * ) ) );
+
+	result = libcdata_btree_node_values_free(
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node_values",
+	 node_values );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_values_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	node_values = (libcdata_btree_node_values_t *) 0x12345678UL;
+
+	result = libcdata_btree_node_values_initialize(
+	          &node_values,
+	          4,
+	          &error );
+
+	node_values = NULL;
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_values_initialize(
+	          &node_values,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdata_btree_node_values_initialize with malloc failing
+		 */
+		cdata_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdata_btree_node_values_initialize(
+		          &node_values,
+		          4,
+		          &error );
+
+		if( cdata_test_malloc_attempts_before_fail != -1 )
+		{
+			cdata_test_malloc_attempts_before_fail = -1;
+
+			if( node_values != NULL )
+			{
+				libcdata_btree_node_values_free(
+				 &node_values,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "node_values",
+			 node_values );
+
+			CDATA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdata_btree_node_values_initialize with memset failing
+		 */
+		cdata_test_memset_attempts_before_fail = test_number;
+
+		result = libcdata_btree_node_values_initialize(
+		          &node_values,
+		          4,
+		          &error );
+
+		if( cdata_test_memset_attempts_before_fail != -1 )
+		{
+			cdata_test_memset_attempts_before_fail = -1;
+
+			if( node_values != NULL )
+			{
+				libcdata_btree_node_values_free(
+				 &node_values,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "node_values",
+			 node_values );
+
+			CDATA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node_values != NULL )
+	{
+		libcdata_btree_node_values_free(
+		 &node_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_values_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_values_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_values_free(
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_values_get_value_index function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_values_get_value_index(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+	int value5                                = 5;
+	int value6                                = 6;
+	int value7                                = 7;
+	int value_index                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_values_initialize(
+	          &node_values,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node_values",
+	 node_values );
+
+	result = libcdata_btree_node_values_insert_value(
+	          node_values,
+	          0,
+	          (intptr_t *) &value2,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_values_insert_value(
+	          node_values,
+	          1,
+	          (intptr_t *) &value4,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_values_insert_value(
+	          node_values,
+	          2,
+	          (intptr_t *) &value6,
+	          6,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_values_get_value_index(
+	          node_values,
+	          (intptr_t *) &value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_node_values_value_compare_function,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 0 );
+
+	result = libcdata_btree_node_values_get_value_index(
+	          node_values,
+	          (intptr_t *) &value4,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_node_values_value_compare_function,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 1 );
+
+	result = libcdata_btree_node_values_get_value_index(
+	          node_values,
+	          (intptr_t *) &value6,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_node_values_value_compare_function,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 2 );
+
+	result = libcdata_btree_node_values_get_value_index(
+	          node_values,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_node_values_value_compare_function,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 0 );
+
+	result = libcdata_btree_node_values_get_value_index(
+	          node_values,
+	          (intptr_t *) &value3,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_node_values_value_compare_function,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 1 );
+
+	result = libcdata_btree_node_values_get_value_index(
+	          node_values,
+	          (intptr_t *) &value5,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_node_values_value_compare_function,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 2 );
+
+	result = libcdata_btree_node_values_get_value_index(
+	          node_values,
+	          (intptr_t *) &value7,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_node_values_value_compare_function,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 value_index,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_values_get_value_index(
+	          NULL,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_node_values_value_compare_function,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_values_get_value_index(
+	          node_values,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_node_values_value_compare_function,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_values_get_value_index(
+	          node_values,
+	          (intptr_t *) &value1,
+	          NULL,
+	          &value_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_values_get_value_index(
+	          node_values,
+	          (intptr_t *) &value1,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cdata_test_btree_node_values_value_compare_function,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_values_free(
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node_values",
+	 node_values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node_values != NULL )
+	{
+		libcdata_btree_node_values_free(
+		 &node_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_values_get_key_index function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_values_get_key_index(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcerror_error_t *error                  = NULL;
+	int key_index                             = 0;
+	int result                                = 0;
+	int value2                                = 2;
+	int value4                                = 4;
+	int value6                                = 6;
+	int value7                                = 7;
+	int value_iterator                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_values_initialize(
+	          &node_values,
+	          32,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node_values",
+	 node_values );
+
+	result = libcdata_btree_node_values_insert_value(
+	          node_values,
+	          0,
+	          (intptr_t *) &value2,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_values_insert_value(
+	          node_values,
+	          1,
+	          (intptr_t *) &value4,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_values_insert_value(
+	          node_values,
+	          2,
+	          (intptr_t *) &value6,
+	          6,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_values_get_key_index(
+	          node_values,
+	          2,
+	          &key_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "key_index",
+	 key_index,
+	 0 );
+
+	result = libcdata_btree_node_values_get_key_index(
+	          node_values,
+	          4,
+	          &key_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "key_index",
+	 key_index,
+	 1 );
+
+	result = libcdata_btree_node_values_get_key_index(
+	          node_values,
+	          6,
+	          &key_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "key_index",
+	 key_index,
+	 2 );
+
+	result = libcdata_btree_node_values_get_key_index(
+	          node_values,
+	          1,
+	          &key_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "key_index",
+	 key_index,
+	 0 );
+
+	result = libcdata_btree_node_values_get_key_index(
+	          node_values,
+	          3,
+	          &key_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "key_index",
+	 key_index,
+	 1 );
+
+	result = libcdata_btree_node_values_get_key_index(
+	          node_values,
+	          5,
+	          &key_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "key_index",
+	 key_index,
+	 2 );
+
+	result = libcdata_btree_node_values_get_key_index(
+	          node_values,
+	          7,
+	          &key_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "key_index",
+	 key_index,
+	 3 );
+
+	/* Test with more keys than are searched sequentially
+	 */
+	for( value_iterator = 3;
+	     value_iterator < 32;
+	     value_iterator++ )
+	{
+		result = libcdata_btree_node_values_insert_value(
+		          node_values,
+		          value_iterator,
+		          (intptr_t *) &value7,
+		          (uint64_t) ( ( value_iterator + 1 ) * 2 ),
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( value_iterator = 0;
+	     value_iterator < 32;
+	     value_iterator++ )
+	{
+		result = libcdata_btree_node_values_get_key_index(
+		          node_values,
+		          (uint64_t) ( ( value_iterator + 1 ) * 2 ),
+		          &key_index,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "key_index",
+		 key_index,
+		 value_iterator );
+
+		result = libcdata_btree_node_values_get_key_index(
+		          node_values,
+		          (uint64_t) ( ( value_iterator * 2 ) + 1 ),
+		          &key_index,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "key_index",
+		 key_index,
+		 value_iterator );
+	}
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_values_get_key_index(
+	          NULL,
+	          1,
+	          &key_index,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_values_get_key_index(
+	          node_values,
+	          1,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_values_free(
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node_values",
+	 node_values );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node_values != NULL )
+	{
+		libcdata_btree_node_values_free(
+		 &node_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_values_insert_value and libcdata_btree_node_values_remove_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_values_insert_value(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+	int value1                                = 1;
+	int value2                                = 2;
+	int value3                                = 3;
+	int value4                                = 4;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_values_initialize(
+	          &node_values,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node_values",
+	 node_values );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_values_insert_value(
+	          node_values,
+	          0,
+	          (intptr_t *) &value2,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_values_insert_value(
+	          node_values,
+	          0,
+	          (intptr_t *) &value1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A node can contain one value more than the maximum before it is split
+	 */
+	result = libcdata_btree_node_values_insert_value(
+	          node_values,
+	          2,
+	          (intptr_t *) &value3,
+	          3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 3 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 1 ]",
+	 (intptr_t) node_values->values[ 1 ],
+	 (intptr_t) &value2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 2 ]",
+	 (intptr_t) node_values->values[ 2 ],
+	 (intptr_t) &value3 );
+
+	CDATA_TEST_ASSERT_EQUAL_UINT64(
+	 "node_values->keys[ 0 ]",
+	 node_values->keys[ 0 ],
+	 (uint64_t) 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_UINT64(
+	 "node_values->keys[ 1 ]",
+	 node_values->keys[ 1 ],
+	 (uint64_t) 2 );
+
+	CDATA_TEST_ASSERT_EQUAL_UINT64(
+	 "node_values->keys[ 2 ]",
+	 node_values->keys[ 2 ],
+	 (uint64_t) 3 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_values_insert_value(
+	          node_values,
+	          3,
+	          (intptr_t *) &value4,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_values_insert_value(
+	          NULL,
+	          0,
+	          (intptr_t *) &value4,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_values_insert_value(
+	          node_values,
+	          -1,
+	          (intptr_t *) &value4,
+	          4,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_values_insert_value(
+	          node_values,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libcdata_btree_node_values_remove_value
+	 */
+	result = libcdata_btree_node_values_remove_value(
+	          node_values,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_values",
+	 node_values->number_of_values,
+	 2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 0 ]",
+	 (intptr_t) node_values->values[ 0 ],
+	 (intptr_t) &value1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->values[ 1 ]",
+	 (intptr_t) node_values->values[ 1 ],
+	 (intptr_t) &value3 );
+
+	result = libcdata_btree_node_values_remove_value(
+	          node_values,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_values_remove_value(
+	          NULL,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_values_free(
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node_values",
+	 node_values );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node_values != NULL )
+	{
+		libcdata_btree_node_values_free(
+		 &node_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_btree_node_values_insert_sub_node and libcdata_btree_node_values_remove_sub_node functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_btree_node_values_insert_sub_node(
+     void )
+{
+	libcdata_btree_node_values_t *node_values = NULL;
+	libcdata_tree_node_t *sub_node1           = (libcdata_tree_node_t *) 0x12345671UL;
+	libcdata_tree_node_t *sub_node2           = (libcdata_tree_node_t *) 0x12345672UL;
+	libcdata_tree_node_t *sub_node3           = (libcdata_tree_node_t *) 0x12345673UL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_btree_node_values_initialize(
+	          &node_values,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "node_values",
+	 node_values );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_btree_node_values_insert_sub_node(
+	          node_values,
+	          0,
+	          sub_node3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_values_insert_sub_node(
+	          node_values,
+	          0,
+	          sub_node1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_node_values_insert_sub_node(
+	          node_values,
+	          1,
+	          sub_node2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_sub_nodes",
+	 node_values->number_of_sub_nodes,
+	 3 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->sub_nodes[ 0 ]",
+	 (intptr_t) node_values->sub_nodes[ 0 ],
+	 (intptr_t) sub_node1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->sub_nodes[ 1 ]",
+	 (intptr_t) node_values->sub_nodes[ 1 ],
+	 (intptr_t) sub_node2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->sub_nodes[ 2 ]",
+	 (intptr_t) node_values->sub_nodes[ 2 ],
+	 (intptr_t) sub_node3 );
+
+	/* Test error cases
+	 */
+	result = libcdata_btree_node_values_insert_sub_node(
+	          node_values,
+	          3,
+	          sub_node3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_values_insert_sub_node(
+	          NULL,
+	          0,
+	          sub_node3,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_values_insert_sub_node(
+	          node_values,
+	          0,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libcdata_btree_node_values_remove_sub_node
+	 */
+	result = libcdata_btree_node_values_remove_sub_node(
+	          node_values,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "node_values->number_of_sub_nodes",
+	 node_values->number_of_sub_nodes,
+	 2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->sub_nodes[ 0 ]",
+	 (intptr_t) node_values->sub_nodes[ 0 ],
+	 (intptr_t) sub_node2 );
+
+	CDATA_TEST_ASSERT_EQUAL_INTPTR(
+	 "node_values->sub_nodes[ 1 ]",
+	 (intptr_t) node_values->sub_nodes[ 1 ],
+	 (intptr_t) sub_node3 );
+
+	result = libcdata_btree_node_values_remove_sub_node(
+	          node_values,
+	          2,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_btree_node_values_remove_sub_node(
+	          NULL,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_btree_node_values_free(
+	          &node_values,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "node_values",
+	 node_values );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node_values != NULL )
+	{
+		libcdata_btree_node_values_free(
+		 &node_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATA_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_values_initialize",
+	 cdata_test_btree_node_values_initialize );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_values_free",
+	 cdata_test_btree_node_values_free );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_values_get_value_index",
+	 cdata_test_btree_node_values_get_value_index );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_values_get_key_index",
+	 cdata_test_btree_node_values_get_key_index );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_values_insert_value",
+	 cdata_test_btree_node_values_insert_value );
+
+	CDATA_TEST_RUN(
+	 "libcdata_btree_node_values_insert_sub_node",
+	 cdata_test_btree_node_values_insert_sub_node );
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+}
+
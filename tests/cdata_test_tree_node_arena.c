@@ -0,0 +1,518 @@
+/*
+ * Library tree node arena test program
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdata_test_libcdata.h"
+#include "cdata_test_libcerror.h"
+#include "cdata_test_macros.h"
+#include "cdata_test_unused.h"
+
+#include "../libcdata/libcdata_tree_node.h"
+#include "../libcdata/libcdata_tree_node_arena.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+int cdata_test_tree_node_arena_number_of_freed_values = 0;
+
+/* Test value free function
+ * Returns 1 if successful or -1 on error
+ */
+int cdata_test_tree_node_arena_value_free_function(
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	static char *function = "cdata_test_tree_node_arena_value_free_function";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		memory_free(
+		 *value );
+
+		*value = NULL;
+
+		cdata_test_tree_node_arena_number_of_freed_values += 1;
+	}
+	return( 1 );
+}
+
+/* Tests the libcdata_tree_node_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_tree_node_arena_initialize(
+     void )
+{
+	libcdata_tree_node_arena_t *arena = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdata_tree_node_arena_initialize(
+	          &arena,
+	          8,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_nodes_per_chunk",
+	 arena->number_of_nodes_per_chunk,
+	 8 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_chunks",
+	 arena->number_of_chunks,
+	 0 );
+
+	result = libcdata_tree_node_arena_free(
+	          &arena,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_tree_node_arena_initialize(
+	          NULL,
+	          8,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libcdata_tree_node_arena_t *) 0x12345678UL;
+
+	result = libcdata_tree_node_arena_initialize(
+	          &arena,
+	          8,
+	          &error );
+
+	arena = NULL;
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libcdata_tree_node_arena_free(
+		 &arena,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_tree_node_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_tree_node_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdata_tree_node_arena_free(
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_tree_node_arena_allocate_node function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_tree_node_arena_allocate_node(
+     void )
+{
+	libcdata_tree_node_t *nodes[ 20 ];
+
+	libcdata_tree_node_arena_t *arena = NULL;
+	libcdata_tree_node_t *node        = NULL;
+	libcerror_error_t *error          = NULL;
+	int *value                        = NULL;
+	int node_index                    = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_tree_node_arena_initialize(
+	          &arena,
+	          8,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( node_index = 0;
+	     node_index < 20;
+	     node_index++ )
+	{
+		nodes[ node_index ] = NULL;
+
+		result = libcdata_tree_node_arena_allocate_node(
+		          arena,
+		          &( nodes[ node_index ] ),
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NOT_NULL(
+		 "nodes[ node_index ]",
+		 nodes[ node_index ] );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "arena->number_of_used_nodes",
+		 arena->number_of_used_nodes,
+		 ( node_index % 8 ) + 1 );
+
+		/* Every other node gets a value to test freeing the values with the arena
+		 */
+		if( ( node_index % 2 ) == 0 )
+		{
+			value = (int *) memory_allocate(
+			                 sizeof( int ) );
+
+			CDATA_TEST_ASSERT_IS_NOT_NULL(
+			 "value",
+			 value );
+
+			*value = node_index;
+
+			result = libcdata_tree_node_set_value(
+			          nodes[ node_index ],
+			          (intptr_t *) value,
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			value = NULL;
+		}
+	}
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_chunks",
+	 arena->number_of_chunks,
+	 3 );
+
+	/* Nodes in the same chunk are stored contiguously
+	 */
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "nodes[ 1 ] - nodes[ 0 ]",
+	 (int) ( (libcdata_internal_tree_node_t *) nodes[ 1 ] - (libcdata_internal_tree_node_t *) nodes[ 0 ] ),
+	 1 );
+
+	result = libcdata_tree_node_append_node(
+	          nodes[ 0 ],
+	          nodes[ 1 ],
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_tree_node_arena_allocate_node(
+	          NULL,
+	          &node,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_arena_allocate_node(
+	          arena,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	node = nodes[ 0 ];
+
+	result = libcdata_tree_node_arena_allocate_node(
+	          arena,
+	          &node,
+	          &error );
+
+	node = NULL;
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	cdata_test_tree_node_arena_number_of_freed_values = 0;
+
+	result = libcdata_tree_node_arena_free(
+	          &arena,
+	          &cdata_test_tree_node_arena_value_free_function,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "cdata_test_tree_node_arena_number_of_freed_values",
+	 cdata_test_tree_node_arena_number_of_freed_values,
+	 10 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		memory_free(
+		 value );
+	}
+	if( arena != NULL )
+	{
+		libcdata_tree_node_arena_free(
+		 &arena,
+		 &cdata_test_tree_node_arena_value_free_function,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATA_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+	CDATA_TEST_RUN(
+	 "libcdata_tree_node_arena_initialize",
+	 cdata_test_tree_node_arena_initialize );
+
+	CDATA_TEST_RUN(
+	 "libcdata_tree_node_arena_free",
+	 cdata_test_tree_node_arena_free );
+
+	CDATA_TEST_RUN(
+	 "libcdata_tree_node_arena_allocate_node",
+	 cdata_test_tree_node_arena_allocate_node );
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1466 @@
+/*
+ * Library tree node visitor test program
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdata_test_libcdata.h"
+#include "cdata_test_libcerror.h"
+#include "cdata_test_macros.h"
+#include "cdata_test_unused.h"
+
+#include "../libcdata/libcdata_tree_node.h"
+#include "../libcdata/libcdata_tree_node_visitor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+int cdata_test_tree_node_visitor_callback_function_return_value = 1;
+
+/* Test callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cdata_test_tree_node_visitor_callback_function(
+     libcdata_tree_node_t *node CDATA_TEST_ATTRIBUTE_UNUSED,
+     int *value,
+     void *user_data CDATA_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	static char *function = "cdata_test_tree_node_visitor_callback_function";
+
+	CDATA_TEST_UNREFERENCED_PARAMETER( node )
+	CDATA_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( cdata_test_tree_node_visitor_callback_function_return_value != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: callback failed.",
+		 function );
+
+		return( cdata_test_tree_node_visitor_callback_function_return_value );
+	}
+	*value += 1;
+
+	return( 1 );
+}
+
+/* Creates a test tree
+ * The nodes are stored in pre-order and every node references its visit count as value:
+ * 0
+ * +-1
+ * | +-2
+ * | +-3
+ * +-4
+ * +-5
+ *   +-6
+ *     +-7
+ * Returns 1 if successful or -1 on error
+ */
+int cdata_test_tree_node_visitor_create_test_tree(
+     libcdata_tree_node_t **nodes,
+     int *visit_counts,
+     libcerror_error_t **error )
+{
+	int parent_node_indexes[ 8 ] = { -1, 0, 1, 1, 0, 0, 5, 6 };
+	int node_index               = 0;
+
+	for( node_index = 0;
+	     node_index < 8;
+	     node_index++ )
+	{
+		nodes[ node_index ]        = NULL;
+		visit_counts[ node_index ] = 0;
+
+		if( libcdata_tree_node_initialize(
+		     &( nodes[ node_index ] ),
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libcdata_tree_node_set_value(
+		     nodes[ node_index ],
+		     (intptr_t *) &( visit_counts[ node_index ] ),
+		     error ) != 1 )
+		{
+			libcdata_tree_node_free(
+			 &( nodes[ node_index ] ),
+			 NULL,
+			 NULL );
+
+			goto on_error;
+		}
+		if( parent_node_indexes[ node_index ] != -1 )
+		{
+			if( libcdata_tree_node_append_node(
+			     nodes[ parent_node_indexes[ node_index ] ],
+			     nodes[ node_index ],
+			     error ) != 1 )
+			{
+				libcdata_tree_node_free(
+				 &( nodes[ node_index ] ),
+				 NULL,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( nodes[ 0 ] != NULL )
+	{
+		libcdata_tree_node_free(
+		 &( nodes[ 0 ] ),
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libcdata_tree_node_visitor_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_tree_node_visitor_queue_initialize(
+     void )
+{
+	libcdata_tree_node_visitor_queue_t *queue = NULL;
+	libcdata_tree_node_visitor_t *visitor     = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_tree_node_visitor_initialize(
+	          &visitor,
+	          (int (*)(libcdata_tree_node_t *, intptr_t *, void *, libcerror_error_t **)) &cdata_test_tree_node_visitor_callback_function,
+	          NULL,
+	          1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "visitor",
+	 visitor );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_tree_node_visitor_queue_initialize(
+	          &queue,
+	          visitor,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "queue",
+	 queue );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_visitor_queue_free(
+	          &queue,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "queue",
+	 queue );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_tree_node_visitor_queue_initialize(
+	          NULL,
+	          visitor,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	queue = (libcdata_tree_node_visitor_queue_t *) 0x12345678UL;
+
+	result = libcdata_tree_node_visitor_queue_initialize(
+	          &queue,
+	          visitor,
+	          0,
+	          &error );
+
+	queue = NULL;
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_visitor_queue_initialize(
+	          &queue,
+	          NULL,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_visitor_queue_initialize(
+	          &queue,
+	          visitor,
+	          -1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_tree_node_visitor_free(
+	          &visitor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcdata_tree_node_visitor_queue_free(
+		 &queue,
+		 NULL );
+	}
+	if( visitor != NULL )
+	{
+		libcdata_tree_node_visitor_free(
+		 &visitor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_tree_node_visitor_queue_push_task, libcdata_tree_node_visitor_queue_pop_task
+ * and libcdata_tree_node_visitor_queue_steal_task functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_tree_node_visitor_queue_push_pop_and_steal_task(
+     void )
+{
+	libcdata_tree_node_t *nodes[ 8 ];
+	int visit_counts[ 8 ];
+
+	libcdata_tree_node_visitor_task_t task;
+
+	libcdata_tree_node_visitor_queue_t *queue = NULL;
+	libcdata_tree_node_visitor_t *visitor     = NULL;
+	libcerror_error_t *error                  = NULL;
+	int node_index                            = 0;
+	int result                                = 0;
+
+	nodes[ 0 ] = NULL;
+
+	/* Initialize test
+	 */
+	result = cdata_test_tree_node_visitor_create_test_tree(
+	          nodes,
+	          visit_counts,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_visitor_initialize(
+	          &visitor,
+	          (int (*)(libcdata_tree_node_t *, intptr_t *, void *, libcerror_error_t **)) &cdata_test_tree_node_visitor_callback_function,
+	          NULL,
+	          1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	queue = visitor->queues[ 0 ];
+
+	/* Test pop and steal on an empty queue
+	 */
+	result = libcdata_tree_node_visitor_queue_pop_task(
+	          queue,
+	          &task,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_visitor_queue_steal_task(
+	          queue,
+	          &task,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test push of more tasks than fit in a single allocation block
+	 */
+	for( node_index = 0;
+	     node_index < 24;
+	     node_index++ )
+	{
+		result = libcdata_tree_node_visitor_queue_push_task(
+		          queue,
+		          nodes[ node_index % 8 ],
+		          NULL,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test steal retrieves the tasks from the front
+	 */
+	for( node_index = 0;
+	     node_index < 8;
+	     node_index++ )
+	{
+		result = libcdata_tree_node_visitor_queue_steal_task(
+		          queue,
+		          &task,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_EQUAL_INTPTR(
+		 "task.node",
+		 (intptr_t) task.node,
+		 (intptr_t) nodes[ node_index ] );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test push reclaims the space of the stolen tasks
+	 */
+	for( node_index = 0;
+	     node_index < 8;
+	     node_index++ )
+	{
+		result = libcdata_tree_node_visitor_queue_push_task(
+		          queue,
+		          nodes[ node_index ],
+		          nodes[ 0 ],
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "queue->number_of_allocated_tasks",
+	 queue->number_of_allocated_tasks,
+	 32 );
+
+	/* Test pop retrieves the tasks from the back
+	 */
+	for( node_index = 7;
+	     node_index >= 0;
+	     node_index-- )
+	{
+		result = libcdata_tree_node_visitor_queue_pop_task(
+		          queue,
+		          &task,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_EQUAL_INTPTR(
+		 "task.node",
+		 (intptr_t) task.node,
+		 (intptr_t) nodes[ node_index ] );
+
+		CDATA_TEST_ASSERT_EQUAL_INTPTR(
+		 "task.parent_node",
+		 (intptr_t) task.parent_node,
+		 (intptr_t) nodes[ 0 ] );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( node_index = 0;
+	     node_index < 16;
+	     node_index++ )
+	{
+		result = libcdata_tree_node_visitor_queue_pop_task(
+		          queue,
+		          &task,
+		          &error );
+
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcdata_tree_node_visitor_queue_pop_task(
+	          queue,
+	          &task,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_tree_node_visitor_queue_push_task(
+	          NULL,
+	          nodes[ 0 ],
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_visitor_queue_push_task(
+	          queue,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_visitor_queue_pop_task(
+	          NULL,
+	          &task,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_visitor_queue_pop_task(
+	          queue,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_visitor_queue_steal_task(
+	          NULL,
+	          &task,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_visitor_queue_steal_task(
+	          queue,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_tree_node_visitor_free(
+	          &visitor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_free(
+	          &( nodes[ 0 ] ),
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( visitor != NULL )
+	{
+		libcdata_tree_node_visitor_free(
+		 &visitor,
+		 NULL );
+	}
+	if( nodes[ 0 ] != NULL )
+	{
+		libcdata_tree_node_free(
+		 &( nodes[ 0 ] ),
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_tree_node_visitor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_tree_node_visitor_initialize(
+     void )
+{
+	libcdata_tree_node_visitor_t *visitor = NULL;
+	libcerror_error_t *error              = NULL;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdata_tree_node_visitor_initialize(
+	          &visitor,
+	          (int (*)(libcdata_tree_node_t *, intptr_t *, void *, libcerror_error_t **)) &cdata_test_tree_node_visitor_callback_function,
+	          NULL,
+	          4,
+	          LIBCDATA_TREE_NODE_VISITOR_SERIAL_CUTOFF,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "visitor",
+	 visitor );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "visitor->number_of_queues",
+	 visitor->number_of_queues,
+	 4 );
+
+	result = libcdata_tree_node_visitor_free(
+	          &visitor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "visitor",
+	 visitor );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_tree_node_visitor_initialize(
+	          NULL,
+	          (int (*)(libcdata_tree_node_t *, intptr_t *, void *, libcerror_error_t **)) &cdata_test_tree_node_visitor_callback_function,
+	          NULL,
+	          1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	visitor = (libcdata_tree_node_visitor_t *) 0x12345678UL;
+
+	result = libcdata_tree_node_visitor_initialize(
+	          &visitor,
+	          (int (*)(libcdata_tree_node_t *, intptr_t *, void *, libcerror_error_t **)) &cdata_test_tree_node_visitor_callback_function,
+	          NULL,
+	          1,
+	          1,
+	          &error );
+
+	visitor = NULL;
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_visitor_initialize(
+	          &visitor,
+	          NULL,
+	          NULL,
+	          1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_visitor_initialize(
+	          &visitor,
+	          (int (*)(libcdata_tree_node_t *, intptr_t *, void *, libcerror_error_t **)) &cdata_test_tree_node_visitor_callback_function,
+	          NULL,
+	          0,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_visitor_initialize(
+	          &visitor,
+	          (int (*)(libcdata_tree_node_t *, intptr_t *, void *, libcerror_error_t **)) &cdata_test_tree_node_visitor_callback_function,
+	          NULL,
+	          1,
+	          0,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( visitor != NULL )
+	{
+		libcdata_tree_node_visitor_free(
+		 &visitor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_tree_node_visitor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_tree_node_visitor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdata_tree_node_visitor_free(
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_tree_node_visitor_set_worker_error function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_tree_node_visitor_set_worker_error(
+     void )
+{
+	libcdata_tree_node_visitor_t *visitor = NULL;
+	libcerror_error_t *error              = NULL;
+	libcerror_error_t *worker_error       = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_tree_node_visitor_initialize(
+	          &visitor,
+	          (int (*)(libcdata_tree_node_t *, intptr_t *, void *, libcerror_error_t **)) &cdata_test_tree_node_visitor_callback_function,
+	          NULL,
+	          1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	libcerror_error_set(
+	 &worker_error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+	 "%s: worker failed.",
+	 "cdata_test_tree_node_visitor_set_worker_error" );
+
+	result = libcdata_tree_node_visitor_set_worker_error(
+	          visitor,
+	          &worker_error,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "worker_error",
+	 worker_error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "visitor->error",
+	 visitor->error );
+
+	/* Test if only the error of the first worker is kept
+	 */
+	libcerror_error_set(
+	 &worker_error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+	 "%s: worker failed.",
+	 "cdata_test_tree_node_visitor_set_worker_error" );
+
+	result = libcdata_tree_node_visitor_set_worker_error(
+	          visitor,
+	          &worker_error,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "worker_error",
+	 worker_error );
+
+	/* Test error cases
+	 */
+	result = libcdata_tree_node_visitor_set_worker_error(
+	          NULL,
+	          &worker_error,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_visitor_set_worker_error(
+	          visitor,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	libcerror_error_free(
+	 &worker_error );
+
+	result = libcdata_tree_node_visitor_free(
+	          &visitor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( worker_error != NULL )
+	{
+		libcerror_error_free(
+		 &worker_error );
+	}
+	if( visitor != NULL )
+	{
+		libcdata_tree_node_visitor_free(
+		 &visitor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_tree_node_visitor_run function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_tree_node_visitor_run(
+     void )
+{
+	libcdata_tree_node_t *nodes[ 8 ];
+	int visit_counts[ 8 ];
+
+	libcdata_tree_node_visitor_t *visitor = NULL;
+	libcerror_error_t *error              = NULL;
+	int expected_visit_count              = 0;
+	int node_index                        = 0;
+	int number_of_queues                  = 0;
+	int result                            = 0;
+	int serial_cutoff                     = 0;
+
+	nodes[ 0 ] = NULL;
+
+	/* Initialize test
+	 */
+	result = cdata_test_tree_node_visitor_create_test_tree(
+	          nodes,
+	          visit_counts,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with different serial cutoffs and number of queues
+	 */
+	for( number_of_queues = 1;
+	     number_of_queues <= 4;
+	     number_of_queues += 3 )
+	{
+		for( serial_cutoff = 1;
+		     serial_cutoff <= 8;
+		     serial_cutoff++ )
+		{
+			for( node_index = 0;
+			     node_index < 8;
+			     node_index++ )
+			{
+				visit_counts[ node_index ] = 0;
+			}
+			result = libcdata_tree_node_visitor_initialize(
+			          &visitor,
+			          (int (*)(libcdata_tree_node_t *, intptr_t *, void *, libcerror_error_t **)) &cdata_test_tree_node_visitor_callback_function,
+			          NULL,
+			          number_of_queues,
+			          serial_cutoff,
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libcdata_tree_node_visitor_run(
+			          visitor,
+			          nodes[ 0 ],
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "visitor->number_of_pending_tasks",
+			 visitor->number_of_pending_tasks,
+			 0 );
+
+			result = libcdata_tree_node_visitor_free(
+			          &visitor,
+			          &error );
+
+			CDATA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			for( node_index = 0;
+			     node_index < 8;
+			     node_index++ )
+			{
+				CDATA_TEST_ASSERT_EQUAL_INT(
+				 "visit_counts[ node_index ]",
+				 visit_counts[ node_index ],
+				 1 );
+			}
+		}
+	}
+	/* Test regular cases with a sub tree
+	 */
+	for( node_index = 0;
+	     node_index < 8;
+	     node_index++ )
+	{
+		visit_counts[ node_index ] = 0;
+	}
+	result = libcdata_tree_node_visitor_initialize(
+	          &visitor,
+	          (int (*)(libcdata_tree_node_t *, intptr_t *, void *, libcerror_error_t **)) &cdata_test_tree_node_visitor_callback_function,
+	          NULL,
+	          1,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_visitor_run(
+	          visitor,
+	          nodes[ 1 ],
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_visitor_free(
+	          &visitor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( node_index = 0;
+	     node_index < 8;
+	     node_index++ )
+	{
+		if( ( node_index >= 1 ) && ( node_index <= 3 ) )
+		{
+			expected_visit_count = 1;
+		}
+		else
+		{
+			expected_visit_count = 0;
+		}
+		CDATA_TEST_ASSERT_EQUAL_INT(
+		 "visit_counts[ node_index ]",
+		 visit_counts[ node_index ],
+		 expected_visit_count );
+	}
+	/* Test error cases
+	 */
+	result = libcdata_tree_node_visitor_run(
+	          NULL,
+	          nodes[ 0 ],
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libcdata_tree_node_visitor_run with callback function failing
+	 */
+	result = libcdata_tree_node_visitor_initialize(
+	          &visitor,
+	          (int (*)(libcdata_tree_node_t *, intptr_t *, void *, libcerror_error_t **)) &cdata_test_tree_node_visitor_callback_function,
+	          NULL,
+	          4,
+	          1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cdata_test_tree_node_visitor_callback_function_return_value = -1;
+
+	result = libcdata_tree_node_visitor_run(
+	          visitor,
+	          nodes[ 0 ],
+	          &error );
+
+	cdata_test_tree_node_visitor_callback_function_return_value = 1;
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	/* Test if the error of the callback function is returned
+	 */
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "visitor->error",
+	 visitor->error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_node_visitor_free(
+	          &visitor,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcdata_tree_node_free(
+	          &( nodes[ 0 ] ),
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( visitor != NULL )
+	{
+		libcdata_tree_node_visitor_free(
+		 &visitor,
+		 NULL );
+	}
+	if( nodes[ 0 ] != NULL )
+	{
+		libcdata_tree_node_free(
+		 &( nodes[ 0 ] ),
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATA_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+	CDATA_TEST_RUN(
+	 "libcdata_tree_node_visitor_queue_initialize",
+	 cdata_test_tree_node_visitor_queue_initialize );
+
+	CDATA_TEST_RUN(
+	 "libcdata_tree_node_visitor_queue_push_task",
+	 cdata_test_tree_node_visitor_queue_push_pop_and_steal_task );
+
+	CDATA_TEST_RUN(
+	 "libcdata_tree_node_visitor_initialize",
+	 cdata_test_tree_node_visitor_initialize );
+
+	CDATA_TEST_RUN(
+	 "libcdata_tree_node_visitor_free",
+	 cdata_test_tree_node_visitor_free );
+
+	CDATA_TEST_RUN(
+	 "libcdata_tree_node_visitor_set_worker_error",
+	 cdata_test_tree_node_visitor_set_worker_error );
+
+	CDATA_TEST_RUN(
+	 "libcdata_tree_node_visitor_run",
+	 cdata_test_tree_node_visitor_run );
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* #if defined( __GNUC__ ) && !defined( LIBCDATA_DLL_IMPORT ) */
+}
+
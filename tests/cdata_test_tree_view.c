@@ -0,0 +1,1314 @@
+/*
+ * Library tree view test program
+ *
+ * Copyright (C) 2006-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdata_test_libcdata.h"
+#include "cdata_test_libcerror.h"
+#include "cdata_test_macros.h"
+#include "cdata_test_unused.h"
+
+/* Test value free function
+ * Returns 1 if successful or -1 on error
+ */
+int cdata_test_tree_view_value_free_function(
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	static char *function = "cdata_test_tree_view_value_free_function";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		memory_free(
+		 *value );
+
+		*value = NULL;
+	}
+	return( 1 );
+}
+
+/* Test value serialize function
+ * Returns 1 if successful or -1 on error
+ */
+int cdata_test_tree_view_value_serialize_function(
+     int *value,
+     uint8_t *data,
+     size_t data_size,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "cdata_test_tree_view_value_serialize_function";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data != NULL )
+	{
+		if( data_size < sizeof( int ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     data,
+		     value,
+		     sizeof( int ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*value_data_size = sizeof( int );
+
+	return( 1 );
+}
+
+/* Creates a serialized test tree
+ * The nodes are stored in pre-order:
+ * 0
+ * +-1
+ * | +-2
+ * +-(no value)
+ * +-3
+ * Returns 1 if successful or -1 on error
+ */
+int cdata_test_tree_view_create_test_data(
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *node     = NULL;
+	libcdata_tree_node_t *sub_node = NULL;
+	int *value                     = NULL;
+	int value_index                = 0;
+
+	if( libcdata_tree_node_initialize(
+	     &node,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		value = (int *) memory_allocate(
+		                 sizeof( int ) );
+
+		if( value == NULL )
+		{
+			goto on_error;
+		}
+		*value = value_index;
+
+		if( value_index == 0 )
+		{
+			if( libcdata_tree_node_set_value(
+			     node,
+			     (intptr_t *) value,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else if( value_index == 2 )
+		{
+			if( libcdata_tree_node_get_sub_node_by_index(
+			     node,
+			     0,
+			     &sub_node,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libcdata_tree_node_append_value(
+			     sub_node,
+			     (intptr_t *) value,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( ( value_index == 3 )
+			 && ( libcdata_tree_node_append_value(
+			       node,
+			       NULL,
+			       error ) != 1 ) )
+			{
+				goto on_error;
+			}
+			if( libcdata_tree_node_append_value(
+			     node,
+			     (intptr_t *) value,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		value = NULL;
+	}
+	if( libcdata_tree_node_get_serialized_data_size(
+	     node,
+	     (int (*)(intptr_t *, uint8_t *, size_t, size_t *, libcerror_error_t **)) &cdata_test_tree_view_value_serialize_function,
+	     data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*data = (uint8_t *) memory_allocate(
+	                     *data_size );
+
+	if( *data == NULL )
+	{
+		goto on_error;
+	}
+	if( libcdata_tree_node_serialize(
+	     node,
+	     (int (*)(intptr_t *, uint8_t *, size_t, size_t *, libcerror_error_t **)) &cdata_test_tree_view_value_serialize_function,
+	     *data,
+	     *data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_tree_node_free(
+	     &node,
+	     &cdata_test_tree_view_value_free_function,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *data != NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
+	if( value != NULL )
+	{
+		memory_free(
+		 value );
+	}
+	if( node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &node,
+		 &cdata_test_tree_view_value_free_function,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libcdata_tree_view_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_tree_view_initialize(
+     void )
+{
+	libcdata_tree_view_t *tree_view = NULL;
+	libcerror_error_t *error        = NULL;
+	uint8_t *data                   = NULL;
+	size_t data_size                = 0;
+	int number_of_nodes             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = cdata_test_tree_view_create_test_data(
+	          &data,
+	          &data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_tree_view_initialize(
+	          &tree_view,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "tree_view",
+	 tree_view );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_view_get_number_of_nodes(
+	          tree_view,
+	          &number_of_nodes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_nodes",
+	 number_of_nodes,
+	 5 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_view_free(
+	          &tree_view,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "tree_view",
+	 tree_view );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_tree_view_initialize(
+	          NULL,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	tree_view = (libcdata_tree_view_t *) 0x12345678UL;
+
+	result = libcdata_tree_view_initialize(
+	          &tree_view,
+	          data,
+	          data_size,
+	          &error );
+
+	tree_view = NULL;
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_initialize(
+	          &tree_view,
+	          NULL,
+	          data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_initialize(
+	          &tree_view,
+	          data,
+	          16,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with truncated data
+	 */
+	result = libcdata_tree_view_initialize(
+	          &tree_view,
+	          data,
+	          data_size - 1,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid signature
+	 */
+	data[ 0 ] = 0xff;
+
+	result = libcdata_tree_view_initialize(
+	          &tree_view,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data[ 0 ] = 'c';
+
+	/* Test with an unsupported format version
+	 */
+	data[ 8 ] = 0xff;
+
+	result = libcdata_tree_view_initialize(
+	          &tree_view,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data[ 8 ] = 1;
+
+	/* Test with a non-zero reserved value
+	 */
+	data[ 24 ] = 0xff;
+
+	result = libcdata_tree_view_initialize(
+	          &tree_view,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data[ 24 ] = 0;
+
+	/* Test with a number of nodes that does not fit in the data
+	 */
+	data[ 12 ] = 0xff;
+
+	result = libcdata_tree_view_initialize(
+	          &tree_view,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tree_view != NULL )
+	{
+		libcdata_tree_view_free(
+		 &tree_view,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_tree_view_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_tree_view_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdata_tree_view_free(
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdata_tree_view_get_first_sub_node_offset, libcdata_tree_view_get_next_node_offset
+ * and libcdata_tree_view_get_parent_node_offset functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdata_test_tree_view_get_node_offsets(
+     void )
+{
+	libcdata_tree_view_t *tree_view = NULL;
+	libcerror_error_t *error        = NULL;
+	const uint8_t *value_data       = NULL;
+	uint8_t *data                   = NULL;
+	size_t data_size                = 0;
+	size_t node_offset              = 0;
+	size_t parent_node_offset       = 0;
+	size_t root_node_offset         = 0;
+	size_t sub_node_offset          = 0;
+	size_t value_data_size          = 0;
+	int number_of_sub_nodes         = 0;
+	int result                      = 0;
+	int value                       = 0;
+
+	/* Initialize test
+	 */
+	result = cdata_test_tree_view_create_test_data(
+	          &data,
+	          &data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_view_initialize(
+	          &tree_view,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdata_tree_view_get_root_node_offset(
+	          tree_view,
+	          &root_node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_SIZE(
+	 "root_node_offset",
+	 root_node_offset,
+	 (size_t) 32 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_view_get_number_of_sub_nodes(
+	          tree_view,
+	          root_node_offset,
+	          &number_of_sub_nodes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_nodes",
+	 number_of_sub_nodes,
+	 3 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_view_get_value_data(
+	          tree_view,
+	          root_node_offset,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) sizeof( int ) );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 &value,
+	 value_data,
+	 sizeof( int ) );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 value,
+	 0 );
+
+	result = libcdata_tree_view_get_parent_node_offset(
+	          tree_view,
+	          root_node_offset,
+	          &parent_node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_view_get_next_node_offset(
+	          tree_view,
+	          root_node_offset,
+	          &node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Node 1
+	 */
+	result = libcdata_tree_view_get_first_sub_node_offset(
+	          tree_view,
+	          root_node_offset,
+	          &node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_SIZE(
+	 "node_offset",
+	 node_offset,
+	 (size_t) ( 2 * 32 ) + sizeof( int ) );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Node 2
+	 */
+	result = libcdata_tree_view_get_first_sub_node_offset(
+	          tree_view,
+	          node_offset,
+	          &sub_node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_view_get_value_data(
+	          tree_view,
+	          sub_node_offset,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 &value,
+	 value_data,
+	 sizeof( int ) );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 value,
+	 2 );
+
+	result = libcdata_tree_view_get_parent_node_offset(
+	          tree_view,
+	          sub_node_offset,
+	          &parent_node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_SIZE(
+	 "parent_node_offset",
+	 parent_node_offset,
+	 (size_t) node_offset );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_view_get_next_node_offset(
+	          tree_view,
+	          sub_node_offset,
+	          &parent_node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_view_get_first_sub_node_offset(
+	          tree_view,
+	          sub_node_offset,
+	          &parent_node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Node without a value
+	 */
+	result = libcdata_tree_view_get_next_node_offset(
+	          tree_view,
+	          node_offset,
+	          &node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_view_get_value_data(
+	          tree_view,
+	          node_offset,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "value_data",
+	 value_data );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_view_get_parent_node_offset(
+	          tree_view,
+	          node_offset,
+	          &parent_node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_EQUAL_SIZE(
+	 "parent_node_offset",
+	 parent_node_offset,
+	 (size_t) root_node_offset );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Node 3
+	 */
+	result = libcdata_tree_view_get_next_node_offset(
+	          tree_view,
+	          node_offset,
+	          &node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_view_get_value_data(
+	          tree_view,
+	          node_offset,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 &value,
+	 value_data,
+	 sizeof( int ) );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 value,
+	 3 );
+
+	result = libcdata_tree_view_get_next_node_offset(
+	          tree_view,
+	          node_offset,
+	          &sub_node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdata_tree_view_get_root_node_offset(
+	          NULL,
+	          &root_node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_get_root_node_offset(
+	          tree_view,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_get_first_sub_node_offset(
+	          NULL,
+	          root_node_offset,
+	          &node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_get_first_sub_node_offset(
+	          tree_view,
+	          0,
+	          &node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_get_first_sub_node_offset(
+	          tree_view,
+	          data_size + 1024,
+	          &node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_get_first_sub_node_offset(
+	          tree_view,
+	          root_node_offset,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_get_next_node_offset(
+	          tree_view,
+	          root_node_offset,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_get_parent_node_offset(
+	          tree_view,
+	          root_node_offset,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_get_number_of_sub_nodes(
+	          tree_view,
+	          root_node_offset,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_get_value_data(
+	          tree_view,
+	          root_node_offset,
+	          NULL,
+	          &value_data_size,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_get_value_data(
+	          tree_view,
+	          root_node_offset,
+	          &value_data,
+	          NULL,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_tree_view_get_number_of_nodes(
+	          NULL,
+	          &number_of_sub_nodes,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a next node offset that points backwards
+	 * The next node offset of node 3 is stored at offset 8 of its entry
+	 */
+	data[ node_offset + 8 ] = 32;
+
+	result = libcdata_tree_view_get_next_node_offset(
+	          tree_view,
+	          node_offset,
+	          &sub_node_offset,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_tree_view_free(
+	          &tree_view,
+	          &error );
+
+	CDATA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tree_view != NULL )
+	{
+		libcdata_tree_view_free(
+		 &tree_view,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATA_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CDATA_TEST_RUN(
+	 "libcdata_tree_view_initialize",
+	 cdata_test_tree_view_initialize );
+
+	CDATA_TEST_RUN(
+	 "libcdata_tree_view_free",
+	 cdata_test_tree_view_free );
+
+	CDATA_TEST_RUN(
+	 "libcdata_tree_view_get_first_sub_node_offset",
+	 cdata_test_tree_view_get_node_offsets );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
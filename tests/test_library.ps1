@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "array btree btree_node btree_values_list error list list_element range_list range_list_value support tree_node"
+$LibraryTests = "array bloom_filter btree btree_cursor btree_node btree_node_values error list list_element range_list range_list_value support tree_node tree_node_arena tree_node_visitor tree_view"
 $LibraryTestsWithInput = ""
 $OptionSets = "" -split " "
 